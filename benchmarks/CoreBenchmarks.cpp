@@ -0,0 +1,367 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioDefaultRequestParameters.h"
+#include "modio/core/ModioInitializeOptions.h"
+#include "modio/core/ModioModCollectionEntry.h"
+#include "modio/detail/JsonWrapper.h"
+#include "modio/detail/ModioCRC.h"
+#include "modio/detail/ModioHashHelpers.h"
+#include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioSDKSessionData.h"
+#include "modio/detail/ModioStringHelpers.h"
+#include "modio/detail/compression/zlib/deflate_stream.hpp"
+#include "modio/detail/compression/zlib/inflate_stream.hpp"
+#include "modio/detail/serialization/ModioModInfoListSerialization.h"
+#include "modio/http/ModioHttpParams.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+/// Times the primitives that sit on the SDK's hot paths: CRC32 over downloaded and extracted data, deflating and
+/// inflating archive entries, appending to and consuming from a DynamicBuffer as response bodies are read, building
+/// request headers, parsing a page of mods, ordering the mod collection for processing, URL encoding request
+/// parameters and signing metrics sessions.
+///
+/// Run with an optional filter argument to only run the benchmarks whose names contain it, for example
+/// `modio_CoreBenchmarks CRC32`. Compare results from the same machine and build configuration only; the numbers in
+/// baseline.txt show what a change is measured against.
+
+namespace
+{
+	/// @brief Stops the compiler from discarding a result that is otherwise unused
+	volatile std::uint64_t Sink = 0;
+
+	/// @brief Runs Body repeatedly for at least half a second and prints the mean time per iteration, and the
+	/// throughput if BytesPerIteration is non-zero
+	template<typename BodyType>
+	void RunBenchmark(const char* Filter, const char* Name, std::size_t BytesPerIteration, BodyType&& Body)
+	{
+		if (Filter != nullptr && std::strstr(Name, Filter) == nullptr)
+		{
+			return;
+		}
+
+		// Warm up the caches and the buffer pool before timing
+		Body();
+
+		using Clock = std::chrono::steady_clock;
+		std::uint64_t Iterations = 0;
+		Clock::time_point Start = Clock::now();
+		Clock::duration Elapsed {};
+		do
+		{
+			Body();
+			++Iterations;
+			Elapsed = Clock::now() - Start;
+		} while (Elapsed < std::chrono::milliseconds(500));
+
+		double Nanoseconds =
+			double(std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed).count()) / double(Iterations);
+		if (BytesPerIteration > 0)
+		{
+			std::printf("%-40s %14.1f ns/iter %10.1f MiB/s\n", Name, Nanoseconds,
+						(double(BytesPerIteration) / (1024.0 * 1024.0)) / (Nanoseconds / 1e9));
+		}
+		else
+		{
+			std::printf("%-40s %14.1f ns/iter\n", Name, Nanoseconds);
+		}
+	}
+
+	Modio::Detail::Buffer MakeFilledBuffer(std::size_t Size)
+	{
+		Modio::Detail::Buffer Filled(Size);
+		for (std::size_t Index = 0; Index < Size; ++Index)
+		{
+			Filled[Index] = static_cast<unsigned char>(Index * 31 + 7);
+		}
+		return Filled;
+	}
+
+	/// @brief Fills a buffer the way the mock server's synthetic modfiles are, alternating incompressible and
+	/// repetitive 4KiB blocks, so that the compression benchmarks see data that is neither trivial nor random
+	Modio::Detail::Buffer MakeMixedBuffer(std::size_t Size)
+	{
+		constexpr std::size_t BlockSize = 4 * 1024;
+		const char Text[] = "Mod data that compresses well because it repeats. ";
+		Modio::Detail::Buffer Filled(Size);
+		std::uint32_t State = 2463534242u;
+		for (std::size_t Index = 0; Index < Size; ++Index)
+		{
+			if ((Index / BlockSize) % 2 == 0)
+			{
+				State ^= State << 13;
+				State ^= State >> 17;
+				State ^= State << 5;
+				Filled[Index] = static_cast<unsigned char>(State);
+			}
+			else
+			{
+				Filled[Index] = static_cast<unsigned char>(Text[Index % (sizeof(Text) - 1)]);
+			}
+		}
+		return Filled;
+	}
+
+	/// @brief Deflates all of Source into Destination in one pass, as AddFileEntryOp does for each chunk of a file
+	/// @return The number of compressed bytes
+	std::size_t DeflateAll(Modio::Detail::Zlib::deflate_stream& Stream, const Modio::Detail::Buffer& Source,
+						   Modio::Detail::Buffer& Destination)
+	{
+		Stream.reset();
+		Modio::Detail::Zlib::z_params State;
+		State.next_in = Source.Data();
+		State.avail_in = Source.GetSize();
+		State.next_out = Destination.Data();
+		State.avail_out = Destination.GetSize();
+		Modio::ErrorCode ec;
+		Stream.write(State, Modio::Detail::Zlib::Flush::finish, ec);
+		return static_cast<std::size_t>(State.total_out);
+	}
+
+	/// @brief Builds a page of mods from the mod and modfile objects the mock server serves, which are modelled on
+	/// recorded API responses
+	/// @return The page's JSON, or an empty string if the recorded responses could not be read
+	std::string MakeRecordedModsPage(std::size_t NumMods)
+	{
+		std::ifstream RecordedFile(MODIO_BENCHMARK_DATA_DIR "/recorded_responses.json");
+		std::string Recorded((std::istreambuf_iterator<char>(RecordedFile)), std::istreambuf_iterator<char>());
+		for (std::size_t Position = Recorded.find("{host}"); Position != std::string::npos;
+			 Position = Recorded.find("{host}", Position))
+		{
+			Recorded.replace(Position, 6, "benchmark.modio.test");
+		}
+
+		nlohmann::json Responses = nlohmann::json::parse(Recorded, nullptr, false);
+		if (Responses.is_discarded() || !Responses.contains("mod") || !Responses.contains("modfile"))
+		{
+			return {};
+		}
+
+		nlohmann::json Page = {{"data", nlohmann::json::array()},
+							   {"result_count", NumMods},
+							   {"result_offset", 0},
+							   {"result_limit", NumMods},
+							   {"result_total", NumMods * 10}};
+		for (std::size_t ModID = 1; ModID <= NumMods; ++ModID)
+		{
+			nlohmann::json Mod = Responses["mod"];
+			Mod["id"] = ModID;
+			Mod["game_id"] = 1;
+			Mod["name"] = "Benchmark Mod " + std::to_string(ModID);
+			Mod["name_id"] = "benchmark-mod-" + std::to_string(ModID);
+			Mod["stats"]["mod_id"] = ModID;
+			Mod["modfile"] = Responses["modfile"];
+			Mod["modfile"]["id"] = ModID;
+			Mod["modfile"]["mod_id"] = ModID;
+			Mod["modfile"]["filesize"] = 1048576;
+			Mod["modfile"]["filesize_uncompressed"] = 2097152;
+			Mod["modfile"]["filehash"]["md5"] = "0123456789abcdef0123456789abcdef";
+			Mod["modfile"]["filename"] = "mod_" + std::to_string(ModID) + ".zip";
+			Mod["modfile"]["download"]["binary_url"] = "https://benchmark.modio.test/files/" + std::to_string(ModID) +
+													   "/" + Mod["modfile"]["filename"].get<std::string>();
+			Page["data"].push_back(std::move(Mod));
+		}
+		return Page.dump();
+	}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	const char* Filter = argc > 1 ? argv[1] : nullptr;
+
+	// CRC32, as run over every file added to or extracted from an archive
+	{
+		constexpr std::size_t Size = 1024 * 1024;
+		Modio::Detail::Buffer Data = MakeFilledBuffer(Size);
+		RunBenchmark(Filter, "CRC32/Pointer/1MiB", Size, [&]() { Sink = Modio::Detail::CRC32(Data.Data(), Size); });
+		RunBenchmark(Filter, "CRC32/Buffer/1MiB", Size, [&]() { Sink = Modio::Detail::CRC32(Data); });
+	}
+
+	// Deflating an archive entry when a mod is uploaded, and inflating it again when the mod is installed
+	{
+		constexpr std::size_t Size = 1024 * 1024;
+		Modio::Detail::Buffer Data = MakeMixedBuffer(Size);
+		Modio::Detail::Buffer Compressed(Size * 2);
+
+		for (int Level : {1, 6, 9})
+		{
+			Modio::Detail::Zlib::deflate_stream Deflate;
+			Deflate.reset(Level, 15, 8, Modio::Detail::Zlib::Strategy::normal);
+			std::string Name = "Zlib/Deflate/Level" + std::to_string(Level) + "/1MiB";
+			RunBenchmark(Filter, Name.c_str(), Size, [&]() { Sink = DeflateAll(Deflate, Data, Compressed); });
+		}
+
+		Modio::Detail::Zlib::deflate_stream Deflate;
+		std::size_t CompressedSize = DeflateAll(Deflate, Data, Compressed);
+		Modio::Detail::Zlib::inflate_stream Inflate;
+		Modio::Detail::Buffer Inflated(Size);
+		RunBenchmark(Filter, "Zlib/Inflate/Level6/1MiB", Size, [&]() {
+			Inflate.reset();
+			Modio::Detail::Zlib::z_params State;
+			State.next_in = Compressed.Data();
+			State.avail_in = CompressedSize;
+			State.next_out = Inflated.Data();
+			State.avail_out = Inflated.GetSize();
+			Modio::ErrorCode ec;
+			Inflate.write(State, Modio::Detail::Zlib::Flush::none, ec);
+			Sink = State.total_out;
+		});
+	}
+
+	// Reading a response body in 16KiB chunks and then consuming it, as the HTTP and file services do
+	{
+		constexpr std::size_t ChunkSize = 16 * 1024;
+		constexpr std::size_t NumChunks = 64;
+		Modio::Detail::Buffer Chunk = MakeFilledBuffer(ChunkSize);
+
+		RunBenchmark(Filter, "DynamicBuffer/Append/64x16KiB", ChunkSize * NumChunks, [&]() {
+			Modio::Detail::DynamicBuffer Body;
+			for (std::size_t Index = 0; Index < NumChunks; ++Index)
+			{
+				Body.AppendBuffer(Chunk.Clone());
+			}
+			Sink = Body.size();
+		});
+
+		RunBenchmark(Filter, "DynamicBuffer/Consume/64x16KiB/4KiBSteps", ChunkSize * NumChunks, [&]() {
+			Modio::Detail::DynamicBuffer Body;
+			for (std::size_t Index = 0; Index < NumChunks; ++Index)
+			{
+				Body.AppendBuffer(Chunk.Clone());
+			}
+			while (Body.size() > 0)
+			{
+				Body.consume(4 * 1024);
+			}
+			Sink = Body.size();
+		});
+
+		Modio::Detail::DynamicBuffer Source;
+		for (std::size_t Index = 0; Index < NumChunks; ++Index)
+		{
+			Source.AppendBuffer(Chunk.Clone());
+		}
+		Modio::Detail::Buffer Destination(Source.size());
+		RunBenchmark(Filter, "DynamicBuffer/BufferCopy/1MiB", Source.size(),
+					 [&]() { Sink = Modio::Detail::BufferCopy(Destination, Source); });
+	}
+
+	// Building the request line and headers, as done for every API request
+	{
+		Modio::Detail::SDKSessionData::Initialize(Modio::InitializeOptions(
+			Modio::GameID(1), Modio::ApiKey("00000000000000000000000000000000"), Modio::Environment::Test,
+			Modio::Portal::None, "CoreBenchmarks"));
+		// Avoids creating the HTTP service for the platform header
+		Modio::Detail::SDKSessionData::SetPlatformOverride("windows");
+
+		const Modio::Detail::HttpRequestParams ListMods =
+			Modio::Detail::GetModsRequest.SetGameID(Modio::GameID(1))
+				.AddQueryParamRaw("_offset", "100")
+				.AddQueryParamRaw("_limit", "100")
+				.AddQueryParamRaw("tags-in", "Maps,Weapons")
+				.AddQueryParamRaw("_sort", "-downloads_total");
+		const Modio::Detail::HttpRequestParams ExchangeCode = Modio::Detail::ExchangeEmailSecurityCodeRequest
+			.AppendPayloadValue(Modio::Detail::Constants::APIStrings::SecurityCode, "00000");
+
+		RunBenchmark(Filter, "HttpRequestParams/GetFormattedResourcePath", 0,
+					 [&]() { Sink = ListMods.GetFormattedResourcePath().size(); });
+		RunBenchmark(Filter, "HttpRequestParams/GetRequestBuffer/Get", 0,
+					 [&]() { Sink = ListMods.GetRequestBuffer().GetSize(); });
+		RunBenchmark(Filter, "HttpRequestParams/GetRequestBuffer/UrlEncoded", 0,
+					 [&]() { Sink = ExchangeCode.GetRequestBuffer().GetSize(); });
+	}
+
+	// Parsing a page of ListAllMods results
+	{
+		std::string PageJson = MakeRecordedModsPage(100);
+		if (PageJson.empty())
+		{
+			std::printf("Skipping TryMarshalResponse: could not read %s/recorded_responses.json\n",
+						MODIO_BENCHMARK_DATA_DIR);
+		}
+		else
+		{
+			Modio::Detail::DynamicBuffer Page;
+			Modio::Detail::Buffer PageBuffer(PageJson.size());
+			std::memcpy(PageBuffer.Data(), PageJson.data(), PageJson.size());
+			Page.AppendBuffer(std::move(PageBuffer));
+			RunBenchmark(Filter, "TryMarshalResponse/ModInfoList/100Mods", PageJson.size(), [&]() {
+				Modio::Optional<Modio::ModInfoList> Mods = Modio::Detail::TryMarshalResponse<Modio::ModInfoList>(Page);
+				Sink = Mods.has_value() ? Mods->Size() : 0;
+			});
+		}
+	}
+
+	// Ordering the mod collection before mod management picks the next mod to process
+	{
+		Modio::ModCollection Collection;
+		for (std::int64_t Index = 1; Index <= 10000; ++Index)
+		{
+			Modio::ModInfo Mod;
+			Mod.ModId = Modio::ModID(Index);
+			Collection.AddOrUpdateMod(Mod, "/tmp/mod.io/mods/" + std::to_string(Index));
+		}
+		// A third of the entries have failed this session, and every sixth will not be retried until the next one
+		std::int64_t Index = 0;
+		for (const auto& Entry : Collection.Entries())
+		{
+			if (Index % 3 == 0)
+			{
+				Entry.second->SetLastError(Modio::make_error_code(Modio::HttpError::CannotOpenConnection));
+			}
+			if (Index % 6 == 0)
+			{
+				Entry.second->MarkModNoRetryThisSession();
+			}
+			++Index;
+		}
+		RunBenchmark(Filter, "ModCollection/SortEntriesByRetryPriority/10k", 0,
+					 [&]() { Sink = Collection.SortEntriesByRetryPriority().size(); });
+	}
+
+	// URL encoding a form parameter, as done for every urlencoded request payload
+	{
+		const std::string Plain = "The quick brown fox jumps over the lazy dog";
+		const std::string Reserved = "name=My Mod & Co.; tags=[Maps, Weapons]/v1.2?x=100%";
+		RunBenchmark(Filter, "URLEncode/Plain", Plain.size(),
+					 [&]() { Sink = Modio::Detail::String::URLEncode(Plain).size(); });
+		RunBenchmark(Filter, "URLEncode/Reserved", Reserved.size(),
+					 [&]() { Sink = Modio::Detail::String::URLEncode(Reserved).size(); });
+	}
+
+	// Signing a metrics session, and the underlying HMAC-SHA256 over a larger message
+	{
+		const std::string SecretKey = "0123456789abcdef0123456789abcdef";
+		// Mod IDs, timestamp, session ID and nonce, as concatenated by MetricsService
+		const std::string SessionString = std::string("1,2,3,4,5,6,7,8") + "1735689600" +
+										  "7e3b9d52-6c1a-4f0e-9a57-3c2d8e4b1f60" +
+										  "c4a1f7e2-0b9d-4e63-8f25-9d7a3b6e0c18";
+		RunBenchmark(Filter, "HMACSHA256/MetricsSession", SessionString.size(), [&]() {
+			Sink = Modio::Detail::Hash::HMACSHA256String(SecretKey, SessionString).size();
+		});
+
+		constexpr std::size_t Size = 64 * 1024;
+		Modio::Detail::Buffer Data = MakeFilledBuffer(Size);
+		std::uint8_t Digest[SHA256_HASH_SIZE];
+		RunBenchmark(Filter, "HMACSHA256/64KiB", Size, [&]() {
+			Sink = hmac_sha256(SecretKey.data(), SecretKey.size(), Data.Data(), Size, Digest, sizeof(Digest));
+		});
+	}
+
+	return 0;
+}
@@ -0,0 +1,633 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#include "modio/ModioSDK.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Runs end-to-end scenarios against benchmarks/mockserver/mock_modio_server.py and reports the wall time, CPU time,
+/// peak resident memory and disk traffic of each:
+///
+/// - subscribe-install: subscribes a freshly authenticated user to --mods mods and waits until all are installed
+/// - cold-start: initializes the SDK with the mods installed by subscribe-install on disk
+/// - validate-installs: reads back every installed file and checks the sizes against the modfiles' metadata
+/// - list-all-mods: pages through every mod the server has with ListAllModsAsync
+/// - upload-folder: submits a generated folder of --upload-mb MiB as a new modfile and waits for the upload
+///
+/// Scenarios run in that order, as each relies on the state the previous ones leave in the work directory, and each
+/// initializes and shuts down the SDK around its measurement. Pass a name fragment to only run some of them, for
+/// example `modio_ScenarioBenchmarks --server mock.modio.test cold-start`. Running each scenario as its own process
+/// in that order keeps the memory one scenario leaves behind out of the next one's peak.
+///
+/// Usage: modio_ScenarioBenchmarks --server HOST [--work-dir DIR] [--game-id ID] [--mods N] [--page-size N]
+///                                 [--upload-mb N] [--param Key=Value]... [Filter]
+///
+/// --param passes an extended initialization parameter to the SDK, such as ComputeThreads, IOThreads or
+/// PipelinedModfileUpload, so the same scenario can be compared across configurations.
+
+namespace
+{
+	/// @brief Any 32 character key is accepted by the mock server
+	constexpr const char* MockApiKey = "00000000000000000000000000000000";
+
+	/// @brief Longest a single SDK operation or scenario step may take before the run is abandoned
+	constexpr std::chrono::minutes StepTimeout {30};
+
+	struct ScenarioOptions
+	{
+		std::string Server {};
+		std::filesystem::path WorkDirectory = "/tmp/modio-scenario-benchmarks";
+		Modio::GameID GameID = Modio::GameID(1);
+		std::int64_t NumMods = 100;
+		std::size_t PageSize = 100;
+		std::uint64_t UploadMegabytes = 2048;
+		std::map<std::string, std::string> ExtendedParameters {};
+		const char* Filter = nullptr;
+	};
+
+	/// @brief Process-wide counters sampled before and after each scenario
+	struct ResourceSample
+	{
+		std::chrono::steady_clock::time_point Wall {};
+		double CpuSeconds = 0;
+		std::uint64_t DiskBytesRead = 0;
+		std::uint64_t DiskBytesWritten = 0;
+		std::uint64_t SDKBytesRead = 0;
+		std::uint64_t SDKBytesWritten = 0;
+	};
+
+	/// @brief Reads a "name: value" line from a /proc file, returning 0 if the file or field is unavailable
+	std::uint64_t ReadProcField(const char* Path, const char* Field)
+	{
+		std::ifstream File(Path);
+		std::string Line;
+		const std::size_t FieldLength = std::strlen(Field);
+		while (std::getline(File, Line))
+		{
+			if (Line.compare(0, FieldLength, Field) == 0 && Line.size() > FieldLength && Line[FieldLength] == ':')
+			{
+				return std::strtoull(Line.c_str() + FieldLength + 1, nullptr, 10);
+			}
+		}
+		return 0;
+	}
+
+	ResourceSample TakeSample()
+	{
+		ResourceSample Sample;
+		Sample.Wall = std::chrono::steady_clock::now();
+
+		rusage Usage {};
+		getrusage(RUSAGE_SELF, &Usage);
+		Sample.CpuSeconds = double(Usage.ru_utime.tv_sec + Usage.ru_stime.tv_sec) +
+							double(Usage.ru_utime.tv_usec + Usage.ru_stime.tv_usec) / 1e6;
+
+		// Bytes that reached the storage layer, including those written to the page cache, for every thread
+		Sample.DiskBytesRead = ReadProcField("/proc/self/io", "read_bytes");
+		Sample.DiskBytesWritten = ReadProcField("/proc/self/io", "write_bytes");
+
+		Modio::RuntimeStats Stats = Modio::QueryRuntimeStats();
+		Sample.SDKBytesRead = Stats.FileBytesRead;
+		Sample.SDKBytesWritten = Stats.FileBytesWritten;
+		return Sample;
+	}
+
+	/// @brief Resets the peak resident set size, so the peak reported for a scenario is its own
+	void ResetPeakRSS()
+	{
+		std::ofstream ClearRefs("/proc/self/clear_refs");
+		ClearRefs << "5";
+	}
+
+	std::uint64_t ReadPeakRSSKiB()
+	{
+		if (std::uint64_t PeakKiB = ReadProcField("/proc/self/status", "VmHWM"))
+		{
+			return PeakKiB;
+		}
+		// Without /proc the peak covers the whole process rather than just the scenario
+		rusage Usage {};
+		getrusage(RUSAGE_SELF, &Usage);
+		return static_cast<std::uint64_t>(Usage.ru_maxrss);
+	}
+
+	void ReportScenario(const char* Name, const ResourceSample& Before, const ResourceSample& After)
+	{
+		constexpr double MiB = 1024.0 * 1024.0;
+		std::printf("%-20s wall_s=%.3f cpu_s=%.3f peak_rss_mib=%.1f disk_read_mib=%.1f disk_written_mib=%.1f "
+					"sdk_read_mib=%.1f sdk_written_mib=%.1f\n",
+					Name, std::chrono::duration<double>(After.Wall - Before.Wall).count(),
+					After.CpuSeconds - Before.CpuSeconds, double(ReadPeakRSSKiB()) / 1024.0,
+					double(After.DiskBytesRead - Before.DiskBytesRead) / MiB,
+					double(After.DiskBytesWritten - Before.DiskBytesWritten) / MiB,
+					double(After.SDKBytesRead - Before.SDKBytesRead) / MiB,
+					double(After.SDKBytesWritten - Before.SDKBytesWritten) / MiB);
+		std::fflush(stdout);
+	}
+
+	/// @brief Starts an SDK operation and blocks until its callback is invoked. Runs are abandoned if the SDK never
+	/// calls back, as a hung benchmark in CI is worse than a failed one
+	Modio::ErrorCode WaitForCallback(const char* Step,
+									 const std::function<void(std::function<void(Modio::ErrorCode)>)>& Start)
+	{
+		std::shared_ptr<std::promise<Modio::ErrorCode>> Done = std::make_shared<std::promise<Modio::ErrorCode>>();
+		std::future<Modio::ErrorCode> Result = Done->get_future();
+		Start([Done](Modio::ErrorCode ec) { Done->set_value(ec); });
+		if (Result.wait_for(StepTimeout) != std::future_status::ready)
+		{
+			std::fprintf(stderr, "%s timed out\n", Step);
+			std::exit(EXIT_FAILURE);
+		}
+
+		Modio::ErrorCode ec = Result.get();
+		if (ec)
+		{
+			std::fprintf(stderr, "%s failed: %s\n", Step, ec.message().c_str());
+		}
+		return ec;
+	}
+
+	/// @brief Counts the mod management events the scenarios wait for
+	class ManagementEvents
+	{
+		std::mutex Mutex;
+		std::condition_variable Changed;
+		std::int64_t NumInstalled = 0;
+		std::int64_t NumFailed = 0;
+		Modio::Optional<Modio::ErrorCode> UploadResult {};
+
+	public:
+		void Reset()
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			NumInstalled = 0;
+			NumFailed = 0;
+			UploadResult.reset();
+		}
+
+		void OnEvent(const Modio::ModManagementEvent& Event)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (Event.Event == Modio::ModManagementEvent::EventType::Installed)
+			{
+				if (Event.Status)
+				{
+					std::fprintf(stderr, "Installing mod %lld failed: %s\n", static_cast<long long>(Event.ID),
+								 Event.Status.message().c_str());
+					++NumFailed;
+				}
+				else
+				{
+					++NumInstalled;
+				}
+			}
+			else if (Event.Event == Modio::ModManagementEvent::EventType::Uploaded)
+			{
+				UploadResult = Event.Status;
+			}
+			Changed.notify_all();
+		}
+
+		void OnSubscribeFailed()
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			++NumFailed;
+			Changed.notify_all();
+		}
+
+		/// @return The number of mods that were installed, once every one of NumMods was either installed or failed
+		std::int64_t WaitForInstalls(std::int64_t NumMods)
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			if (!Changed.wait_for(Lock, StepTimeout, [&]() { return NumInstalled + NumFailed >= NumMods; }))
+			{
+				std::fprintf(stderr, "Waiting for installs timed out with %lld of %lld installed\n",
+							 static_cast<long long>(NumInstalled), static_cast<long long>(NumMods));
+				std::exit(EXIT_FAILURE);
+			}
+			return NumInstalled;
+		}
+
+		Modio::ErrorCode WaitForUpload()
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			if (!Changed.wait_for(Lock, StepTimeout, [&]() { return UploadResult.has_value(); }))
+			{
+				std::fprintf(stderr, "Waiting for the upload timed out\n");
+				std::exit(EXIT_FAILURE);
+			}
+			return *UploadResult;
+		}
+	};
+
+	ManagementEvents Events;
+
+	bool InitializeSDK(const ScenarioOptions& Options)
+	{
+		Modio::InitializeOptions InitOptions(Options.GameID, Modio::ApiKey(MockApiKey), Modio::Environment::Test,
+											 Modio::Portal::None, "ScenarioBenchmarks");
+		InitOptions.ExtendedParameters = Options.ExtendedParameters;
+		InitOptions.ExtendedParameters["EnvironmentOverrideUrl"] = Options.Server;
+		return !WaitForCallback("InitializeAsync", [&](std::function<void(Modio::ErrorCode)> Callback) {
+			Modio::InitializeAsync(InitOptions, std::move(Callback));
+		});
+	}
+
+	void ShutdownSDK()
+	{
+		Modio::DisableModManagement();
+		WaitForCallback("ShutdownAsync", [](std::function<void(Modio::ErrorCode)> Callback) {
+			Modio::ShutdownAsync(std::move(Callback));
+		});
+	}
+
+	/// @brief Authenticates the user if the work directory does not already hold a session. The mock server accepts
+	/// any security code
+	bool EnsureAuthenticated()
+	{
+		if (Modio::QueryUserProfile().has_value())
+		{
+			return true;
+		}
+		return !WaitForCallback("AuthenticateUserEmailAsync", [](std::function<void(Modio::ErrorCode)> Callback) {
+			Modio::AuthenticateUserEmailAsync(Modio::EmailAuthCode("00000"), std::move(Callback));
+		});
+	}
+
+	bool EnableModManagement()
+	{
+		Events.Reset();
+		if (Modio::ErrorCode ec =
+				Modio::EnableModManagement([](Modio::ModManagementEvent Event) { Events.OnEvent(Event); }))
+		{
+			std::fprintf(stderr, "EnableModManagement failed: %s\n", ec.message().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	bool RunSubscribeInstall(const ScenarioOptions& Options)
+	{
+		// Starts from a first run, with nothing installed and no session
+		std::error_code ec;
+		std::filesystem::remove_all(Options.WorkDirectory / "home", ec);
+
+		if (!InitializeSDK(Options) || !EnsureAuthenticated() || !EnableModManagement())
+		{
+			return false;
+		}
+
+		ResetPeakRSS();
+		ResourceSample Before = TakeSample();
+		for (std::int64_t Index = 1; Index <= Options.NumMods; ++Index)
+		{
+			Modio::SubscribeToModAsync(Modio::ModID(Index), false, [Index](Modio::ErrorCode ec) {
+				if (ec)
+				{
+					std::fprintf(stderr, "Subscribing to mod %lld failed: %s\n", static_cast<long long>(Index),
+								 ec.message().c_str());
+					Events.OnSubscribeFailed();
+				}
+			});
+		}
+		std::int64_t NumInstalled = Events.WaitForInstalls(Options.NumMods);
+		ResourceSample After = TakeSample();
+		ReportScenario("subscribe-install", Before, After);
+
+		ShutdownSDK();
+		return NumInstalled == Options.NumMods;
+	}
+
+	bool RunColdStart(const ScenarioOptions& Options)
+	{
+		ResetPeakRSS();
+		ResourceSample Before = TakeSample();
+		if (!InitializeSDK(Options))
+		{
+			return false;
+		}
+		ResourceSample After = TakeSample();
+		ReportScenario("cold-start", Before, After);
+
+		std::size_t NumInstalled = Modio::QueryUserInstallations(true).size();
+		if (NumInstalled == 0)
+		{
+			std::fprintf(stderr, "cold-start found no installed mods, run subscribe-install first\n");
+		}
+		ShutdownSDK();
+		return NumInstalled > 0;
+	}
+
+	bool RunValidateInstalls(const ScenarioOptions& Options)
+	{
+		if (!InitializeSDK(Options))
+		{
+			return false;
+		}
+
+		ResetPeakRSS();
+		ResourceSample Before = TakeSample();
+		std::map<Modio::ModID, Modio::ModCollectionEntry> Installations = Modio::QueryUserInstallations(true);
+		std::vector<char> ReadBuffer(1024 * 1024);
+		std::size_t NumInvalid = 0;
+		for (const auto& Installation : Installations)
+		{
+			std::uint64_t BytesOnDisk = 0;
+			std::error_code ec;
+			for (std::filesystem::recursive_directory_iterator It(Installation.second.GetPath(), ec), End;
+				 !ec && It != End; It.increment(ec))
+			{
+				if (!It->is_regular_file(ec))
+				{
+					continue;
+				}
+				std::ifstream File(It->path(), std::ios::binary);
+				while (File.read(ReadBuffer.data(), std::streamsize(ReadBuffer.size())) || File.gcount() > 0)
+				{
+					BytesOnDisk += static_cast<std::uint64_t>(File.gcount());
+				}
+			}
+
+			const Modio::Optional<Modio::FileMetadata>& FileInfo = Installation.second.GetModProfile().FileInfo;
+			if (ec || !FileInfo.has_value() || FileInfo->FilesizeUncompressed != BytesOnDisk)
+			{
+				std::fprintf(stderr, "Mod %lld at %s has %llu bytes installed, expected %llu\n",
+							 static_cast<long long>(Installation.first), Installation.second.GetPath().c_str(),
+							 static_cast<unsigned long long>(BytesOnDisk),
+							 static_cast<unsigned long long>(FileInfo.has_value() ? FileInfo->FilesizeUncompressed
+																				  : 0));
+				++NumInvalid;
+			}
+		}
+		ResourceSample After = TakeSample();
+		ReportScenario("validate-installs", Before, After);
+
+		ShutdownSDK();
+		return !Installations.empty() && NumInvalid == 0;
+	}
+
+	bool RunListAllMods(const ScenarioOptions& Options)
+	{
+		if (!InitializeSDK(Options))
+		{
+			return false;
+		}
+
+		ResetPeakRSS();
+		ResourceSample Before = TakeSample();
+		std::size_t NumListed = 0;
+		std::size_t NumTotal = 0;
+		bool bSucceeded = true;
+		do
+		{
+			std::size_t PageSize = 0;
+			Modio::FilterParams Filter;
+			Filter.IndexedResults(NumListed, Options.PageSize);
+			bSucceeded = !WaitForCallback("ListAllModsAsync", [&](std::function<void(Modio::ErrorCode)> Callback) {
+				Modio::ListAllModsAsync(Filter, [&, Callback = std::move(Callback)](
+													Modio::ErrorCode ec, Modio::Optional<Modio::ModInfoList> Mods) {
+					if (Mods.has_value())
+					{
+						PageSize = Mods->Size();
+						NumTotal = static_cast<std::size_t>(Mods->GetTotalResultCount());
+					}
+					Callback(ec);
+				});
+			});
+			NumListed += PageSize;
+			if (PageSize == 0)
+			{
+				break;
+			}
+		} while (bSucceeded && NumListed < NumTotal);
+		ResourceSample After = TakeSample();
+		ReportScenario("list-all-mods", Before, After);
+
+		ShutdownSDK();
+		return bSucceeded && NumListed == NumTotal && NumTotal > 0;
+	}
+
+	/// @brief Fills the upload folder with files whose blocks alternate between random and repetitive data, so the
+	/// archive compresses to roughly half its size. An existing folder of the right size is reused
+	bool PrepareUploadFolder(const std::filesystem::path& Folder, std::uint64_t TotalBytes)
+	{
+		constexpr std::uint64_t FileSize = 64 * 1024 * 1024;
+		constexpr std::size_t BlockSize = 4096;
+
+		std::error_code ec;
+		std::uint64_t ExistingBytes = 0;
+		for (std::filesystem::recursive_directory_iterator It(Folder, ec), End; !ec && It != End; It.increment(ec))
+		{
+			ExistingBytes += It->is_regular_file(ec) ? It->file_size(ec) : 0;
+		}
+		if (ExistingBytes == TotalBytes)
+		{
+			return true;
+		}
+
+		std::filesystem::remove_all(Folder, ec);
+		std::filesystem::create_directories(Folder, ec);
+		if (ec)
+		{
+			std::fprintf(stderr, "Could not create %s: %s\n", Folder.c_str(), ec.message().c_str());
+			return false;
+		}
+
+		std::vector<char> Block(BlockSize);
+		std::uint64_t State = 0x9E3779B97F4A7C15ull;
+		std::uint64_t Written = 0;
+		for (std::size_t FileIndex = 0; Written < TotalBytes; ++FileIndex)
+		{
+			std::ofstream File(Folder / ("data_" + std::to_string(FileIndex) + ".bin"), std::ios::binary);
+			std::uint64_t FileBytes = std::min(FileSize, TotalBytes - Written);
+			for (std::uint64_t Offset = 0; Offset < FileBytes; Offset += BlockSize)
+			{
+				const bool bRandomBlock = (Offset / BlockSize) % 2 == 0;
+				for (std::size_t Index = 0; Index < BlockSize; Index += sizeof(State))
+				{
+					// xorshift64, for data deflate cannot shrink
+					State ^= State << 13;
+					State ^= State >> 7;
+					State ^= State << 17;
+					std::uint64_t Value = bRandomBlock ? State : 0x2E65746164206F6Dull;
+					std::memcpy(Block.data() + Index, &Value, sizeof(Value));
+				}
+				File.write(Block.data(), std::streamsize(std::min<std::uint64_t>(BlockSize, FileBytes - Offset)));
+			}
+			Written += FileBytes;
+			if (!File)
+			{
+				std::fprintf(stderr, "Could not write the upload folder in %s\n", Folder.c_str());
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool RunUploadFolder(const ScenarioOptions& Options)
+	{
+		const std::filesystem::path Folder = Options.WorkDirectory / "upload";
+		if (!PrepareUploadFolder(Folder, Options.UploadMegabytes * 1024 * 1024))
+		{
+			return false;
+		}
+		if (!InitializeSDK(Options) || !EnsureAuthenticated() || !EnableModManagement())
+		{
+			return false;
+		}
+
+		ResetPeakRSS();
+		ResourceSample Before = TakeSample();
+		Modio::CreateModFileParams Params;
+		Params.RootDirectory = Folder.string();
+		Params.Version = "1.0.0";
+		Modio::SubmitNewModFileForMod(Modio::ModID(1), Params);
+		Modio::ErrorCode ec = Events.WaitForUpload();
+		ResourceSample After = TakeSample();
+		ReportScenario("upload-folder", Before, After);
+		if (ec)
+		{
+			std::fprintf(stderr, "Upload failed: %s\n", ec.message().c_str());
+		}
+
+		ShutdownSDK();
+		return !ec;
+	}
+
+	bool ParseArguments(int argc, char** argv, ScenarioOptions& Options)
+	{
+		for (int Index = 1; Index < argc; ++Index)
+		{
+			std::string Argument = argv[Index];
+			const bool bHasValue = Index + 1 < argc;
+			if (Argument == "--server" && bHasValue)
+			{
+				Options.Server = argv[++Index];
+			}
+			else if (Argument == "--work-dir" && bHasValue)
+			{
+				Options.WorkDirectory = argv[++Index];
+			}
+			else if (Argument == "--game-id" && bHasValue)
+			{
+				Options.GameID = Modio::GameID(std::strtoll(argv[++Index], nullptr, 10));
+			}
+			else if (Argument == "--mods" && bHasValue)
+			{
+				Options.NumMods = std::strtoll(argv[++Index], nullptr, 10);
+			}
+			else if (Argument == "--page-size" && bHasValue)
+			{
+				Options.PageSize = std::strtoull(argv[++Index], nullptr, 10);
+			}
+			else if (Argument == "--upload-mb" && bHasValue)
+			{
+				Options.UploadMegabytes = std::strtoull(argv[++Index], nullptr, 10);
+			}
+			else if (Argument == "--param" && bHasValue)
+			{
+				std::string Parameter = argv[++Index];
+				std::size_t Separator = Parameter.find('=');
+				if (Separator == std::string::npos)
+				{
+					return false;
+				}
+				Options.ExtendedParameters[Parameter.substr(0, Separator)] = Parameter.substr(Separator + 1);
+			}
+			else if (Argument.compare(0, 2, "--") != 0 && Options.Filter == nullptr)
+			{
+				Options.Filter = argv[Index];
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return !Options.Server.empty() && Options.NumMods > 0 && Options.PageSize > 0 &&
+			   Options.UploadMegabytes > 0;
+	}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	ScenarioOptions Options;
+	if (!ParseArguments(argc, argv, Options))
+	{
+		std::fprintf(stderr, "Usage: %s --server HOST [--work-dir DIR] [--game-id ID] [--mods N] [--page-size N] "
+							 "[--upload-mb N] [--param Key=Value]... [Filter]\n",
+					 argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	// The SDK keeps its user data and installed mods under $HOME on Linux, so pointing it into the work directory
+	// keeps runs isolated from each other and from the machine's own mod.io data
+	std::filesystem::create_directories(Options.WorkDirectory / "home");
+	setenv("HOME", (Options.WorkDirectory / "home").c_str(), 1);
+
+	Modio::SetLogLevel(Modio::LogLevel::Warning);
+
+	// Pumps the SDK the way a game's main loop would
+	std::atomic<bool> bHaltHandlerThread {false};
+	std::thread HandlerThread([&]() {
+		while (!bHaltHandlerThread)
+		{
+			Modio::RunPendingHandlers();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	});
+
+	struct Scenario
+	{
+		const char* Name;
+		bool (*Run)(const ScenarioOptions&);
+	};
+	const Scenario Scenarios[] = {{"subscribe-install", RunSubscribeInstall},
+								  {"cold-start", RunColdStart},
+								  {"validate-installs", RunValidateInstalls},
+								  {"list-all-mods", RunListAllMods},
+								  {"upload-folder", RunUploadFolder}};
+
+	int Result = EXIT_SUCCESS;
+	for (const Scenario& Current : Scenarios)
+	{
+		if (Options.Filter != nullptr && std::strstr(Current.Name, Options.Filter) == nullptr)
+		{
+			continue;
+		}
+		if (!Current.Run(Options))
+		{
+			std::fprintf(stderr, "Scenario %s failed\n", Current.Name);
+			Result = EXIT_FAILURE;
+		}
+	}
+
+	bHaltHandlerThread = true;
+	HandlerThread.join();
+	return Result;
+}
@@ -0,0 +1,448 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+#
+#  This file is part of the mod.io SDK.
+#
+#  Distributed under the MIT License. (See accompanying file LICENSE or
+#   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+#
+
+"""Local HTTPS stand-in for the mod.io REST API and CDN, used by modio_ScenarioBenchmarks.
+
+Serves the endpoints the benchmark scenarios reach, built from the recorded responses in
+recorded_responses.json, and a synthetic zip modfile for each mod. Every mod's archive is generated once, before the
+server starts listening, and kept in the cache directory so later runs start straight away.
+
+The SDK always connects to port 443 and only trusts certificates in the system CA bundle, and it rejects download
+URLs on localhost or bare IP addresses. So the host name passed with --host has to resolve to this machine (for
+example through /etc/hosts) and the certificate has to be trusted. --generate-cert writes a self-signed certificate
+for --host that can be appended to /etc/ssl/certs/ca-certificates.crt. See the "Measuring performance against a local
+server" section of doc/getting-started/cpp-installation.mdx.
+
+Standard library only, so it runs on any CI image with Python 3.8 or later and the openssl command line tool.
+"""
+
+import argparse
+import copy
+import hashlib
+import http.server
+import json
+import os
+import random
+import re
+import shutil
+import signal
+import socketserver
+import ssl
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import urllib.parse
+import uuid
+import zipfile
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Blocks of repetitive text alternate with blocks of random bytes in each file, so archives deflate to roughly half
+# their size and extraction spends time in both stored-like and well-compressed stretches of data
+SYNTHETIC_BLOCK_SIZE = 4096
+SYNTHETIC_TEXT = (b"The quick brown fox jumps over the lazy dog. mod.io benchmark data 0123456789\n" * 64)[
+    :SYNTHETIC_BLOCK_SIZE]
+ARCHIVE_TIMESTAMP = (2024, 1, 1, 0, 0, 0)
+
+
+class Modfile:
+    def __init__(self, path, size, uncompressed_size, md5):
+        self.path = path
+        self.size = size
+        self.uncompressed_size = uncompressed_size
+        self.md5 = md5
+
+
+class MockState:
+    """Mods, their archives, and the server-side state the scenarios change (subscriptions and upload sessions)"""
+
+    def __init__(self, args):
+        with open(os.path.join(SCRIPT_DIR, "recorded_responses.json"), "r", encoding="utf-8") as recorded:
+            self.recorded = json.loads(recorded.read().replace("{host}", args.host))
+        self.host = args.host
+        self.game_id = args.game_id
+        self.num_mods = args.mods
+        self.files_per_mod = args.files_per_mod
+        self.file_size = args.file_size
+        self.cache_dir = args.cache_dir
+        self.modfiles = {}
+        self.lock = threading.Lock()
+        self.subscriptions = set()
+        self.upload_sessions = {}
+        self.bytes_uploaded = 0
+        self.bytes_downloaded = 0
+
+    def generate_modfiles(self):
+        os.makedirs(self.cache_dir, exist_ok=True)
+        started = time.monotonic()
+        for mod_id in range(1, self.num_mods + 1):
+            self.modfiles[mod_id] = self._load_or_generate_modfile(mod_id)
+        print("Prepared {} modfiles in {:.1f}s".format(self.num_mods, time.monotonic() - started), flush=True)
+
+    def _load_or_generate_modfile(self, mod_id):
+        # The parameters are part of the name, so changing them never reuses an archive with different contents
+        path = os.path.join(self.cache_dir, "mod_{}_{}x{}.zip".format(mod_id, self.files_per_mod, self.file_size))
+        if not os.path.exists(path):
+            generator = random.Random(mod_id)
+            partial_path = path + ".partial"
+            with zipfile.ZipFile(partial_path, "w", compression=zipfile.ZIP_DEFLATED, compresslevel=6) as archive:
+                # Entries get a fixed timestamp so regenerating an archive reproduces the same bytes
+                archive.writestr(zipfile.ZipInfo("modinfo.txt", ARCHIVE_TIMESTAMP), "mod {}\n".format(mod_id),
+                                 zipfile.ZIP_DEFLATED)
+                for file_index in range(self.files_per_mod):
+                    archive.writestr(zipfile.ZipInfo("data/file_{:03}.bin".format(file_index), ARCHIVE_TIMESTAMP),
+                                     self._synthetic_data(generator), zipfile.ZIP_DEFLATED)
+            os.replace(partial_path, path)
+
+        md5 = hashlib.md5()
+        with open(path, "rb") as archive_file:
+            for chunk in iter(lambda: archive_file.read(1024 * 1024), b""):
+                md5.update(chunk)
+        with zipfile.ZipFile(path, "r") as archive:
+            uncompressed_size = sum(entry.file_size for entry in archive.infolist())
+        return Modfile(path, os.path.getsize(path), uncompressed_size, md5.hexdigest())
+
+    def _synthetic_data(self, generator):
+        data = bytearray()
+        block_index = 0
+        while len(data) < self.file_size:
+            if block_index % 2 == 0:
+                data += generator.getrandbits(SYNTHETIC_BLOCK_SIZE * 8).to_bytes(SYNTHETIC_BLOCK_SIZE, "little")
+            else:
+                data += SYNTHETIC_TEXT
+            block_index += 1
+        return bytes(data[:self.file_size])
+
+    def modfile_json(self, mod_id, modfile_id=None):
+        modfile = self.modfiles[mod_id]
+        result = copy.deepcopy(self.recorded["modfile"])
+        result["id"] = modfile_id if modfile_id is not None else mod_id
+        result["mod_id"] = mod_id
+        result["filesize"] = modfile.size
+        result["filesize_uncompressed"] = modfile.uncompressed_size
+        result["filehash"]["md5"] = modfile.md5
+        result["filename"] = os.path.basename(modfile.path)
+        result["download"]["binary_url"] = "https://{}/files/{}/{}".format(self.host, mod_id, result["filename"])
+        return result
+
+    def mod_json(self, mod_id):
+        result = copy.deepcopy(self.recorded["mod"])
+        result["id"] = mod_id
+        result["game_id"] = self.game_id
+        result["name"] = "Benchmark Mod {}".format(mod_id)
+        result["name_id"] = "benchmark-mod-{}".format(mod_id)
+        result["profile_url"] += result["name_id"]
+        result["stats"]["mod_id"] = mod_id
+        result["modfile"] = self.modfile_json(mod_id)
+        for platform in result["platforms"]:
+            platform["modfile_live"] = mod_id
+        return result
+
+    def paged(self, items, offset, limit, total):
+        return {"data": items, "result_count": len(items), "result_offset": offset, "result_limit": limit,
+                "result_total": total}
+
+
+class MockRequestHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    server_version = "modio-mock/1.0"
+
+    # Routes are matched against the path without the /v1 prefix or query string
+    ROUTES = [
+        ("POST", re.compile(r"^/oauth/emailrequest$"), "email_request"),
+        ("POST", re.compile(r"^/oauth/emailexchange$"), "email_exchange"),
+        ("GET", re.compile(r"^/me$"), "get_user"),
+        ("GET", re.compile(r"^/me/subscribed$"), "get_subscriptions"),
+        ("GET", re.compile(r"^/me/(events|ratings|users/muted|purchased)$"), "empty_list"),
+        ("GET", re.compile(r"^/games/(\d+)/mods$"), "list_mods"),
+        ("GET", re.compile(r"^/games/(\d+)/mods/events$"), "empty_list"),
+        ("GET", re.compile(r"^/games/(\d+)/mods/(\d+)$"), "get_mod"),
+        ("POST", re.compile(r"^/games/(\d+)/mods/(\d+)/subscribe$"), "subscribe"),
+        ("DELETE", re.compile(r"^/games/(\d+)/mods/(\d+)/subscribe$"), "unsubscribe"),
+        ("GET", re.compile(r"^/games/(\d+)/mods/(\d+)/dependencies$"), "empty_list"),
+        ("POST", re.compile(r"^/games/(\d+)/mods/(\d+)/files$"), "add_modfile"),
+        ("POST", re.compile(r"^/games/(\d+)/mods/(\d+)/files/multipart$"), "create_upload_session"),
+        ("PUT", re.compile(r"^/games/(\d+)/mods/(\d+)/files/multipart$"), "add_upload_part"),
+        ("GET", re.compile(r"^/games/(\d+)/mods/(\d+)/files/multipart$"), "empty_list"),
+        ("GET", re.compile(r"^/games/(\d+)/mods/(\d+)/files/multipart/sessions$"), "empty_list"),
+        ("POST", re.compile(r"^/games/(\d+)/mods/(\d+)/files/multipart/complete$"), "complete_upload_session"),
+    ]
+
+    @property
+    def state(self):
+        return self.server.state
+
+    def setup(self):
+        # The listening socket does not handshake on accept, so a slow client never holds up the accepting thread
+        self.request.do_handshake()
+        super().setup()
+
+    def log_message(self, format, *args):
+        if self.server.verbose:
+            super().log_message(format, *args)
+
+    def do_GET(self):
+        self.dispatch("GET")
+
+    def do_POST(self):
+        self.dispatch("POST")
+
+    def do_PUT(self):
+        self.dispatch("PUT")
+
+    def do_DELETE(self):
+        self.dispatch("DELETE")
+
+    def dispatch(self, verb):
+        url = urllib.parse.urlsplit(self.path)
+        self.query = urllib.parse.parse_qs(url.query)
+        path = url.path
+
+        if verb == "GET" and path.startswith("/files/"):
+            self.discard_body()
+            self.send_modfile(path)
+            return
+
+        self.body_size = self.discard_body()
+        if path.startswith("/v1"):
+            path = path[len("/v1"):]
+        for route_verb, pattern, handler in self.ROUTES:
+            match = pattern.match(path)
+            if route_verb == verb and match:
+                getattr(self, handler)(*match.groups())
+                return
+        self.send_json(404, self.state.recorded["not_found"])
+
+    def discard_body(self):
+        # Request bodies are only counted. Uploaded archives are never stored, so uploading does not compete with
+        # the SDK for the disk
+        remaining = int(self.headers.get("Content-Length", 0))
+        total = remaining
+        while remaining > 0:
+            chunk = self.rfile.read(min(remaining, 1024 * 1024))
+            if not chunk:
+                break
+            remaining -= len(chunk)
+        return total
+
+    def send_json(self, code, body):
+        payload = json.dumps(body).encode("utf-8")
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(payload)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(payload)
+        self.close_connection = True
+
+    def send_modfile(self, path):
+        parts = path.split("/")
+        mod_id = int(parts[2]) if len(parts) > 2 and parts[2].isdigit() else 0
+        modfile = self.state.modfiles.get(mod_id)
+        if modfile is None:
+            self.send_json(404, self.state.recorded["not_found"])
+            return
+
+        # Partially downloaded modfiles are resumed with a range request
+        start = 0
+        range_header = self.headers.get("Range")
+        range_match = re.match(r"^bytes=(\d+)-$", range_header or "")
+        if range_match:
+            start = min(int(range_match.group(1)), modfile.size)
+
+        self.send_response(206 if range_match else 200)
+        self.send_header("Content-Type", "application/zip")
+        self.send_header("Content-Length", str(modfile.size - start))
+        if range_match:
+            self.send_header("Content-Range", "bytes {}-{}/{}".format(start, modfile.size - 1, modfile.size))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        with open(modfile.path, "rb") as archive_file:
+            archive_file.seek(start)
+            shutil.copyfileobj(archive_file, self.wfile, 1024 * 1024)
+        with self.state.lock:
+            self.state.bytes_downloaded += modfile.size - start
+        self.close_connection = True
+
+    def email_request(self):
+        self.send_json(200, self.state.recorded["email_request"])
+
+    def email_exchange(self):
+        self.send_json(200, self.state.recorded["access_token"])
+
+    def get_user(self):
+        self.send_json(200, self.state.recorded["user"])
+
+    def empty_list(self, *unused):
+        self.send_json(200, self.state.paged([], 0, 100, 0))
+
+    def page_params(self):
+        offset = int(self.query.get("_offset", ["0"])[0])
+        limit = int(self.query.get("_limit", ["100"])[0])
+        return offset, limit
+
+    def get_subscriptions(self):
+        offset, limit = self.page_params()
+        with self.state.lock:
+            subscribed = sorted(self.state.subscriptions)
+        page = subscribed[offset:offset + limit]
+        self.send_json(200, self.state.paged([self.state.mod_json(mod_id) for mod_id in page], offset, limit,
+                                             len(subscribed)))
+
+    def list_mods(self, game_id):
+        offset, limit = self.page_params()
+        mod_ids = range(offset + 1, min(offset + limit, self.state.num_mods) + 1)
+        self.send_json(200, self.state.paged([self.state.mod_json(mod_id) for mod_id in mod_ids], offset, limit,
+                                             self.state.num_mods))
+
+    def known_mod(self, mod_id):
+        if int(mod_id) not in self.state.modfiles:
+            self.send_json(404, self.state.recorded["not_found"])
+            return False
+        return True
+
+    def get_mod(self, game_id, mod_id):
+        if self.known_mod(mod_id):
+            self.send_json(200, self.state.mod_json(int(mod_id)))
+
+    def subscribe(self, game_id, mod_id):
+        if self.known_mod(mod_id):
+            with self.state.lock:
+                self.state.subscriptions.add(int(mod_id))
+            self.send_json(201, self.state.mod_json(int(mod_id)))
+
+    def unsubscribe(self, game_id, mod_id):
+        with self.state.lock:
+            self.state.subscriptions.discard(int(mod_id))
+        self.send_response(204)
+        self.send_header("Content-Length", "0")
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.close_connection = True
+
+    def add_modfile(self, game_id, mod_id):
+        if self.known_mod(mod_id):
+            with self.state.lock:
+                self.state.bytes_uploaded += self.body_size
+            self.send_json(201, self.state.modfile_json(int(mod_id), modfile_id=int(time.time())))
+
+    def create_upload_session(self, game_id, mod_id):
+        session = copy.deepcopy(self.state.recorded["upload_session"])
+        session["upload_id"] = str(uuid.uuid4())
+        with self.state.lock:
+            self.state.upload_sessions[session["upload_id"]] = 0
+        self.send_json(200, session)
+
+    def add_upload_part(self, game_id, mod_id):
+        upload_id = self.query.get("upload_id", [""])[0]
+        with self.state.lock:
+            if upload_id not in self.state.upload_sessions:
+                upload_id = None
+            else:
+                self.state.upload_sessions[upload_id] += 1
+                part_number = self.state.upload_sessions[upload_id]
+                self.state.bytes_uploaded += self.body_size
+        if upload_id is None:
+            self.send_json(404, self.state.recorded["not_found"])
+            return
+        part = copy.deepcopy(self.state.recorded["upload_part"])
+        part["upload_id"] = upload_id
+        part["part_number"] = part_number
+        part["part_size"] = self.body_size
+        self.send_json(200, part)
+
+    def complete_upload_session(self, game_id, mod_id):
+        session = copy.deepcopy(self.state.recorded["upload_session"])
+        session["upload_id"] = self.query.get("upload_id", [""])[0]
+        session["status"] = 1
+        self.send_json(200, session)
+
+
+class MockServer(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    daemon_threads = True
+    request_queue_size = 128
+
+
+def generate_certificate(host, directory):
+    os.makedirs(directory, exist_ok=True)
+    cert_path = os.path.join(directory, "mock_modio_server.crt")
+    key_path = os.path.join(directory, "mock_modio_server.key")
+    # Self-signed and marked as a CA, so the certificate itself can be added to the trusted bundle
+    subprocess.run(["openssl", "req", "-x509", "-newkey", "rsa:2048", "-sha256", "-days", "365", "-nodes",
+                    "-keyout", key_path, "-out", cert_path, "-subj", "/CN={}".format(host),
+                    "-addext", "subjectAltName=DNS:{}".format(host),
+                    "-addext", "basicConstraints=critical,CA:TRUE"], check=True, capture_output=True)
+    return cert_path, key_path
+
+
+def raise_keyboard_interrupt(signum, frame):
+    raise KeyboardInterrupt()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", required=True,
+                        help="Host name the SDK connects to, passed to it as EnvironmentOverrideUrl. Must contain a "
+                             "dot and end in a 2 to 6 letter top-level domain, such as mock.modio.test")
+    parser.add_argument("--bind", default="0.0.0.0", help="Address to listen on")
+    parser.add_argument("--port", type=int, default=443, help="Port to listen on. The SDK only connects to 443")
+    parser.add_argument("--cert", help="PEM certificate for --host")
+    parser.add_argument("--key", help="PEM private key for --cert")
+    parser.add_argument("--generate-cert", metavar="DIR",
+                        help="Generate a self-signed certificate for --host in DIR, print its path and exit")
+    parser.add_argument("--game-id", type=int, default=1, help="Game ID the SDK is initialized with")
+    parser.add_argument("--mods", type=int, default=1000, help="Number of mods the game has")
+    parser.add_argument("--files-per-mod", type=int, default=8, help="Files in each mod's archive")
+    parser.add_argument("--file-size", type=int, default=256 * 1024, help="Size in bytes of each file in an archive")
+    parser.add_argument("--cache-dir", default=os.path.join(tempfile.gettempdir(), "modio-mock-server"),
+                        help="Directory the generated archives are kept in between runs")
+    parser.add_argument("--verbose", action="store_true", help="Log every request")
+    args = parser.parse_args()
+
+    if args.generate_cert:
+        cert_path, key_path = generate_certificate(args.host, args.generate_cert)
+        print(cert_path)
+        print(key_path)
+        return 0
+
+    if not args.cert or not args.key:
+        parser.error("--cert and --key are required unless --generate-cert is given")
+
+    state = MockState(args)
+    state.generate_modfiles()
+
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    context.load_cert_chain(args.cert, args.key)
+
+    server = MockServer((args.bind, args.port), MockRequestHandler)
+    server.socket = context.wrap_socket(server.socket, server_side=True, do_handshake_on_connect=False)
+    server.state = state
+    server.verbose = args.verbose
+
+    # CI stops the server with SIGTERM, which should still print the totals below
+    signal.signal(signal.SIGTERM, raise_keyboard_interrupt)
+
+    print("Serving {} mods for game {} as https://{}:{}".format(args.mods, args.game_id, args.host, args.port),
+          flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.server_close()
+        print("Served {} bytes of modfiles and received {} bytes of uploads".format(state.bytes_downloaded,
+                                                                                  state.bytes_uploaded), flush=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
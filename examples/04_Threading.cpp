@@ -19,6 +19,9 @@
 /// This example demonstrates calling Modio::RunPendingHandlers() on a background thread. This can improve performance
 /// by decoupling the application's main loop from the frequency with which SDK work is performed.
 ///
+/// Alternatively, setting the WorkerThread extended initialization parameter to "true" has the SDK run its work on a
+/// thread it owns, in which case the application only calls Modio::DispatchCallbacks to have its callbacks invoked.
+///
 /// The function calls used in this example are similar to those used in 02_ModQueries.
 
 /// @brief Helper method to print information from a Modio::ModInfoList to the console
@@ -1535,6 +1535,7 @@ MODIODLL_EXPORT CModioErrorCode* ModioPrioritizeTransferForMod(CModioModID* ModI
 MODIODLL_EXPORT CModioModProgressInfo* ModioQueryCurrentModUpdate();
 MODIODLL_EXPORT void ModioSetLogCallback(ModioLogCallback Callback, void* ContextPtr);
 MODIODLL_EXPORT void ModioRunPendingHandlers();
+MODIODLL_EXPORT void ModioDispatchCallbacks();
 MODIODLL_EXPORT CModioModCollectionMap* ModioQueryUserSubscriptions();
 MODIODLL_EXPORT CModioModCollectionMap* ModioQueryUserInstallations(bool bIncludeOutdatedMods);
 MODIODLL_EXPORT CModioModCollectionMap* ModioQuerySystemInstallations();
@@ -31,6 +31,7 @@
 	#include "modio/core/ModioModCollectionEntry.h"
 	#include "modio/core/ModioModDependency.h"
 	#include "modio/core/ModioReportParams.h"
+	#include "modio/core/ModioRuntimeStats.h"
 	#include "modio/core/ModioServerInitializeOptions.h"
 	#include "modio/core/entities/ModioEntitlement.h"
 	#include "modio/core/entities/ModioEntitlementConsumptionStatusList.h"
@@ -61,6 +62,8 @@ namespace Modio
 	/// @errorcategory ConfigurationError|InitOptions contains an invalid value - inspect ec.value() to determine what
 	/// was incorrect
 	/// @error GenericError::SDKAlreadyInitialized|SDK already initialized
+	/// @error GenericError::BadParameter|WorkerIdleStrategy or WorkerIdleIntervalMicroseconds extended parameter was
+	/// invalid
 	MODIOSDK_API void InitializeAsync(Modio::InitializeOptions InitOptions,
 									  std::function<void(Modio::ErrorCode)> OnInitComplete);
 
@@ -69,10 +72,22 @@ namespace Modio
 	/// @param Level Value indicating which priority of messages should be included in the log output
 	MODIOSDK_API void SetLogLevel(Modio::LogLevel Level);
 
+	/// @docpublic
+	/// @brief Sets the logging level of a single category, so that one subsystem can be logged in more or less detail
+	/// than the others. A later call to [`Modio::SetLogLevel`](#setloglevel) resets every category to its level.
+	/// Messages below the level the SDK was compiled with (MODIO_MIN_LOG_LEVEL, Detailed in release builds) are never
+	/// displayed
+	/// @param Category The category to change the level of
+	/// @param Level Value indicating which priority of messages of the category should be included in the log output
+	MODIOSDK_API void SetCategoryLogLevel(Modio::LogCategory Category, Modio::LogLevel Level);
+
 	/// @docpublic
 	/// @brief Provide a callback to handle log messages emitted by the SDK.
 	/// @param LogCallback Callback invoked by the SDK during [`Modio::RunPendingHandlers`](#runpendinghandlers) for
-	/// each log emitted during that invocation
+	/// each log emitted since the previous invocation. Messages are formatted when they are passed to the callback. If
+	/// more than 1024 messages are emitted between two invocations, the excess messages are dropped and a warning
+	/// reporting how many were dropped is passed to the callback instead. As messages are only output during
+	/// `RunPendingHandlers`, the messages emitted since its last invocation are lost if the process crashes
 	MODIOSDK_API void SetLogCallback(std::function<void(Modio::LogLevel, const std::string&)> LogCallback);
 
 	/// @docpublic
@@ -83,8 +98,29 @@ namespace Modio
 	/// functionality.
 	/// NOTE: `RunPendingHandlers` should never be called inside a callback you provide to the SDK. This will result in
 	/// a deadlock.
+	/// NOTE: If the SDK was initialized with the `WorkerThread` extended parameter, the SDK runs its work on its own
+	/// thread and this only invokes callbacks, as [`Modio::DispatchCallbacks`](#dispatchcallbacks) does.
 	MODIOSDK_API void RunPendingHandlers();
 
+	/// @docpublic
+	/// @brief Invokes, on the calling thread, the callbacks for work the SDK has completed on its own thread. Use this
+	/// in place of [`Modio::RunPendingHandlers`](#runpendinghandlers) when the SDK was initialized with the
+	/// `WorkerThread` extended parameter. It does no SDK work itself, so it is cheap to call every frame.
+	/// NOTE: Callbacks are only invoked by this function, so it must keep being called while
+	/// [`Modio::InitializeAsync`](#initializeasync) and [`Modio::ShutdownAsync`](#shutdownasync) are running. The
+	/// SDK's thread has exited by the time the callback given to `ShutdownAsync` is invoked.
+	/// NOTE: Call this from one thread only.
+	MODIOSDK_API void DispatchCallbacks();
+
+	/// @docpublic
+	/// @brief Retrieves a snapshot of the counters the SDK keeps about its own work: how long operations wait in each
+	/// of its queues, how long HTTP requests take, download and extraction throughput, cache hits and misses, file
+	/// I/O and the time spent in [`Modio::RunPendingHandlers`](#runpendinghandlers). The counters are cheap to keep
+	/// up to date and are always on, so this can be called at any time, including before the SDK is initialized,
+	/// from any thread
+	/// @return Structure containing the current value of every counter
+	MODIOSDK_API Modio::RuntimeStats QueryRuntimeStats();
+
 	/// @docpublic
 	/// @brief Cancels any running internal operations and invokes any pending callbacks with
 	/// Modio::GenericError::OperationCanceled. This function does not block; you should keep calling
@@ -250,6 +286,36 @@ namespace Modio
 	/// - Execute <<QueryUserInstallations>> and prompt the user to unsubscribe from large mods.
 	MODIOSDK_API std::map<Modio::ModID, Modio::ModCollectionEntry> QuerySystemInstallations();
 
+	/// @docpublic
+	/// @brief Visits the same mods as <<QueryUserSubscriptions>> without copying them. Intended for code that polls
+	/// the mod collection often, such as a UI refreshed every frame
+	/// @param Visitor Invoked synchronously for each subscribed mod, in order of mod ID. The entry is only valid for the
+	/// duration of the call, and the visitor must not call other SDK functions
+	MODIOSDK_API void ForEachUserSubscription(std::function<void(const Modio::ModCollectionEntry&)> Visitor);
+
+	/// @docpublic
+	/// @brief Visits the same mods as <<QueryUserInstallations>> without copying them
+	/// @param bIncludeOutdatedMods Include subscribed mods that are installed but have an updated version on the server
+	/// that has not yet been installed
+	/// @param Visitor Invoked synchronously for each installed mod, in order of mod ID. The entry is only valid for the
+	/// duration of the call, and the visitor must not call other SDK functions
+	MODIOSDK_API void ForEachUserInstallation(bool bIncludeOutdatedMods,
+											  std::function<void(const Modio::ModCollectionEntry&)> Visitor);
+
+	/// @docpublic
+	/// @brief Visits the same mods as <<QuerySystemInstallations>> without copying them
+	/// @param Visitor Invoked synchronously for each mod on the system, in order of mod ID. The entry is only valid for
+	/// the duration of the call, and the visitor must not call other SDK functions
+	MODIOSDK_API void ForEachSystemInstallation(std::function<void(const Modio::ModCollectionEntry&)> Visitor);
+
+	/// @docpublic
+	/// @brief Retrieves a number that changes whenever the results of <<QueryUserSubscriptions>>,
+	/// <<QueryUserInstallations>>, <<QuerySystemInstallations>>, <<QueryTempModSet>> or the storage consumed by mods
+	/// may have changed. A UI can compare it against the value from its last refresh and skip the queries when it is
+	/// unchanged
+	/// @return The current revision, or 0 if the SDK is not initialized
+	MODIOSDK_API std::uint64_t QueryModCollectionRevision();
+
 	/// @docpublic
 	/// @brief Retrieves a snapshot of current storage related information such as space consumed by mod
 	/// installations and total available space
@@ -434,6 +500,26 @@ namespace Modio
 		Modio::FilterParams Filter,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)> Callback);
 
+	/// @docpublic
+	/// @brief Provides a page of mods for the current game like ListAllModsAsync, then requests the pages of the
+	/// same query that follow it in the background, one at a time. A later request for one of those pages, through
+	/// this function or ListAllModsAsync, is then answered from the SDK's response cache instead of waiting for the
+	/// server. Prefetching stops at the last page of results, and stops before its next page when either function
+	/// is called with a different filter, so changing the filter never leaves stale prefetches queued ahead of the
+	/// new query. Prefetched pages stay in the cache for five minutes, longer than other cached responses, and their
+	/// requests count towards rate limiting like any other request.
+	/// @param Filter Modio::FilterParams object containing any filters that should be applied to the query
+	/// @param PrefetchPageCount Number of pages after the requested one to fetch in the background
+	/// @param Callback Callback invoked with a status code and an optional ModInfoList for the requested page
+	/// @requires initialized-sdk
+	/// @requires no-rate-limiting
+	/// @errorcategory NetworkError|Couldn't connect to mod.io servers
+	/// @error GenericError::SDKNotInitialized|SDK not initialized
+	/// @error HttpError::RateLimited|Too many frequent calls to the API. Wait some time and try again.
+	MODIOSDK_API void ListAllModsWithPrefetchAsync(
+		Modio::FilterParams Filter, std::size_t PrefetchPageCount,
+		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)> Callback);
+
 	/// @docpublic
 	/// @brief Fetches detailed information about the specified mod, including description and file metadata for the
 	/// most recent release
@@ -1014,6 +1100,12 @@ namespace Modio
 	/// added to temp mod set
 	MODIOSDK_API std::map<Modio::ModID, Modio::ModCollectionEntry> QueryTempModSet();
 
+	/// @docpublic
+	/// @brief Visits the same mods as <<QueryTempModSet>> without copying them
+	/// @param Visitor Invoked synchronously for each mod in the temp mod set. The entry is only valid for the duration
+	/// of the call, and the visitor must not call other SDK functions
+	MODIOSDK_API void ForEachTempModSetEntry(std::function<void(const Modio::ModCollectionEntry&)> Visitor);
+
 	/// @docpublic
 	/// @brief Start a Metrics play session
 	/// @param Params Modio::MetricsServiceParams object containing information of what and how to start a metrics
@@ -19,7 +19,11 @@
 #include "modio/core/entities/ModioModInfo.h"
 #include "modio/core/entities/ModioModInfoList.h"
 #include "modio/core/entities/ModioModCollection.h"
+#include "modio/detail/ModioInternTable.h"
+#include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Modio
 {
@@ -46,7 +50,9 @@ namespace Modio
 
 			MODIO_IMPL void SetCacheExpireTime(std::chrono::steady_clock::duration ExpireTime);
 
-			MODIO_IMPL void AddToCache(std::string ResourceURL, class Modio::Detail::DynamicBuffer ResponseData);
+			/// @param ExpireTime How long the response is kept for, if not the expiry time set with SetCacheExpireTime
+			MODIO_IMPL void AddToCache(std::string ResourceURL, class Modio::Detail::DynamicBuffer ResponseData,
+									   Modio::Optional<std::chrono::steady_clock::duration> ExpireTime = {});
 
 			MODIO_IMPL void AddToCache(Modio::ModInfo ModInfoDetail);
 
@@ -93,10 +99,31 @@ namespace Modio
 				std::uint64_t FilesizeRecursive = 0;
 			};
 
+			/// @brief A mod held by the cache. The submitter and tags repeat across many mods, so they are kept in the
+			/// cache's intern tables and only put back into the ModInfo when it is fetched
+			struct ModInfoCacheEntry
+			{
+				Modio::ModInfo Info;
+				std::shared_ptr<const Modio::User> SubmittedBy;
+				std::vector<std::shared_ptr<const Modio::ModTag>> Tags;
+			};
+
+			/// @brief ModTag's operator== only compares the tag name, but a tag is only shared if its localized name
+			/// matches as well
+			struct ModTagEqual
+			{
+				bool operator()(const Modio::ModTag& A, const Modio::ModTag& B) const
+				{
+					return A.Tag == B.Tag && A.TagLocalized == B.TagLocalized;
+				}
+			};
+
 			struct Cache
 			{
 				std::unordered_map<std::uint32_t, CacheEntry> CacheEntries;
-				std::unordered_map<std::int64_t, Modio::ModInfo> ModInfoCache;
+				std::unordered_map<std::int64_t, ModInfoCacheEntry> ModInfoCache;
+				Modio::Detail::InternTable<std::int64_t, Modio::User> Users;
+				Modio::Detail::InternTable<std::string, Modio::ModTag, ModTagEqual> Tags;
 				std::unordered_map<std::int64_t, Modio::ModCollectionInfo> ModCollectionInfoCache;
 				std::unordered_map<std::int64_t, Modio::GameInfo> GameInfoCache;
 				std::unordered_map<std::int64_t, std::vector<Modio::ModID>> ModInfoListCache;
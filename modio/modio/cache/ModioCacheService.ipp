@@ -16,6 +16,7 @@
 #include "modio/core/ModioLogEnum.h"
 #include "modio/core/ModioLogger.h"
 #include "modio/detail/ModioProfiling.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/ModioSDKSessionData.h"
 
 namespace Modio
@@ -46,7 +47,8 @@ namespace Modio
 			CacheExpiryTime = ExpireTime;
 		}
 
-		void CacheService::AddToCache(std::string ResourceURL, Modio::Detail::DynamicBuffer ResponseData)
+		void CacheService::AddToCache(std::string ResourceURL, Modio::Detail::DynamicBuffer ResponseData,
+									  Modio::Optional<std::chrono::steady_clock::duration> ExpireTime)
 		{
 			MODIO_PROFILE_SCOPE(CacheAddURL);
 			auto Hasher = std::hash<std::string>();
@@ -59,15 +61,14 @@ namespace Modio
 				// @todo-optimize This will fragment the heap quite much, rewrite using another container so we don't
 				// need to allocate so many objects on the heap
 				Modio::Detail::Timer CacheExpiryTimer;
-				CacheExpiryTimer.ExpiresAfter(CacheExpiryTime);
+				CacheExpiryTimer.ExpiresAfter(ExpireTime.value_or(CacheExpiryTime));
 
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding hash {} to cache", URLHash);
+				MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding hash {} to cache", URLHash);
 
 				auto DeleteCacheEntry = [WeakCacheReference = std::weak_ptr<Cache>(CacheInstance),
 										 URLHash](std::error_code) mutable {
 					std::shared_ptr<Cache> CacheReference = WeakCacheReference.lock();
-					Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Removing hash {} from cache",
-												URLHash);
+					MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Removing hash {} from cache", URLHash);
 					if (CacheReference)
 					{
 						CacheReference->CacheEntries.erase(URLHash);
@@ -83,17 +84,29 @@ namespace Modio
 
 		void CacheService::AddToCache(Modio::ModInfo ModInfoDetails)
 		{
-			Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding ModID {} to cache",
-										ModInfoDetails.ModId);
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding ModID {} to cache", ModInfoDetails.ModId);
 			// The ModInfoCache would clean only when the mod.io SDK session ends. For that reason there is no
 			// timer for this case. Another way to remove this is by calling "ClearCache"
-			CacheInstance->ModInfoCache.insert_or_assign(ModInfoDetails.ModId, ModInfoDetails);
+			ModInfoCacheEntry CachedMod;
+			std::int64_t SubmitterID = ModInfoDetails.ProfileSubmittedBy.UserId;
+			CachedMod.SubmittedBy =
+				CacheInstance->Users.Intern(SubmitterID, std::move(ModInfoDetails.ProfileSubmittedBy));
+			ModInfoDetails.ProfileSubmittedBy = {};
+			CachedMod.Tags.reserve(ModInfoDetails.Tags.size());
+			for (Modio::ModTag& Tag : ModInfoDetails.Tags)
+			{
+				std::string TagName = Tag.Tag;
+				CachedMod.Tags.push_back(CacheInstance->Tags.Intern(TagName, std::move(Tag)));
+			}
+			ModInfoDetails.Tags = {};
+			CachedMod.Info = std::move(ModInfoDetails);
+			CacheInstance->ModInfoCache.insert_or_assign(CachedMod.Info.ModId, std::move(CachedMod));
 		}
 
 		void CacheService::AddToCache(Modio::ModCollectionInfo ModModCollectionInfoDetails)
 		{
-			Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding ModCollectionID {} to cache",
-										int64_t(ModModCollectionInfoDetails.Id));
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding ModCollectionID {} to cache",
+						int64_t(ModModCollectionInfoDetails.Id));
 			// The ModInfoCache would clean only when the mod.io SDK session ends. For that reason there is no
 			// timer for this case. Another way to remove this is by calling "ClearCache"
 			CacheInstance->ModCollectionInfoCache.insert_or_assign(ModModCollectionInfoDetails.Id, ModModCollectionInfoDetails);
@@ -101,16 +114,14 @@ namespace Modio
 
 		void CacheService::AddToCache(Modio::GameInfo GameInfoDetails)
 		{
-			Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding GameID {} to cache",
-										GameInfoDetails.GameID);
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding GameID {} to cache", GameInfoDetails.GameID);
 
 			CacheInstance->GameInfoCache.insert_or_assign(GameInfoDetails.GameID, GameInfoDetails);
 		}
 
 		void CacheService::AddToCache(Modio::GameID GameIDDetail, Modio::ModInfoList ModInfoDetails)
 		{
-			Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding ModIdList to cache with GameID: {}",
-										GameIDDetail);
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding ModIdList to cache with GameID: {}", GameIDDetail);
 			std::vector<Modio::ModID> ModIDVec;
 
 			// Instead of keeping the whole list (with possible data replications), it adds single elements to the
@@ -125,8 +136,8 @@ namespace Modio
 
 		void CacheService::AddToCache(Modio::GameID GameIDDetail, Modio::ModCollectionInfoList ModCollectionInfoDetails)
 		{
-			Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding ModCollectionIdList to cache with GameID: {}",
-										GameIDDetail);
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding ModCollectionIdList to cache with GameID: {}",
+						GameIDDetail);
 			std::vector<Modio::ModCollectionID> ModCollectionIDVec;
 
 			// Instead of keeping the whole list (with possible data replications), it adds single elements to the
@@ -140,8 +151,7 @@ namespace Modio
 
 		void CacheService::AddToCache(Modio::ModID ModId, std::uint64_t Filesize, bool recursive)
 		{
-			Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Adding ModID {} filesize to cache = {}",
-										ModId, Filesize);
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Adding ModID {} filesize to cache = {}", ModId, Filesize);
 
 			// See if we already have this mod cached, and then set the appropriate filesize depending on the recursive
 			// flag
@@ -171,7 +181,7 @@ namespace Modio
 			// Get ModIds from primary cache
 			for (auto& CacheEntry : CacheInstance->ModInfoCache)
 			{
-				listModId.GetRawList().push_back(CacheEntry.second.ModId);
+				listModId.GetRawList().push_back(CacheEntry.second.Info.ModId);
 			}
 
 			// Get ModIds from secondary cache
@@ -196,10 +206,12 @@ namespace Modio
 			auto CacheEntryIterator = CacheInstance->CacheEntries.find(URLHash);
 			if (CacheEntryIterator != CacheInstance->CacheEntries.end())
 			{
+				Modio::Detail::RuntimeStatsCollector::Get().RecordResponseCacheLookup(true);
 				return (CacheEntryIterator)->second.Data;
 			}
 			else
 			{
+				Modio::Detail::RuntimeStatsCollector::Get().RecordResponseCacheLookup(false);
 				return {};
 			}
 		}
@@ -210,26 +222,36 @@ namespace Modio
 			auto CacheEntryIterator = CacheInstance->ModInfoCache.find(ModIDDetail);
 			if (CacheEntryIterator != CacheInstance->ModInfoCache.end())
 			{
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Retrieving mod {} from primary cache",
-											ModIDDetail);
+				MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Retrieving mod {} from primary cache", ModIDDetail);
 
 				if (Modio::Detail::SDKSessionData::IsModCacheInvalid(ModIDDetail) == true)
 				{
+					Modio::Detail::RuntimeStatsCollector::Get().RecordModCacheLookup(false);
 					return {};
 				}
 
-				return CacheEntryIterator->second;
+				Modio::Detail::RuntimeStatsCollector::Get().RecordModCacheLookup(true);
+				const ModInfoCacheEntry& CachedMod = CacheEntryIterator->second;
+				Modio::ModInfo ModInfoDetails = CachedMod.Info;
+				ModInfoDetails.ProfileSubmittedBy = *CachedMod.SubmittedBy;
+				ModInfoDetails.Tags.reserve(CachedMod.Tags.size());
+				for (const std::shared_ptr<const Modio::ModTag>& Tag : CachedMod.Tags)
+				{
+					ModInfoDetails.Tags.push_back(*Tag);
+				}
+				return ModInfoDetails;
 			}
 
 			Modio::Optional<Modio::ModCollectionEntry&> CachedModInfo =
 				Modio::Detail::SDKSessionData::GetSystemModCollection().GetByModID(ModIDDetail);
 			if (CachedModInfo.has_value())
 			{
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http,
-											"Retrieving mod {} from secondary cache", ModIDDetail);
+				MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Retrieving mod {} from secondary cache", ModIDDetail);
+				Modio::Detail::RuntimeStatsCollector::Get().RecordModCacheLookup(true);
 				return CachedModInfo->GetModProfile();
 			}
 
+			Modio::Detail::RuntimeStatsCollector::Get().RecordModCacheLookup(false);
 			return {};
 		}
 
@@ -239,8 +261,8 @@ namespace Modio
 			auto CacheEntryIterator = CacheInstance->ModCollectionInfoCache.find(ModCollectionIDDetail);
 			if (CacheEntryIterator != CacheInstance->ModCollectionInfoCache.end())
 			{
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Retrieving mod {} from primary cache",
-											int64_t(ModCollectionIDDetail));
+				MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Retrieving mod {} from primary cache",
+							int64_t(ModCollectionIDDetail));
 
 				if (Modio::Detail::SDKSessionData::IsModCollectionCacheInvalid(ModCollectionIDDetail) == true)
 				{
@@ -257,8 +279,7 @@ namespace Modio
 			auto CacheEntryIterator = CacheInstance->GameInfoCache.find(GameIDDetail);
 			if (CacheEntryIterator != CacheInstance->GameInfoCache.end())
 			{
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http, "Retrieving game {} from primary cache",
-											GameIDDetail);
+				MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Retrieving game {} from primary cache", GameIDDetail);
 				return CacheEntryIterator->second;
 			}
 			return {};
@@ -305,8 +326,8 @@ namespace Modio
 			auto CacheEntryIterator = CacheInstance->ModDependenciesFilesize.find(ModIDDetail);
 			if (CacheEntryIterator != CacheInstance->ModDependenciesFilesize.end())
 			{
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::Http,
-											"Retrieving mod {} dependency filesize from primary cache", ModIDDetail);
+				MODIO_LOG(LogLevel::Trace, LogCategory::Http,
+							"Retrieving mod {} dependency filesize from primary cache", ModIDDetail);
 
 				if (Modio::Detail::SDKSessionData::IsModCacheInvalid(ModIDDetail) == true)
 				{
@@ -34,6 +34,28 @@ namespace Modio
 
 			// TODO: @modio-core take a reference to a progress info object?
 
+			/// @brief Sets how file entries added after this call select their compression method
+			/// @param Mode AlwaysDeflate to deflate every entry, Automatic to write incompressible entries with Store
+			void SetEntryCompressionMode(ArchiveFileImplementation::EntryCompressionMode Mode)
+			{
+				get_implementation()->EntryCompression = Mode;
+			}
+
+			/// @brief Writes the archive to a spool of part files instead of FilePath. Must be set before any entry is
+			/// added
+			/// @param Spool Spool receiving the archive bytes, in order
+			void SetOutputSpool(std::shared_ptr<ArchivePartSpool> Spool)
+			{
+				get_implementation()->OutputSpool = std::move(Spool);
+			}
+
+			/// @brief MD5 of the archive bytes written so far, as lowercase hex. Once the archive is finalized this is the
+			/// hash of the complete archive, matching the `filehash.md5` the REST API reports after it is uploaded
+			std::string GetArchiveMD5() const
+			{
+				return get_implementation()->ArchiveDigest.GetHexDigest();
+			}
+
 			/// @brief Compresses the specified file and writes its data into the archive
 			/// @tparam CompletionHandlerType Type of the Callable being used as the handler
 			/// @param SourceFilePath Path to the file to compress
@@ -43,12 +65,11 @@ namespace Modio
 			template<typename CompletionHandlerType>
 			auto AddFileEntryToArchiveAsync(Modio::filesystem::path SourceFilePath,
 											Modio::filesystem::path PathInsideArchive,
-											std::shared_ptr<uint64_t> FileHash,
 											std::weak_ptr<class Modio::ModProgressInfo> ProgressInfo,
 											CompletionHandlerType&& Handler)
 			{
-				get_service().AddFileEntryAsync(get_implementation(), SourceFilePath, PathInsideArchive, FileHash,
-												ProgressInfo, std::forward<CompletionHandlerType>(Handler));
+				get_service().AddFileEntryAsync(get_implementation(), SourceFilePath, PathInsideArchive, ProgressInfo,
+												std::forward<CompletionHandlerType>(Handler));
 			}
 
 			/// @brief Adds an empty/virtual directory entry to the archive.
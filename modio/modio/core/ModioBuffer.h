@@ -11,6 +11,9 @@
 #pragma once
 
 #include "modio/core/ModioStdTypes.h"
+#include "modio/detail/ModioBufferPool.h"
+#include <cstddef>
+#include <iterator>
 #include <mutex>
 #include <vector>
 
@@ -19,13 +22,14 @@ namespace Modio
 	namespace Detail
 	{
 		/// @docinternal
-		/// @brief Alignable moveable fixed-size buffer class. Aligned storage is more wasteful but will allow us to
-		/// swap to unbuffered IO on Windows/ERA platforms if we need additional performance
+		/// @brief Alignable moveable fixed-size buffer class. Aligned storage will allow us to swap to unbuffered IO on
+		/// Windows/ERA platforms if we need additional performance. Storage is taken from Modio::Detail::BufferPool,
+		/// whose blocks are already aligned, so Alignment must be a power of two no greater than
+		/// Modio::Detail::BufferPool::MaxAlignment
 		class Buffer
 		{
-			std::unique_ptr<unsigned char[]> InternalData {};
+			std::unique_ptr<unsigned char[], Modio::Detail::BufferPoolDeleter> InternalData {};
 			std::size_t Alignment = 0;
-			std::size_t AlignmentOffset = 0;
 			std::size_t Size = 0;
 
 		public:
@@ -39,7 +43,6 @@ namespace Modio
 			Buffer(Buffer&& Source) noexcept
 				: InternalData(std::move(Source.InternalData)),
 				  Alignment(std::move(Source.Alignment)),
-				  AlignmentOffset(Source.AlignmentOffset),
 				  Size(Source.Size) {}
 			MODIO_IMPL Buffer& operator=(Buffer&& Source) noexcept;
 
@@ -64,18 +67,25 @@ namespace Modio
 		/// shared_ptr not the underlying data so that the address of the data itself doesn't change
 		class DynamicBuffer
 		{
-			std::shared_ptr<std::vector<Modio::Detail::Buffer>> InternalBuffers;
+			/// @brief The buffers and the lock guarding them, allocated together so each DynamicBuffer costs a single
+			/// allocation and copies only touch one reference count
+			struct SharedState
+			{
+				std::vector<Modio::Detail::Buffer> Buffers {};
+				std::mutex BufferLock {};
+			};
+
+			std::shared_ptr<SharedState> State;
 			std::size_t Alignment = 1;
-			std::shared_ptr<std::mutex> BufferLock;
 			class DynamicBufferSequence
 			{
 				std::vector<Modio::MutableBufferView> BufferViews;
 
 			public:
-				MODIO_IMPL DynamicBufferSequence(std::shared_ptr<std::vector<Modio::Detail::Buffer>> BuffersToView,
+				MODIO_IMPL DynamicBufferSequence(const std::vector<Modio::Detail::Buffer>& BuffersToView,
 												 std::size_t ByteOffset, std::size_t NumberOfBytes);
 
-				MODIO_IMPL DynamicBufferSequence(std::shared_ptr<std::vector<Modio::Detail::Buffer>> BuffersToView);
+				MODIO_IMPL DynamicBufferSequence(const std::vector<Modio::Detail::Buffer>& BuffersToView);
 
 				MODIO_IMPL std::vector<Modio::MutableBufferView>::const_iterator begin() const;
 				MODIO_IMPL const std::vector<Modio::MutableBufferView>::const_iterator end() const;
@@ -139,6 +149,85 @@ namespace Modio
 			MODIO_IMPL bool Equals(const Modio::Detail::DynamicBuffer& Other) const;
 		};
 
+		/// @docinternal
+		/// @brief Forward iterator over the bytes held by a DynamicBuffer, moving from one internal buffer to the next,
+		/// so the contents can be read in place (for example by the JSON parser) instead of being copied into a
+		/// contiguous Buffer first. A default-constructed iterator is the end iterator. Like iterators over a
+		/// container, it is invalidated by anything that changes the buffers the DynamicBuffer holds
+		class DynamicBufferByteIterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = char;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const char*;
+			using reference = char;
+
+			DynamicBufferByteIterator() = default;
+
+			explicit DynamicBufferByteIterator(const Modio::Detail::DynamicBuffer& BufferToRead)
+				: NextSegment(BufferToRead.begin()),
+				  SegmentsEnd(BufferToRead.end())
+			{
+				StartNextSegment();
+			}
+
+			char operator*() const
+			{
+				return static_cast<char>(*Current);
+			}
+
+			DynamicBufferByteIterator& operator++()
+			{
+				if (++Current == CurrentEnd)
+				{
+					StartNextSegment();
+				}
+				return *this;
+			}
+
+			DynamicBufferByteIterator operator++(int)
+			{
+				DynamicBufferByteIterator Previous = *this;
+				++(*this);
+				return Previous;
+			}
+
+			bool operator==(const DynamicBufferByteIterator& Other) const
+			{
+				return Current == Other.Current;
+			}
+
+			bool operator!=(const DynamicBufferByteIterator& Other) const
+			{
+				return Current != Other.Current;
+			}
+
+		private:
+			void StartNextSegment()
+			{
+				// Data() and GetSize() are only called once per segment, so stepping within a segment is a pointer
+				// increment
+				while (NextSegment != SegmentsEnd)
+				{
+					const Modio::Detail::Buffer& Segment = *NextSegment++;
+					if (Segment.GetSize() > 0)
+					{
+						Current = Segment.Data();
+						CurrentEnd = Current + Segment.GetSize();
+						return;
+					}
+				}
+				Current = nullptr;
+				CurrentEnd = nullptr;
+			}
+
+			const unsigned char* Current = nullptr;
+			const unsigned char* CurrentEnd = nullptr;
+			std::vector<Modio::Detail::Buffer>::const_iterator NextSegment {};
+			std::vector<Modio::Detail::Buffer>::const_iterator SegmentsEnd {};
+		};
+
 		template<typename DestinationType>
 		DestinationType TypedBufferRead(Modio::Detail::DynamicBuffer& BufferToRead, std::uintmax_t Offset);
 
@@ -184,10 +273,10 @@ namespace Modio
 		/// @param Source The dynamic buffer to copy the data from
 		/// @return The number of bytes copied
 		MODIO_IMPL std::size_t BufferCopy(Modio::Detail::Buffer& Destination,
-										  const Modio::Detail::DynamicBuffer Source);
+										  const Modio::Detail::DynamicBuffer& Source);
 
 		MODIO_IMPL std::size_t BufferCopy(Modio::Detail::DynamicBuffer& Destination,
-										  const Modio::Detail::DynamicBuffer Source);
+										  const Modio::Detail::DynamicBuffer& Source);
 	} // namespace Detail
 } // namespace Modio
 
@@ -69,24 +69,15 @@ namespace Modio
 		Buffer::Buffer(std::size_t Size, std::size_t Alignment /*= 1*/) : Alignment(Alignment), Size(Size)
 		{
 			MODIO_PROFILE_SCOPE(BufferConstructor);
-			// find how many 4k blocks we need to allocate
-			auto NumBlocks = ((Size / (4 * 1024)) + 1);
-			// Add worst case amount of alignment bytes
-			auto HeaderSize = Alignment - 1;
-			// Calculate size big enough to include the desired size (padded to 4k boundaries) + the worst-case
-			// amount of alignment bytes
-			auto TotalSize = NumBlocks * (4 * 1024) + HeaderSize;
-
-			InternalData = std::make_unique<unsigned char[]>(TotalSize);
+			// The pool returns a block that is already aligned, so the data starts at the beginning of the block
+			Modio::Detail::BufferPoolDeleter Deleter;
+			unsigned char* Block = Modio::Detail::BufferPool::Allocate(Size, Deleter.SizeClass, Alignment);
+			InternalData = std::unique_ptr<unsigned char[], Modio::Detail::BufferPoolDeleter>(Block, Deleter);
 			{
+				// Pooled blocks hold whatever their previous buffer left in them
 				MODIO_PROFILE_SCOPE(BufferFill);
-				std::fill_n(InternalData.get(), TotalSize, std::uint8_t(0U));
+				std::fill_n(InternalData.get(), Size, std::uint8_t(0U));
 			}
-			// Perform the alignment calculation to know where we should consider the start of the data buffer
-			void* RawBufferPtr = InternalData.get();
-			std::align(Alignment, Size, RawBufferPtr, TotalSize);
-			// store the offset required to align reads or writes to the 4k boundary
-			AlignmentOffset = std::size_t( reinterpret_cast<unsigned char*>(RawBufferPtr) - InternalData.get());
 		}
 
 		MODIOSDK_API Buffer::~Buffer()
@@ -133,22 +124,22 @@ namespace Modio
 
 		unsigned char* Buffer::Data() const
 		{
-			return InternalData.get() + AlignmentOffset;
+			return InternalData.get();
 		}
 
 		unsigned char* Buffer::begin() const
 		{
-			return InternalData.get() + AlignmentOffset;
+			return InternalData.get();
 		}
 
 		unsigned char* Buffer::end() const
 		{
-			return InternalData.get() + AlignmentOffset + Size;
+			return InternalData.get() + Size;
 		}
 
 		unsigned char& Buffer::operator[](size_t Index) const
 		{
-			return InternalData[Index + AlignmentOffset];
+			return InternalData[Index];
 		}
 
 		std::size_t Buffer::GetSize() const
@@ -164,38 +155,32 @@ namespace Modio
 				InternalData = std::move(Source.InternalData);
 				Size = std::move(Source.Size);
 				Alignment = std::move(Source.Alignment);
-				AlignmentOffset = std::move(Source.AlignmentOffset);
 			}
 			return *this;
 		}
 
 		std::vector<Modio::Detail::Buffer>::const_iterator DynamicBuffer::end() const
 		{
-			return InternalBuffers->end();
+			return State->Buffers.end();
 		}
 
 		std::vector<Modio::Detail::Buffer>::iterator DynamicBuffer::end()
 		{
-			return InternalBuffers->end();
+			return State->Buffers.end();
 		}
 
-		DynamicBuffer::DynamicBuffer(const DynamicBuffer& Other)
-			: InternalBuffers(Other.InternalBuffers),
-			  Alignment(Other.Alignment),
-			  BufferLock(Other.BufferLock)
-		{}
+		DynamicBuffer::DynamicBuffer(const DynamicBuffer& Other) : State(Other.State), Alignment(Other.Alignment) {}
 
 		DynamicBuffer::DynamicBuffer(std::size_t Alignment /*= 1*/)
-			: InternalBuffers(std::make_shared<std::vector<Modio::Detail::Buffer>>()),
-			  Alignment(Alignment),
-			  BufferLock(std::make_shared<std::mutex>())
+			: State(Modio::Detail::MakePooled<SharedState>()),
+			  Alignment(Alignment)
 		{}
 
 		Modio::Detail::DynamicBuffer DynamicBuffer::Clone() const
 		{
 			MODIO_PROFILE_SCOPE(DynamicBufferClone);
 			DynamicBuffer NewBuffer(Alignment);
-			for (const Modio::Detail::Buffer& OriginalBuffer : *InternalBuffers)
+			for (const Modio::Detail::Buffer& OriginalBuffer : State->Buffers)
 			{
 				// Make a copy of the buffer in other array
 				NewBuffer.AppendBuffer(OriginalBuffer.Clone());
@@ -212,32 +197,32 @@ namespace Modio
 
 			Alignment = Other.Alignment;
 			// Reconfigure overlapping buffers
-			for (std::size_t Idx = 0; Idx < InternalBuffers->size() && Idx < Other.InternalBuffers->size(); ++Idx)
+			for (std::size_t Idx = 0; Idx < State->Buffers.size() && Idx < Other.State->Buffers.size(); ++Idx)
 			{
-				Modio::Detail::Buffer& MyBuffer = InternalBuffers->at(Idx);
-				const Modio::Detail::Buffer& OtherBuffer = Other.InternalBuffers->at(Idx);
+				Modio::Detail::Buffer& MyBuffer = State->Buffers.at(Idx);
+				const Modio::Detail::Buffer& OtherBuffer = Other.State->Buffers.at(Idx);
 				if (MyBuffer.GetSize() != OtherBuffer.GetSize() ||
 					MyBuffer.GetAlignment() != OtherBuffer.GetAlignment())
 				{
-					InternalBuffers->at(Idx) = Modio::Detail::Buffer(OtherBuffer.GetSize(), OtherBuffer.GetAlignment());
+					State->Buffers.at(Idx) = Modio::Detail::Buffer(OtherBuffer.GetSize(), OtherBuffer.GetAlignment());
 				}
 			}
 
 			// If we have more buffers than the other buffer, then reduce our size to others size
-			while (InternalBuffers->size() > Other.InternalBuffers->size())
+			while (State->Buffers.size() > Other.State->Buffers.size())
 			{
-				InternalBuffers->pop_back();
+				State->Buffers.pop_back();
 			}
 			// The other has more buffers, create new buffers from that one
-			if (InternalBuffers->size() < Other.InternalBuffers->size())
+			if (State->Buffers.size() < Other.State->Buffers.size())
 			{
 				// Reserve memory upfront to minimize memory allocations
-				InternalBuffers->reserve(Other.size());
-				for (std::size_t Idx = std::min(InternalBuffers->size(), Other.InternalBuffers->size());
-					 Idx < Other.InternalBuffers->size(); ++Idx)
+				State->Buffers.reserve(Other.size());
+				for (std::size_t Idx = std::min(State->Buffers.size(), Other.State->Buffers.size());
+					 Idx < Other.State->Buffers.size(); ++Idx)
 				{
-					const Modio::Detail::Buffer& OtherBuffer = Other.InternalBuffers->at(Idx);
-					InternalBuffers->push_back(
+					const Modio::Detail::Buffer& OtherBuffer = Other.State->Buffers.at(Idx);
+					State->Buffers.push_back(
 						Modio::Detail::Buffer(OtherBuffer.GetSize(), OtherBuffer.GetAlignment()));
 				}
 			}
@@ -245,19 +230,19 @@ namespace Modio
 
 		std::unique_lock<std::mutex> DynamicBuffer::Lock()
 		{
-			return std::unique_lock<std::mutex>(*BufferLock);
+			return std::unique_lock<std::mutex>(State->BufferLock);
 		}
 
 		void DynamicBuffer::Clear()
 		{
-			InternalBuffers->clear();
+			State->Buffers.clear();
 		}
 
 		std::size_t DynamicBuffer::size() const
 		{
 			std::size_t CumulativeSize = 0;
 
-			for (Modio::Detail::Buffer& CurrentBuffer : *InternalBuffers)
+			for (Modio::Detail::Buffer& CurrentBuffer : State->Buffers)
 			{
 				if (CurrentBuffer.Data() == nullptr)
 				{
@@ -285,96 +270,96 @@ namespace Modio
 
 		Modio::Detail::DynamicBuffer::mutable_buffers_type DynamicBuffer::data()
 		{
-			return DynamicBufferSequence(InternalBuffers);
+			return DynamicBufferSequence(State->Buffers);
 		}
 
 		Modio::Detail::DynamicBuffer::const_buffers_type DynamicBuffer::data() const
 		{
-			return DynamicBufferSequence(InternalBuffers);
+			return DynamicBufferSequence(State->Buffers);
 		}
 
 		Modio::Detail::DynamicBuffer::mutable_buffers_type DynamicBuffer::data(std::size_t pos, std::size_t n)
 		{
-			return DynamicBufferSequence(InternalBuffers, pos, n);
+			return DynamicBufferSequence(State->Buffers, pos, n);
 		}
 
 		Modio::Detail::DynamicBuffer::const_buffers_type DynamicBuffer::data(std::size_t pos, std::size_t n) const
 		{
-			return DynamicBufferSequence(InternalBuffers, pos, n);
+			return DynamicBufferSequence(State->Buffers, pos, n);
 		}
 
 		void DynamicBuffer::grow(std::size_t n)
 		{
-			InternalBuffers->push_back(Modio::Detail::Buffer(n, Alignment));
+			State->Buffers.push_back(Modio::Detail::Buffer(n, Alignment));
 		}
 
 		void DynamicBuffer::shrink(std::size_t n)
 		{
-			if (InternalBuffers->size() == 0)
+			if (State->Buffers.size() == 0)
 			{
 				return;
 			}
 			// if n is bigger than the last buffer, erase the last buffer and continue to iterate backwards erasing
 			// until n is less than the current tail buffer size or there are no buffers left
-			if (n >= InternalBuffers->back().GetSize())
+			if (n >= State->Buffers.back().GetSize())
 			{
 				do
 				{
-					n -= InternalBuffers->back().GetSize();
-					InternalBuffers->pop_back();
-					if (InternalBuffers->size() == 0)
+					n -= State->Buffers.back().GetSize();
+					State->Buffers.pop_back();
+					if (State->Buffers.size() == 0)
 					{
 						return;
 					}
 
-				} while (n >= InternalBuffers->back().GetSize());
+				} while (n >= State->Buffers.back().GetSize());
 			}
 
 			if (n > 0)
 			{
 				// Create a new buffer that is a copy of the unerased bytes of the tail buffer and swap that in
-				Modio::Detail::Buffer& OldTailBuffer = InternalBuffers->back();
+				Modio::Detail::Buffer& OldTailBuffer = State->Buffers.back();
 				Modio::Detail::Buffer NewTailBuffer =
 					OldTailBuffer.CopyRange(OldTailBuffer.begin(), OldTailBuffer.begin() + OldTailBuffer.GetSize() - n);
-				std::swap(InternalBuffers->back(), NewTailBuffer);
+				std::swap(State->Buffers.back(), NewTailBuffer);
 			}
 		}
 
 		void DynamicBuffer::consume(std::size_t n)
 		{
-			if (InternalBuffers->size() == 0)
+			if (State->Buffers.size() == 0)
 			{
 				return;
 			}
-			if (n >= InternalBuffers->front().GetSize())
+			if (n >= State->Buffers.front().GetSize())
 			{
 				do
 				{
-					n -= InternalBuffers->front().GetSize();
-					InternalBuffers->erase(InternalBuffers->begin());
-					if (InternalBuffers->size() == 0)
+					n -= State->Buffers.front().GetSize();
+					State->Buffers.erase(State->Buffers.begin());
+					if (State->Buffers.size() == 0)
 					{
 						return;
 					}
-				} while (n >= InternalBuffers->front().GetSize());
+				} while (n >= State->Buffers.front().GetSize());
 			}
 			if (n > 0)
 			{
-				Modio::Detail::Buffer& OldHeadBuffer = InternalBuffers->front();
+				Modio::Detail::Buffer& OldHeadBuffer = State->Buffers.front();
 				Modio::Detail::Buffer NewHeadBuffer =
 					OldHeadBuffer.CopyRange(OldHeadBuffer.begin() + n, OldHeadBuffer.end());
-				std::swap(InternalBuffers->front(), NewHeadBuffer);
+				std::swap(State->Buffers.front(), NewHeadBuffer);
 			}
 		}
 
 		Modio::Optional<Modio::Detail::Buffer> DynamicBuffer::TakeInternalBuffer()
 		{
-			if (InternalBuffers->size() == 0)
+			if (State->Buffers.size() == 0)
 			{
 				return {};
 			}
-			Modio::Detail::Buffer HeadBuffer = std::move(InternalBuffers->front());
-			InternalBuffers->erase(InternalBuffers->begin());
+			Modio::Detail::Buffer HeadBuffer = std::move(State->Buffers.front());
+			State->Buffers.erase(State->Buffers.begin());
 			return HeadBuffer;
 		}
 
@@ -383,48 +368,48 @@ namespace Modio
 			MODIO_PROFILE_SCOPE(DynamicBufferAppend);
 			if (NewBuffer.GetAlignment() == Alignment)
 			{
-				InternalBuffers->push_back(std::move(NewBuffer));
+				State->Buffers.push_back(std::move(NewBuffer));
 			}
 			else
 			{
 				Modio::Detail::Buffer AlignedCopy(NewBuffer.GetSize(), Alignment);
 				std::copy(NewBuffer.begin(), NewBuffer.end(), AlignedCopy.begin());
-				InternalBuffers->push_back(std::move(AlignedCopy));
+				State->Buffers.push_back(std::move(AlignedCopy));
 			}
 		}
 
 		std::vector<Modio::Detail::Buffer>::const_iterator DynamicBuffer::begin() const
 		{
-			return InternalBuffers->begin();
+			return State->Buffers.begin();
 		}
 
 		std::vector<Modio::Detail::Buffer>::iterator DynamicBuffer::begin()
 		{
-			return InternalBuffers->begin();
+			return State->Buffers.begin();
 		}
 
 		bool DynamicBuffer::Equals(const Modio::Detail::DynamicBuffer& Other) const
 		{
 			// Does the buffers contain different amount of buffers
-			if (InternalBuffers->size() != Other.InternalBuffers->size())
+			if (State->Buffers.size() != Other.State->Buffers.size())
 			{
 				return false;
 			}
 
 			// Are all the internal buffers of the same size
-			for (std::size_t Idx = 0; Idx < InternalBuffers->size(); ++Idx)
+			for (std::size_t Idx = 0; Idx < State->Buffers.size(); ++Idx)
 			{
-				if ((*InternalBuffers)[Idx].GetSize() != (*Other.InternalBuffers)[Idx].GetSize())
+				if (State->Buffers[Idx].GetSize() != Other.State->Buffers[Idx].GetSize())
 				{
 					return false;
 				}
 			}
 
 			// Is the content of all the internal buffers the same
-			for (std::size_t Idx = 0; Idx < InternalBuffers->size(); ++Idx)
+			for (std::size_t Idx = 0; Idx < State->Buffers.size(); ++Idx)
 			{
-				if (std::memcmp((*InternalBuffers)[Idx].Data(), (*Other.InternalBuffers)[Idx].Data(),
-								(*InternalBuffers)[Idx].GetSize()) != 0)
+				if (std::memcmp(State->Buffers[Idx].Data(), Other.State->Buffers[Idx].Data(),
+								State->Buffers[Idx].GetSize()) != 0)
 				{
 					return false;
 				}
@@ -434,21 +419,21 @@ namespace Modio
 		}
 
 		DynamicBuffer::DynamicBufferSequence::DynamicBufferSequence(
-			std::shared_ptr<std::vector<Modio::Detail::Buffer>> BuffersToView)
+			const std::vector<Modio::Detail::Buffer>& BuffersToView)
 		{
-			for (Modio::Detail::Buffer& CurrentBuffer : *BuffersToView)
+			for (const Modio::Detail::Buffer& CurrentBuffer : BuffersToView)
 			{
 				BufferViews.push_back(Modio::MutableBufferView(CurrentBuffer.Data(), CurrentBuffer.GetSize()));
 			}
 		}
 
 		DynamicBuffer::DynamicBufferSequence::DynamicBufferSequence(
-			std::shared_ptr<std::vector<Modio::Detail::Buffer>> BuffersToView, std::size_t ByteOffset,
+			const std::vector<Modio::Detail::Buffer>& BuffersToView, std::size_t ByteOffset,
 			std::size_t NumberOfBytes)
 		{
 			bool FirstBufferLocated = false;
 
-			for (Modio::Detail::Buffer& CurrentBuffer : *BuffersToView)
+			for (const Modio::Detail::Buffer& CurrentBuffer : BuffersToView)
 			{
 				if (!FirstBufferLocated && (ByteOffset < CurrentBuffer.GetSize()))
 				{
@@ -496,14 +481,14 @@ namespace Modio
 			return BufferViews.end();
 		}
 
-		std::size_t BufferCopy(Modio::Detail::Buffer& Destination, const Modio::Detail::DynamicBuffer Source)
+		std::size_t BufferCopy(Modio::Detail::Buffer& Destination, const Modio::Detail::DynamicBuffer& Source)
 		{
 			MODIO_PROFILE_SCOPE(DynamicBufferCopyToLinear);
 			return ModioAsio::buffer_copy(Modio::MutableBufferView(Destination.Data(), Destination.GetSize()),
 									 Source.data());
 		}
 
-		std::size_t BufferCopy(Modio::Detail::DynamicBuffer& Destination, const Modio::Detail::DynamicBuffer Source)
+		std::size_t BufferCopy(Modio::Detail::DynamicBuffer& Destination, const Modio::Detail::DynamicBuffer& Source)
 		{
 			MODIO_PROFILE_SCOPE(DynamicBufferCopyToDynamic);
 			Modio::Detail::DynamicBuffer::Sequence SourceBufferView = Source.data();
@@ -136,7 +136,8 @@ namespace Modio
 		ReadError = 20744,
 		UnableToCreateFile = 20745,
 		UnableToCreateFolder = 20746,
-		WriteError = 20747
+		WriteError = 20747,
+		FileVerificationFailed = 20748
 	};
 
 	/// @docnone
@@ -182,6 +183,9 @@ namespace Modio
 				case FilesystemError::WriteError:
 						return "Error writing file";
 					break;
+				case FilesystemError::FileVerificationFailed:
+						return "File did not match its expected size or hash";
+					break;
 				default:
 					return "Unknown FilesystemError error";
 			}
@@ -2245,6 +2249,11 @@ namespace Modio
 						return true;
 					}
 
+					if (ec == Modio::FilesystemError::FileVerificationFailed)
+					{
+						return true;
+					}
+
 	
 				break;
 				case ErrorConditionTypes::InternalError:
@@ -2491,6 +2500,11 @@ namespace Modio
 						return true;
 					}
 
+					if (ec == Modio::FilesystemError::FileVerificationFailed)
+					{
+						return true;
+					}
+
 	
 				break;
 				case ErrorConditionTypes::ModDeleteDeferredError:
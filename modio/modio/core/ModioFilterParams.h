@@ -194,6 +194,16 @@ namespace Modio
 		/// maximum allowed by the REST API).
 		MODIOSDK_API FilterParams();
 
+		/// @docinternal
+		/// @brief Copy of the filter params for the range of results that directly follows this one, with the
+		/// same size
+		MODIOSDK_API Modio::FilterParams FollowingResults() const;
+
+		/// @docinternal
+		/// @brief The query parameters without the offset of the range, so every page of the same query has the same
+		/// key
+		MODIOSDK_API std::map<std::string, std::string> ToQueryKey() const;
+
 		/// @docinternal
 		/// @brief Converts the filter params to a string suitable for use in the REST API
 		/// @return std::string containing the filter parameters
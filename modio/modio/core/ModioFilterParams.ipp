@@ -147,6 +147,21 @@ namespace Modio
 		return *this;
 	}
 
+	MODIOSDK_API Modio::FilterParams FilterParams::FollowingResults() const
+	{
+		Modio::FilterParams Following = *this;
+		// Paged filters count in pages, indexed ones in results
+		Following.Index += IsPaged ? 1 : Count;
+		return Following;
+	}
+
+	MODIOSDK_API std::map<std::string, std::string> FilterParams::ToQueryKey() const
+	{
+		std::map<std::string, std::string> QueryKey = ToQueryParamaters();
+		QueryKey.erase("_offset");
+		return QueryKey;
+	}
+
 	MODIOSDK_API Modio::FilterParams& FilterParams::RevenueType(RevenueFilterType ByRevenue)
 	{
 		Revenue = ByRevenue;
@@ -15,6 +15,11 @@
 #include "modio/core/ModioLogBuffer.h"
 #include "modio/core/ModioLogEnum.h"
 #include "modio/detail/AsioWrapper.h"
+#include "modio/detail/ModioLogRingBuffer.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 
 namespace Modio
 {
@@ -23,16 +28,14 @@ namespace Modio
 		/// @docinternal
 		/// @brief Base class Modio logger service that support log levels and platform
 		/// specific implementations
+		///
+		/// Messages are captured into a LogRingBuffer with copies of their arguments, and are only formatted and
+		/// written to the platform output and the user's callback when FlushLogBuffer runs. Logging a message is
+		/// lock-free, so it is safe from any thread, and a message below the level of its category costs one
+		/// comparison. As output is deferred, the messages logged since the last flush are lost if the process
+		/// crashes.
 		class LogService : public ModioAsio::detail::service_base<LogService>
 		{
-			/// @docinternal
-			/// @brief Wrapper around a Log message and the level it was logged for
-			struct LogMessage
-			{
-				Modio::LogLevel Level;
-				std::string Message;
-			};
-
 		public:
 			/// @docinternal
 			/// @brief Default constructor
@@ -47,40 +50,40 @@ namespace Modio
 			/// @brief Turn off the log service
 			MODIOSDK_API void Shutdown();
 
-			/// @brief Change the LogLevel of the log service
+			/// @brief Change the LogLevel of the log service, for every category
 			MODIO_IMPL void SetLogLevel(LogLevel Level);
 
 			/// @brief Retrieve the current LogLevel
 			MODIO_IMPL LogLevel GetLogLevel() const;
 
-			/// @brief Clear the log buffer after all stored messages are forwarded
-			/// to the stored callback
-			MODIO_IMPL void FlushLogBuffer();
-			
-			/// @docinternal
-			/// @brief Log operation using a template of different possible arguments and most importantly
-			///a platform specific logger object
-			template<typename... ArgTypes>
-			void Log(implementation_type& PlatformLoggerObject, LogLevel Level, LogCategory Category,
-					 std::string Format, ArgTypes... Args)
+			/// @brief Change the LogLevel of a single category, leaving the others as they are
+			MODIO_IMPL void SetCategoryLogLevel(LogCategory Category, LogLevel Level);
+
+			/// @return true if a message of the given level and category would be logged
+			bool IsLogged(LogLevel Level, LogCategory Category) const
 			{
-				if (Level >= CurrentLogLevel)
-				{
-					std::string LogOutput = PlatformLoggerObject->Log(Level, Category, Format, Args...);
-					LogBuffer.push_back({Level, LogOutput});
-				}
+				std::size_t CategoryIndex = static_cast<std::size_t>(Category);
+				return CategoryIndex < NumLogCategories &&
+					   Level >= CategoryLogLevels[CategoryIndex].load(std::memory_order_relaxed);
 			}
-			
+
+			/// @brief Formats the messages logged since the last flush and forwards them to the platform output and
+			/// the stored callback
+			MODIO_IMPL void FlushLogBuffer();
+
+			/// @return The number of messages dropped because too many were waiting to be flushed
+			MODIO_IMPL std::uint64_t GetDroppedLogCount() const;
+
 			/// @docinternal
-			/// @brief Log operation that immediately emits the formatted string
-			template<typename... ArgTypes>
-			void LogImmediate(implementation_type& PlatformLoggerObject, LogLevel Level, LogCategory Category,
-							  std::string Format, ArgTypes... Args)
+			/// @brief Queues a message to be formatted by the next FlushLogBuffer. The level of the message's category
+			/// is checked before anything is copied
+			/// @param Format Format string for the message. A LogLiteral is referred to, anything else is copied
+			template<typename FormatType, typename... ArgTypes>
+			void Log(LogLevel Level, LogCategory Category, FormatType&& Format, ArgTypes&&... Args)
 			{
-				if (Level >= CurrentLogLevel)
+				if (IsLogged(Level, Category))
 				{
-					std::string LogOutput = PlatformLoggerObject->LogImmediate(Level, Category, Format, Args...);
-					LogBuffer.push_back({Level, LogOutput});
+					Records.TryPush(Level, Category, std::forward<FormatType>(Format), std::forward<ArgTypes>(Args)...);
 				}
 			}
 
@@ -98,9 +101,21 @@ namespace Modio
 			// the startup
 			static MODIO_IMPL std::function<void(Modio::LogLevel, const std::string&)> UserCallbackFunction;
 
-			LogLevel CurrentLogLevel = LogLevel::Warning;
-			ModioAsio::strand<ModioAsio::io_context::executor_type> LogStrand;
-			std::vector<LogMessage> LogBuffer {};
+			// Must be kept in sync with the last value of Modio::LogCategory
+			static constexpr std::size_t NumLogCategories = static_cast<std::size_t>(LogCategory::ModMetrics) + 1;
+
+			std::atomic<LogLevel> CurrentLogLevel {LogLevel::Warning};
+			std::array<std::atomic<LogLevel>, NumLogCategories> CategoryLogLevels {};
+
+			Modio::Detail::LogRingBuffer Records;
+			std::uint64_t LastReportedDropCount = 0;
+			std::shared_ptr<Modio::Detail::LoggerImplementation> PlatformLogger;
+
+			/// @brief Serializes flushes, which may come from the game's thread and the SDK's worker thread
+			std::mutex FlushMutex {};
+			/// @brief Reused by every flush so formatting messages does not allocate once they have grown
+			std::string MessageScratch {};
+			std::string LineScratch {};
 		};
 	} // namespace Detail
 } // namespace Modio
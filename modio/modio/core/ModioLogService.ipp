@@ -19,12 +19,19 @@ namespace Modio
 		LogService::LogService(ModioAsio::io_context& IOService)
 			: ModioAsio::detail::service_base<LogService>(IOService),
 			  CurrentLogLevel(LogLevel::Trace),
-			  LogStrand(ModioAsio::make_strand(IOService))
-		{}
+			  Records(Modio::Detail::Constants::Configuration::LogRingBufferCapacity),
+			  PlatformLogger(std::make_shared<LoggerImplementation>())
+		{
+			for (std::atomic<LogLevel>& CategoryLevel : CategoryLogLevels)
+			{
+				CategoryLevel.store(LogLevel::Trace, std::memory_order_relaxed);
+			}
+		}
 
 		void LogService::construct(implementation_type& Implementation)
 		{
-			Implementation = std::make_shared<LoggerImplementation>(LogStrand);
+			// Every Logger shares the service's implementation, so creating one for a single message is cheap
+			Implementation = PlatformLogger;
 		}
 
 		void LogService::destroy(implementation_type& Implementation)
@@ -40,6 +47,19 @@ namespace Modio
 		void LogService::SetLogLevel(LogLevel Level)
 		{
 			CurrentLogLevel = Level;
+			for (std::atomic<LogLevel>& CategoryLevel : CategoryLogLevels)
+			{
+				CategoryLevel.store(Level, std::memory_order_relaxed);
+			}
+		}
+
+		void LogService::SetCategoryLogLevel(LogCategory Category, LogLevel Level)
+		{
+			std::size_t CategoryIndex = static_cast<std::size_t>(Category);
+			if (CategoryIndex < NumLogCategories)
+			{
+				CategoryLogLevels[CategoryIndex].store(Level, std::memory_order_relaxed);
+			}
 		}
 
 		Modio::LogLevel LogService::GetLogLevel() const
@@ -49,14 +69,39 @@ namespace Modio
 
 		void LogService::FlushLogBuffer()
 		{
-			if (UserCallbackFunction)
+			std::lock_guard<std::mutex> Lock(FlushMutex);
+
+			Records.ConsumeAll([this](Modio::Detail::LogRecord& Record) {
+				MessageScratch.clear();
+				Record.FormatMessage(MessageScratch);
+				PlatformLogger->Write(LineScratch, Record.GetLevel(), Record.GetCategory(), Record.GetTime(),
+									  MessageScratch);
+				if (UserCallbackFunction)
+				{
+					UserCallbackFunction(Record.GetLevel(), LineScratch);
+				}
+			});
+
+			std::uint64_t DropCount = Records.GetDroppedCount();
+			if (DropCount != LastReportedDropCount)
 			{
-				for (const LogMessage& Log : LogBuffer)
+				MessageScratch.clear();
+				fmt::format_to(std::back_inserter(MessageScratch),
+							   "{} log messages were dropped because they were logged faster than they were flushed",
+							   DropCount - LastReportedDropCount);
+				LastReportedDropCount = DropCount;
+				PlatformLogger->Write(LineScratch, LogLevel::Warning, LogCategory::Core,
+									  std::chrono::system_clock::now(), MessageScratch);
+				if (UserCallbackFunction)
 				{
-					UserCallbackFunction(Log.Level, Log.Message);
+					UserCallbackFunction(LogLevel::Warning, LineScratch);
 				}
 			}
-			LogBuffer.clear();
+		}
+
+		std::uint64_t LogService::GetDroppedLogCount() const
+		{
+			return Records.GetDroppedCount();
 		}
 
 		void LogService::SetLogCallback(std::function<void(Modio::LogLevel, const std::string&)> LogCallback)
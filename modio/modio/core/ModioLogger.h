@@ -13,6 +13,7 @@
 #include "modio/core/ModioLogEnum.h"
 #include "modio/core/ModioLogService.h"
 #include "modio/detail/AsioWrapper.h"
+#include "modio/detail/ModioDefines.h"
 
 namespace Modio
 {
@@ -25,13 +26,6 @@ namespace Modio
 		{
 			Logger(Logger&&) = delete;
 
-		protected:
-			template<typename... ArgTypes>
-			void LogImmediate(LogLevel Level, LogCategory Category, std::string Format, ArgTypes... Args)
-			{
-				get_service().LogImmediate(get_implementation(), Level, Category, Format, Args...);
-			}
-
 		public:
 			/// @brief Explicit constructor for a Logger that posts messages via an explicit io_context
 			/// @param Context the io_context to use
@@ -51,13 +45,36 @@ namespace Modio
 			/// message
 			/// @param Format Format string for the message. Uses fmtlib syntax for substitutions
 			/// @param Args Additional arguments to insert into the format string
+			template<typename FormatType, typename... ArgTypes>
+			void Log(LogLevel Level, LogCategory Category, FormatType&& Format, ArgTypes&&... Args)
+			{
+				get_service().Log(Level, Category, std::forward<FormatType>(Format), std::forward<ArgTypes>(Args)...);
+			}
+
+			/// @brief Print a message whose format string MODIO_LOG has checked is a string literal. Use MODIO_LOG
+			/// rather than calling this directly
+			/// @param Format The checked format string, which is referred to until the message is flushed
 			template<typename... ArgTypes>
-			void Log(LogLevel Level, LogCategory Category, std::string Format, ArgTypes... Args)
+			void LogLiteralFormat(LogLevel Level, LogCategory Category, Modio::Detail::LogLiteral Format,
+								  const char* /*UncheckedFormat*/, ArgTypes&&... Args)
+			{
+				get_service().Log(Level, Category, Format, std::forward<ArgTypes>(Args)...);
+			}
+
+			/// @return true if a message of the given level and category would be logged at the moment
+			bool IsLogged(LogLevel Level, LogCategory Category)
 			{
-				get_service().LogImmediate(get_implementation(), Level, Category, Format, Args...);
+				return get_service().IsLogged(Level, Category);
 			}
 		};
 
+		/// @docinternal
+		/// @return true if messages of the given level are compiled into MODIO_LOG
+		constexpr bool IsLogLevelCompiledIn(LogLevel Level)
+		{
+			return static_cast<int>(Level) >= MODIO_MIN_LOG_LEVEL;
+		}
+
 		/// @docinternal
 		/// @brief Simple class to log entry and exit for a particular scope
 		class ScopedLogger : Logger
@@ -74,12 +91,44 @@ namespace Modio
 				: ScopeName(ScopeName),
 				  Category(Category)
 			{
-				LogImmediate(LogLevel::Info, Category, "Entered {}", ScopeName);
+				Log(LogLevel::Info, Category, "Entered {}", ScopeName);
 			}
 			~ScopedLogger()
 			{
-				LogImmediate(LogLevel::Info, Category, "Left {}", ScopeName);
+				Log(LogLevel::Info, Category, "Left {}", ScopeName);
 			}
 		};
 	} // namespace Detail
-} // namespace Modio
\ No newline at end of file
+} // namespace Modio
+
+/// @docinternal
+/// @brief true if a message of the given level and category is compiled in and would be logged at the moment. Guards
+/// work done only to produce a log message
+#define MODIO_LOG_ENABLED(Level, Category) \
+	(Modio::Detail::IsLogLevelCompiledIn(Level) && Modio::Detail::Logger().IsLogged(Level, Category))
+
+/// @docinternal
+/// @brief Expands to the first of its arguments. MODIO_DETAIL_EXPAND makes MSVC split __VA_ARGS__ before it is
+/// passed on
+#define MODIO_DETAIL_EXPAND(X) X
+#define MODIO_DETAIL_LOG_FIRST(First, ...) First
+
+/// @docinternal
+/// @brief Logs a message like Modio::Detail::Logger().Log, but only evaluates the format arguments if the message will
+/// be logged. Messages below MODIO_MIN_LOG_LEVEL are compiled out. The format string must be a string literal, which
+/// the message refers to instead of copying
+#define MODIO_LOG(Level, Category, ...)                                                                    \
+	do                                                                                                     \
+	{                                                                                                      \
+		if (Modio::Detail::IsLogLevelCompiledIn(Level))                                                    \
+		{                                                                                                  \
+			Modio::Detail::Logger ModioMacroLogger;                                                        \
+			if (ModioMacroLogger.IsLogged(Level, Category))                                                \
+			{                                                                                              \
+				ModioMacroLogger.LogLiteralFormat(                                                         \
+					Level, Category,                                                                       \
+					Modio::Detail::LogLiteral {"" MODIO_DETAIL_EXPAND(MODIO_DETAIL_LOG_FIRST(__VA_ARGS__, ~)) ""}, \
+					__VA_ARGS__);                                                                          \
+			}                                                                                              \
+		}                                                                                                  \
+	} while (0)
@@ -15,6 +15,9 @@
 #include "modio/core/entities/ModioModInfo.h"
 #include <set>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Modio
 {
@@ -78,8 +81,22 @@ namespace Modio
 
 		Modio::Optional<Modio::ModState> RollbackState {};
 
-		/// @brief Mod descriptor from the REST API
-		Modio::ModInfo ModProfile {};
+		/// @docinternal
+		/// @brief Mod descriptor from the REST API. Mod management only needs the hot fields of the entry, so the
+		/// profile is kept MessagePack encoded and only decoded when it is asked for. A profile is never changed once
+		/// stored, so copies of an entry share it rather than copying it
+		std::shared_ptr<const std::vector<std::uint8_t>> ModProfile {};
+
+		/// @docinternal
+		/// @brief ModProfile decoded by the first GetModProfile call, so only the profiles that are asked for are held
+		/// decoded. Replaced along with ModProfile, and shared between copies like it. Only accessed through the
+		/// std::atomic_load/std::atomic_store functions, as concurrent readers of the collection may fill it
+		mutable std::shared_ptr<const Modio::ModInfo> DecodedModProfile {};
+
+		/// @docinternal
+		/// @brief ID of the modfile in the profile, kept alongside the hot fields so checking for updates does not
+		/// need the profile
+		Modio::Optional<Modio::FileMetadataID> ModfileID {};
 
 		/// @brief Reference counting to allow automatic uninstallation of unused local mods
 		std::atomic<uint8_t> LocalUserSubscriptionCount {};
@@ -99,12 +116,51 @@ namespace Modio
 
 		std::uint8_t RetriesRemainingThisSession {};
 
+		/// @docinternal
+		/// @brief Changes whenever a field that is saved to disk changes, so caches built from the entry can tell
+		/// whether it changed. Not saved to disk itself
+		std::atomic<std::uint64_t> Revision {};
+
+		/// @docinternal
+		/// @brief PersistedField flags of the fields changed since the mod collection journal last saved the entry
+		std::atomic<std::uint32_t> UnsavedFields {};
+
+		/// @docinternal
+		/// @brief Assigns the entry a revision no other entry has had this session, and records which persisted
+		/// fields changed for the mod collection journal
+		/// @param ChangedFields PersistedField flags of the fields that changed
+		MODIO_IMPL void MarkModified(std::uint32_t ChangedFields);
+
+		/// @docinternal
+		/// @brief Last revision assigned to any entry
+		MODIO_IMPL static std::atomic<std::uint64_t>& RevisionCounter();
+
+		/// @docinternal
+		/// @brief Replaces the profile and the hot fields taken from it, unless the profile encodes to the bytes
+		/// already stored
+		/// @return true if the stored profile changed
+		MODIO_IMPL bool StoreModProfile(const Modio::ModInfo& ProfileData);
+
+		/// @docinternal
+		/// @brief Replaces the profile with one that is already encoded, without decoding it
+		MODIO_IMPL void StoreEncodedModProfile(std::vector<std::uint8_t> EncodedProfile,
+											   Modio::Optional<Modio::FileMetadataID> EncodedModfileID);
+
+		/// @docinternal
+		/// @return The encoded profile, empty if the entry has none
+		MODIO_IMPL const std::vector<std::uint8_t>& GetEncodedModProfile() const;
+
+		/// @docinternal
+		/// @return The profile decoded from ModProfile, or an empty profile if it cannot be decoded
+		MODIO_IMPL Modio::ModInfo DecodeModProfile() const;
+
 		/// @docnone
 		friend bool operator==(const Modio::ModCollectionEntry& A, const Modio::ModCollectionEntry& B)
 		{
 			// Note: Operator==()  ignores transient fields ShouldNotRetry and RetriesRemainingThisSession
 			if ((A.ID == B.ID) && (A.CurrentState == B.CurrentState) && (A.RollbackState == B.RollbackState) &&
-				(A.ModProfile == B.ModProfile) && (A.LocalUserSubscriptionCount == B.LocalUserSubscriptionCount) &&
+				(A.GetEncodedModProfile() == B.GetEncodedModProfile()) &&
+				(A.LocalUserSubscriptionCount == B.LocalUserSubscriptionCount) &&
 				(A.LocalUserSubscriptions == B.LocalUserSubscriptions) && (A.PathOnDisk == B.PathOnDisk) &&
 				(A.SizeOnDisk == B.SizeOnDisk) && (A.NeverRetryReason == B.NeverRetryReason))
 			{
@@ -120,6 +176,18 @@ namespace Modio
 		friend class ModCollectionEntryConstAccessor;
 
 	public:
+		/// @docinternal
+		/// @brief Flags naming the fields of an entry that are saved to disk
+		struct PersistedField
+		{
+			static constexpr std::uint32_t State = 1 << 0;
+			static constexpr std::uint32_t Profile = 1 << 1;
+			static constexpr std::uint32_t Subscriptions = 1 << 2;
+			static constexpr std::uint32_t Path = 1 << 3;
+			static constexpr std::uint32_t SizeOnDisk = 1 << 4;
+			static constexpr std::uint32_t NeverRetryReason = 1 << 5;
+			static constexpr std::uint32_t All = (1 << 6) - 1;
+		};
 
 		/// @docinternal
 		/// @brief Default constructor
@@ -200,6 +268,10 @@ namespace Modio
 		/// @return Modio::ModInfo containing mod profile data
 		MODIOSDK_API const Modio::ModInfo& GetModProfile() const;
 
+		/// @docinternal
+		/// @return ID of the modfile in the mod profile, if it has one
+		MODIOSDK_API Modio::Optional<Modio::FileMetadataID> GetModfileID() const;
+
 		/// @docpublic
 		/// @return Path to the mod's installation folder on disk
 		/// NOTE: If the mod is not yet installed this path may not yet exist. Check
@@ -237,6 +309,20 @@ namespace Modio
 		/// @return Modio::ErrorCode The last error that occurred for this mod
 		MODIOSDK_API Modio::ErrorCode GetLastError() const;
 
+		/// @docinternal
+		/// @return Revision of the persisted fields of this entry. Two different revisions mean the entry has changed
+		/// in between, while copies of an entry share its revision
+		MODIOSDK_API std::uint64_t GetRevision() const;
+
+		/// @docinternal
+		/// @return The revision most recently assigned to any entry. If it has not changed, no entry has changed
+		MODIOSDK_API static std::uint64_t GetLatestRevision();
+
+		/// @docinternal
+		/// @brief Considers the entry saved by the mod collection journal
+		/// @return PersistedField flags of the fields that changed since the entry was last saved
+		MODIOSDK_API std::uint32_t TakeUnsavedFields();
+
 		/// @docinternal
 		/// @brief If the conditions are met, it starts a transaction over the ModCollectionEntry
 		friend void Modio::BeginTransactionImpl(Modio::ModCollectionEntry& Entry);
@@ -425,9 +511,14 @@ namespace Modio
 		MODIOSDK_API const std::set<Modio::ModID>& Get() const;
 
 		/// @docinternal
-		/// @brief Retrieve a set of ModID
+		/// @brief Retrieve a set of ModID. The list is considered modified by this call
 		MODIOSDK_API std::set<Modio::ModID>& Get();
 
+		/// @docinternal
+		/// @return Revision of the list, which changes whenever the list may have been modified. Copies of a list
+		/// share its revision
+		MODIOSDK_API std::uint64_t GetRevision() const;
+
 		/// @docnone
 		friend bool operator==(const Modio::BaseModList& A, const Modio::BaseModList& B)
 		{
@@ -437,7 +528,13 @@ namespace Modio
 		}
 
 	protected:
+		/// @docinternal
+		/// @brief Assigns the list a revision no other list has had this session
+		MODIO_IMPL void MarkModified();
+
 		std::set<Modio::ModID> InternalList {};
+
+		std::uint64_t Revision = 0;
 	};
 
 	/// @docpublic
@@ -589,10 +686,16 @@ namespace Modio
 		MODIOSDK_API const std::map<Modio::ModID, std::shared_ptr<Modio::ModCollectionEntry>>& Entries() const;
 
 		/// @docpublic
-		/// @brief Retrieve a dictionary of ModID - ModCollectionEntry stored in this ModCollection
+		/// @brief Retrieve a dictionary of ModID - ModCollectionEntry stored in this ModCollection. The set of
+		/// entries is considered modified by this call
 		/// @return Dictionary where keys are ModID and values are ModCollectionEntry
 		MODIOSDK_API std::map<Modio::ModID, std::shared_ptr<Modio::ModCollectionEntry>>& Entries();
 
+		/// @docinternal
+		/// @return Revision of the set of entries in the collection, which changes whenever an entry may have been
+		/// added or removed. Changes to the entries themselves are tracked by their own revisions
+		MODIOSDK_API std::uint64_t GetRevision() const;
+
 		/// @docpublic
 		/// @brief Retrieve a single ModCollectionEntry if one is found using a ModID
 		/// @return A ModCollectionEntry when the ModCollection finds it using a ModID, otherwise empty
@@ -634,7 +737,13 @@ namespace Modio
 		}
 
 	private:
+		/// @docinternal
+		/// @brief Assigns the collection a revision no other collection has had this session
+		MODIO_IMPL void MarkModified();
+
 		std::map<Modio::ModID, std::shared_ptr<Modio::ModCollectionEntry>> ModEntries;
+
+		std::uint64_t Revision = 0;
 	};
 
 	/// @docpublic
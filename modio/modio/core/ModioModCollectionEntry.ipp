@@ -16,30 +16,111 @@
 #include "modio/detail/ModioConstants.h"
 #include "modio/core/ModioErrorCode.h"
 #include "modio/core/ModioLogger.h"
+#include "modio/detail/ModioModCollectionJournal.h"
+#include "modio/detail/serialization/ModioModInfoSerialization.h"
 
 namespace Modio
 {
 	MODIOSDK_API ModCollectionEntry::ModCollectionEntry(ModInfo ProfileData, std::string CalculatedModPath)
 		: ID(ProfileData.ModId),
 		  CurrentState(Modio::ModState::InstallationPending),
-		  ModProfile(ProfileData),
 		  LocalUserSubscriptions(),
 		  PathOnDisk(CalculatedModPath),
 		  RetriesRemainingThisSession(Modio::Detail::Constants::Configuration::DefaultNumberOfRetries)
-	{}
+	{
+		StoreModProfile(ProfileData);
+		MarkModified(PersistedField::All);
+	}
 
 	MODIOSDK_API ModCollectionEntry::ModCollectionEntry(const ModCollectionEntry& Other)
 		: ID(Other.ID),
 		  CurrentState(Other.CurrentState.load()),
 		  ModProfile(Other.ModProfile),
+		  DecodedModProfile(std::atomic_load(&Other.DecodedModProfile)),
+		  ModfileID(Other.ModfileID),
 		  LocalUserSubscriptionCount(Other.LocalUserSubscriptionCount.load()),
 		  LocalUserSubscriptions(Other.LocalUserSubscriptions),
 		  PathOnDisk(Other.PathOnDisk),
 		  SizeOnDisk(Other.SizeOnDisk),
 		  LastErrorCode(Other.LastErrorCode),
-		  RetriesRemainingThisSession(Modio::Detail::Constants::Configuration::DefaultNumberOfRetries)
+		  RetriesRemainingThisSession(Modio::Detail::Constants::Configuration::DefaultNumberOfRetries),
+		  Revision(Other.Revision.load())
 	{}
 
+	std::atomic<std::uint64_t>& ModCollectionEntry::RevisionCounter()
+	{
+		// Shared by all entries, so an entry that replaces a removed one never reuses the revision of its predecessor
+		static std::atomic<std::uint64_t> LastRevision {};
+		return LastRevision;
+	}
+
+	void ModCollectionEntry::MarkModified(std::uint32_t ChangedFields)
+	{
+		Revision.store(++RevisionCounter());
+		// The fields are flagged before the entry is queued, so a save that takes the entry off the queue always
+		// sees them
+		UnsavedFields.fetch_or(ChangedFields);
+		Modio::Detail::ModCollectionJournal::NotifyEntryChanged(ID);
+	}
+
+	MODIOSDK_API std::uint64_t ModCollectionEntry::GetRevision() const
+	{
+		return Revision.load();
+	}
+
+	MODIOSDK_API std::uint64_t ModCollectionEntry::GetLatestRevision()
+	{
+		return RevisionCounter().load();
+	}
+
+	MODIOSDK_API std::uint32_t ModCollectionEntry::TakeUnsavedFields()
+	{
+		return UnsavedFields.exchange(0);
+	}
+
+	bool ModCollectionEntry::StoreModProfile(const Modio::ModInfo& ProfileData)
+	{
+		// Comparing the encoded bytes is cheaper than decoding the stored profile, and keeps the decoded profile of an
+		// entry whose profile did not change
+		std::vector<std::uint8_t> EncodedProfile = nlohmann::json::to_msgpack(nlohmann::json(ProfileData));
+		if (ModProfile != nullptr && EncodedProfile == *ModProfile)
+		{
+			return false;
+		}
+
+		Modio::Optional<Modio::FileMetadataID> ProfileModfileID;
+		if (ProfileData.FileInfo.has_value())
+		{
+			ProfileModfileID = ProfileData.FileInfo->MetadataId;
+		}
+		StoreEncodedModProfile(std::move(EncodedProfile), ProfileModfileID);
+#if MODIO_DEBUG
+		// Catches a ModInfo member that to_json does not write, which would otherwise be silently dropped
+		if (!(DecodeModProfile() == ProfileData))
+		{
+			Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::ModManagement,
+										"The stored profile of mod {} does not match the profile it was encoded from",
+										ID);
+		}
+#endif
+		return true;
+	}
+
+	void ModCollectionEntry::StoreEncodedModProfile(std::vector<std::uint8_t> EncodedProfile,
+													Modio::Optional<Modio::FileMetadataID> EncodedModfileID)
+	{
+		// Copies of this entry may still be using the previous profile, so it is replaced rather than modified
+		ModProfile = std::make_shared<const std::vector<std::uint8_t>>(std::move(EncodedProfile));
+		std::atomic_store(&DecodedModProfile, std::shared_ptr<const Modio::ModInfo>());
+		ModfileID = EncodedModfileID;
+	}
+
+	const std::vector<std::uint8_t>& ModCollectionEntry::GetEncodedModProfile() const
+	{
+		static const std::vector<std::uint8_t> NoEncodedProfile {};
+		return ModProfile != nullptr ? *ModProfile : NoEncodedProfile;
+	}
+
 	MODIOSDK_API std::uint8_t ModCollectionEntry::GetRetriesRemaining()
 	{
 		return RetriesRemainingThisSession;
@@ -48,14 +129,17 @@ namespace Modio
 	MODIOSDK_API void ModCollectionEntry::UpdateModProfile(Modio::ModInfo ProfileData)
 	{
 		// check version in metadata and set pending install if need be
-		if (ModProfile.FileInfo.has_value() && ProfileData.FileInfo.has_value())
+		if (ModfileID.has_value() && ProfileData.FileInfo.has_value())
 		{
-			if (ModProfile.FileInfo.value().MetadataId != ProfileData.FileInfo.value().MetadataId)
+			if (ModfileID.value() != ProfileData.FileInfo.value().MetadataId)
 			{
 				SetModState(Modio::ModState::UpdatePending);
 			}
 		}
-		ModProfile = ProfileData;
+		if (StoreModProfile(ProfileData))
+		{
+			MarkModified(PersistedField::Profile);
+		}
 	}
 
 	MODIOSDK_API std::uint8_t ModCollectionEntry::AddLocalUserSubscription(Modio::Optional<Modio::User> User)
@@ -70,6 +154,7 @@ namespace Modio
 			// confident the files are valid on reinstall.
 
 			LocalUserSubscriptions.insert(User->UserId);
+			MarkModified(PersistedField::Subscriptions);
 		}
 		return std::uint8_t(LocalUserSubscriptions.size());
 	}
@@ -79,6 +164,7 @@ namespace Modio
 		if (User.has_value())
 		{
 			LocalUserSubscriptions.erase(User->UserId);
+			MarkModified(PersistedField::Subscriptions);
 			if (LocalUserSubscriptions.size() == 0)
 			{
 				SetModState(ModState::UninstallPending);
@@ -108,6 +194,7 @@ namespace Modio
 		}
 
 		CurrentState.store(NewState);
+		MarkModified(PersistedField::State);
 	}
 
 	MODIOSDK_API Modio::ErrorCode ModCollectionEntry::GetLastError() const
@@ -162,6 +249,7 @@ namespace Modio
 			else if (Modio::ErrorCodeMatches(Reason, Modio::ErrorConditionTypes::ModInstallUnrecoverableError))
 			{
 				NeverRetryReason = Reason;
+				MarkModified(PersistedField::NeverRetryReason);
 			}
 			else
 			{
@@ -195,7 +283,46 @@ namespace Modio
 
 	MODIOSDK_API const Modio::ModInfo& ModCollectionEntry::GetModProfile() const
 	{
-		return ModProfile;
+		std::shared_ptr<const Modio::ModInfo> Decoded = std::atomic_load(&DecodedModProfile);
+		if (Decoded == nullptr)
+		{
+			// Readers of the collection may decode the profile at the same time. Only the first result is kept, so
+			// the reference returned to each of them stays valid until the profile is replaced
+			std::shared_ptr<const Modio::ModInfo> NewlyDecoded =
+				std::make_shared<const Modio::ModInfo>(DecodeModProfile());
+			if (std::atomic_compare_exchange_strong(&DecodedModProfile, &Decoded, NewlyDecoded))
+			{
+				Decoded = std::move(NewlyDecoded);
+			}
+		}
+		return *Decoded;
+	}
+
+	Modio::ModInfo ModCollectionEntry::DecodeModProfile() const
+	{
+		Modio::ModInfo DecodedProfile {};
+		// An entry created without a profile has nothing encoded, and keeps the empty profile
+		if (ModProfile == nullptr || ModProfile->empty())
+		{
+			return DecodedProfile;
+		}
+
+		nlohmann::json ProfileJson = nlohmann::json::from_msgpack(ModProfile->begin(), ModProfile->end(), true, false);
+		if (ProfileJson.is_discarded())
+		{
+			// The snapshot the profile was loaded from passed its CRC check, so this should not happen. The profile is
+			// left empty rather than failing, and is filled in again by the next external update
+			Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::ModManagement,
+										"Could not decode the stored profile of mod {}", ID);
+			return DecodedProfile;
+		}
+		from_json(ProfileJson, DecodedProfile);
+		return DecodedProfile;
+	}
+
+	MODIOSDK_API Modio::Optional<Modio::FileMetadataID> ModCollectionEntry::GetModfileID() const
+	{
+		return ModfileID;
 	}
 
 	MODIOSDK_API std::string ModCollectionEntry::GetPath() const
@@ -233,11 +360,13 @@ namespace Modio
 	MODIOSDK_API void ModCollectionEntry::UpdateSizeOnDisk(Modio::FileSize NewSize)
 	{
 		SizeOnDisk = NewSize;
+		MarkModified(PersistedField::SizeOnDisk);
 	}
 
 	MODIOSDK_API void ModCollectionEntry::UpdateModPath(std::string NewPath)
 	{
 		PathOnDisk = NewPath;
+		MarkModified(PersistedField::Path);
 	}
 
 	void RollbackTransactionImpl(Modio::ModCollectionEntry& Entry)
@@ -252,6 +381,7 @@ namespace Modio
 		else
 		{
 			Entry.CurrentState.store(Entry.RollbackState.take().value());
+			Entry.MarkModified(Modio::ModCollectionEntry::PersistedField::State);
 		}
 	}
 
@@ -269,20 +399,55 @@ namespace Modio
 		else
 		{
 			Entry.RollbackState = Entry.CurrentState.load();
+			Entry.MarkModified(Modio::ModCollectionEntry::PersistedField::State);
 		}
 	}
 
 	MODIOSDK_API Modio::ModCollectionEntry& ModCollectionEntry::operator=(const Modio::ModCollectionEntry& Other)
 	{
+		// Only the fields whose values change have to be saved again. An entry that now describes another mod is saved
+		// whole
+		std::uint32_t ChangedFields = ID != Other.ID ? PersistedField::All : 0;
+		if (CurrentState.load() != Other.CurrentState.load())
+		{
+			ChangedFields |= PersistedField::State;
+		}
+		if (ModProfile != Other.ModProfile && GetEncodedModProfile() != Other.GetEncodedModProfile())
+		{
+			ChangedFields |= PersistedField::Profile;
+		}
+		if (LocalUserSubscriptions != Other.LocalUserSubscriptions ||
+			LocalUserSubscriptionCount.load() != Other.LocalUserSubscriptionCount.load())
+		{
+			ChangedFields |= PersistedField::Subscriptions;
+		}
+		if (PathOnDisk != Other.PathOnDisk)
+		{
+			ChangedFields |= PersistedField::Path;
+		}
+		if (SizeOnDisk != Other.SizeOnDisk)
+		{
+			ChangedFields |= PersistedField::SizeOnDisk;
+		}
+
 		ID = Other.ID;
 		CurrentState.store(Other.CurrentState.load());
 		ModProfile = Other.ModProfile;
+		std::atomic_store(&DecodedModProfile, std::atomic_load(&Other.DecodedModProfile));
+		ModfileID = Other.ModfileID;
 		LocalUserSubscriptions = Other.LocalUserSubscriptions;
 		LocalUserSubscriptionCount.store(Other.LocalUserSubscriptionCount.load());
 		PathOnDisk = Other.PathOnDisk;
 		SizeOnDisk = Other.SizeOnDisk;
 		RetriesRemainingThisSession = Other.RetriesRemainingThisSession;
 		LastErrorCode = Other.LastErrorCode;
+		Revision.store(Other.Revision.load());
+		// The copied revision tells caches whether anything changed, while the journal needs the fields themselves
+		if (ChangedFields != 0)
+		{
+			UnsavedFields.fetch_or(ChangedFields);
+			Modio::Detail::ModCollectionJournal::NotifyEntryChanged(ID);
+		}
 		return *this;
 	}
 
@@ -394,12 +559,20 @@ namespace Modio
 
 	bool BaseModList::AddMod(Modio::ModInfo Mod)
 	{
-		return InternalList.insert(Mod.ModId).second;
+		if (InternalList.insert(Mod.ModId).second)
+		{
+			MarkModified();
+			return true;
+		}
+		return false;
 	}
 
 	void BaseModList::RemoveMod(Modio::ModID Mod)
 	{
-		InternalList.erase(Mod);
+		if (InternalList.erase(Mod))
+		{
+			MarkModified();
+		}
 	}
 
 	const std::set<Modio::ModID>& BaseModList::Get() const
@@ -409,9 +582,22 @@ namespace Modio
 
 	std::set<Modio::ModID>& BaseModList::Get() 
 	{
+		MarkModified();
 		return InternalList;
 	}
 
+	std::uint64_t BaseModList::GetRevision() const
+	{
+		return Revision;
+	}
+
+	void BaseModList::MarkModified()
+	{
+		// Shared by all lists, so a list that is replaced by another never appears unchanged
+		static std::atomic<std::uint64_t> LastRevision {};
+		Revision = ++LastRevision;
+	}
+
 	MODIOSDK_API std::map<Modio::ModID, Modio::UserSubscriptionList::ChangeType> UserSubscriptionList::CalculateChanges(
 		const Modio::UserSubscriptionList& Original, const Modio::UserSubscriptionList& Updated)
 	{
@@ -450,16 +636,16 @@ namespace Modio
 		{
 			if (Modio::Optional<Modio::ModCollectionEntry&> FoundEntry = Collection.GetByModID(Profile.ModId))
 			{
-				const Modio::ModInfo& LocalInfo = FoundEntry->GetModProfile();
+				Modio::Optional<Modio::FileMetadataID> LocalModfileID = FoundEntry->GetModfileID();
 
 				// If one or the other doesnt have a file info, continue
-				if (!LocalInfo.FileInfo || !Profile.FileInfo)
+				if (!LocalModfileID || !Profile.FileInfo)
 				{
 					continue;
 				}
 
 				// Check the file metadata IDs
-				if (LocalInfo.FileInfo->MetadataId != Profile.FileInfo->MetadataId)
+				if (LocalModfileID.value() != Profile.FileInfo->MetadataId)
 				{
 					Diff[Profile.ModId] = Modio::UserSubscriptionList::ChangeType::Updated;
 				}
@@ -477,6 +663,7 @@ namespace Modio
 			ModEntries.emplace(
 				std::make_pair(ModEntry.first, std::make_shared<Modio::ModCollectionEntry>(*ModEntry.second)));
 		}
+		MarkModified();
 	}
 	MODIOSDK_API const Modio::ModCollection ModCollection::FilterByUserSubscriptions(
 		const UserSubscriptionList& UserSubscriptions) const
@@ -505,6 +692,7 @@ namespace Modio
 		if (ModEntries.find(ModToAdd.ModId) == ModEntries.end())
 		{
 			ModEntries[ModToAdd.ModId] = std::make_shared<Modio::ModCollectionEntry>(ModToAdd, CalculatedModPath);
+			MarkModified();
 			return true;
 		}
 		else
@@ -551,9 +739,22 @@ namespace Modio
 
 	MODIOSDK_API std::map<Modio::ModID, std::shared_ptr<Modio::ModCollectionEntry>>& ModCollection::Entries()
 	{
+		MarkModified();
 		return ModEntries;
 	}
 
+	MODIOSDK_API std::uint64_t ModCollection::GetRevision() const
+	{
+		return Revision;
+	}
+
+	void ModCollection::MarkModified()
+	{
+		// Shared by all collections, so a collection that is replaced by another never appears unchanged
+		static std::atomic<std::uint64_t> LastRevision {};
+		Revision = ++LastRevision;
+	}
+
 	MODIOSDK_API Modio::Optional<Modio::ModCollectionEntry&> ModCollection::GetByModID(Modio::ModID ModId) const
 	{
 		if (ModEntries.count(ModId))
@@ -573,6 +774,8 @@ namespace Modio
 			if ((ModEntries.at(ModId)->GetModState() == ModState::UninstallPending) || (bForce == true))
 			{
 				ModEntries.erase(ModId);
+				MarkModified();
+				Modio::Detail::ModCollectionJournal::NotifyEntryChanged(ModId);
 				return true;
 			}
 			else
@@ -0,0 +1,162 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Modio
+{
+	/// @docpublic
+	/// @brief Distribution of a set of durations the SDK has recorded. Percentiles are estimated from a histogram
+	/// and are accurate to within 1/8th of their value
+	struct DurationStats
+	{
+		/// @docpublic
+		/// @brief Number of durations recorded
+		std::uint64_t Count = 0;
+
+		/// @docpublic
+		/// @brief Mean of the recorded durations
+		std::chrono::microseconds Mean {};
+
+		/// @docpublic
+		/// @brief Median of the recorded durations
+		std::chrono::microseconds P50 {};
+
+		/// @docpublic
+		/// @brief 95th percentile of the recorded durations
+		std::chrono::microseconds P95 {};
+
+		/// @docpublic
+		/// @brief 99th percentile of the recorded durations
+		std::chrono::microseconds P99 {};
+
+		/// @docpublic
+		/// @brief Longest recorded duration
+		std::chrono::microseconds Max {};
+	};
+
+	/// @docpublic
+	/// @brief State of one of the queues the SDK uses to run operations of the same kind one at a time
+	struct OperationQueueStats
+	{
+		/// @docpublic
+		/// @brief Name of the queue
+		std::string Name {};
+
+		/// @docpublic
+		/// @brief Number of operations currently waiting for their turn
+		std::uint32_t Depth = 0;
+
+		/// @docpublic
+		/// @brief Largest number of operations that have waited on the queue at once
+		std::uint32_t MaxDepth = 0;
+
+		/// @docpublic
+		/// @brief How long operations waited for their turn, including those that did not have to wait
+		Modio::DurationStats Wait {};
+	};
+
+	/// @docpublic
+	/// @brief Amount of data the SDK has processed in one stage of installing mods
+	struct ThroughputStats
+	{
+		/// @docpublic
+		/// @brief Total number of bytes processed since the SDK was loaded
+		std::uint64_t TotalBytes = 0;
+
+		/// @docpublic
+		/// @brief Average number of bytes processed per second over the last few seconds
+		double RecentBytesPerSecond = 0;
+	};
+
+	/// @docpublic
+	/// @brief Snapshot of counters the SDK maintains about its own work, for diagnosing performance in a running game.
+	/// Counters are kept for the lifetime of the process and are not reset by Modio::ShutdownAsync
+	struct RuntimeStats
+	{
+		/// @docpublic
+		/// @brief State of each of the SDK's operation queues
+		std::vector<Modio::OperationQueueStats> Queues {};
+
+		/// @docpublic
+		/// @brief Time taken by GET requests to the REST API, from sending the request to receiving the whole
+		/// response. Requests answered from the response cache are not included
+		Modio::DurationStats HttpQueryLatency {};
+
+		/// @docpublic
+		/// @brief Time taken by POST, PUT and DELETE requests to the REST API that do not upload a file
+		Modio::DurationStats HttpMutationLatency {};
+
+		/// @docpublic
+		/// @brief Time taken by requests that upload a file, including the upload itself
+		Modio::DurationStats HttpUploadLatency {};
+
+		/// @docpublic
+		/// @brief Time taken by file downloads to receive the response headers, following redirects
+		Modio::DurationStats HttpDownloadLatency {};
+
+		/// @docpublic
+		/// @brief Mod and image data received by file downloads
+		Modio::ThroughputStats Download {};
+
+		/// @docpublic
+		/// @brief Data written out while extracting mod archives
+		Modio::ThroughputStats Extract {};
+
+		/// @docpublic
+		/// @brief Number of REST API responses served from the response cache
+		std::uint64_t ResponseCacheHits = 0;
+
+		/// @docpublic
+		/// @brief Number of REST API requests that could have used the response cache but found no entry for them
+		std::uint64_t ResponseCacheMisses = 0;
+
+		/// @docpublic
+		/// @brief Number of mod profiles served from the mod cache
+		std::uint64_t ModCacheHits = 0;
+
+		/// @docpublic
+		/// @brief Number of mod profiles looked up in the mod cache but not found there
+		std::uint64_t ModCacheMisses = 0;
+
+		/// @docpublic
+		/// @brief Number of bytes the SDK has asked to read from files. A read that reaches the end of the file before
+		/// it has read as much as it asked for is still counted in full
+		std::uint64_t FileBytesRead = 0;
+
+		/// @docpublic
+		/// @brief Number of bytes written to files by the SDK
+		std::uint64_t FileBytesWritten = 0;
+
+		/// @docpublic
+		/// @brief Number of memory blocks allocated from the system for the buffers the SDK reads, writes and
+		/// downloads data through, and for the state of its operations. Dividing by Download.TotalBytes gives the
+		/// allocations made per byte downloaded
+		std::uint64_t PoolBlocksAllocated = 0;
+
+		/// @docpublic
+		/// @brief Number of those memory blocks reused from ones the SDK had already freed instead of being allocated
+		std::uint64_t PoolBlocksReused = 0;
+
+		/// @docpublic
+		/// @brief Time spent in each call to Modio::RunPendingHandlers. When the SDK runs its own worker thread this
+		/// only covers running the callbacks the worker queued
+		Modio::DurationStats RunPendingHandlersTime {};
+
+		/// @docpublic
+		/// @brief Number of log messages dropped because they were logged faster than they were flushed
+		std::uint64_t DroppedLogMessages = 0;
+	};
+} // namespace Modio
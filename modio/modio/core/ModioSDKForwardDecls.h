@@ -25,6 +25,7 @@ namespace Modio
 	class UserSubscriptionList;
 	struct ModManagementEvent;
 	struct StorageInfo;
+	struct RuntimeStats;
 	class ModProgressInfo;
 	class ModCollectionEntry;
 	struct User;
@@ -42,6 +42,7 @@ namespace Modio
 					{
 						TempModIdsToInstall.push_back(Id);
 					}
+					Modio::Detail::SDKSessionData::MarkTempModSetModified();
 				}
 			}
 		}
@@ -54,6 +55,7 @@ namespace Modio
 				if (iterModID != ModIds.end())
 				{
 					ModIds.erase(iterModID);
+					Modio::Detail::SDKSessionData::MarkTempModSetModified();
 
 					if (Modio::Detail::SDKSessionData::GetTempModCollection()
 														   .GetByModID(Id)
@@ -94,6 +96,7 @@ namespace Modio
 			{
 				ModIds.push_back(ModInfoData.ModId);
 				TempModIdsToInstall.erase(iterModID);
+				Modio::Detail::SDKSessionData::MarkTempModSetModified();
 
 				Modio::Detail::SDKSessionData::GetTempModCollection().AddOrUpdateMod(
 					ModInfoData, Modio::ToModioString(Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
@@ -56,6 +56,8 @@ namespace Modio
 		std::uint64_t FilesizeUncompressed = 0;
 		/// @brief Filename including extension.
 		std::string Filename {};
+		/// @brief MD5 hash of the file, as lowercase hexadecimal. Empty if the server did not provide one.
+		std::string FilehashMD5 {};
 		/// @brief Release version this file represents.
 		std::string Version {};
 		/// @brief Changelog for the file.
@@ -73,7 +75,7 @@ namespace Modio
 			if ((A.MetadataId == B.MetadataId) && (A.ModId == B.ModId) && (A.DateAdded == B.DateAdded) &&
 				(A.CurrentVirusScanStatus == B.CurrentVirusScanStatus) &&
 				(A.CurrentVirusStatus == B.CurrentVirusStatus) && (A.Filesize == B.Filesize) &&
-				(A.Filename == B.Filename) && (A.Version == B.Version) && (A.Changelog == B.Changelog) &&
+				(A.Filename == B.Filename) && (A.FilehashMD5 == B.FilehashMD5) && (A.Version == B.Version) && (A.Changelog == B.Changelog) &&
 				(A.MetadataBlob == B.MetadataBlob) && (A.DownloadBinaryURL == B.DownloadBinaryURL) &&
 				(A.DownloadExpiryDate == B.DownloadExpiryDate) && (A.FilesizeUncompressed == B.FilesizeUncompressed))
 			{
@@ -143,7 +143,8 @@ namespace Modio
 				(A.ProfileDateUpdated == B.ProfileDateUpdated) && (A.ProfileDateLive == B.ProfileDateLive) &&
 				(A.MetadataBlob == B.MetadataBlob) && (A.MetadataKvp == B.MetadataKvp) && (A.Tags == B.Tags) &&
 				(A.YoutubeURLs == B.YoutubeURLs) && (A.Stats == B.Stats) && (A.ModLogo == B.ModLogo) &&
-				(A.ModStatus == B.ModStatus) && (A.Visibility == B.Visibility) && (A.Dependencies == B.Dependencies))
+				(A.ModStatus == B.ModStatus) && (A.Visibility == B.Visibility) && (A.Price == B.Price) &&
+				(A.SKUMappings == B.SKUMappings) && (A.Dependencies == B.Dependencies))
 			{
 				if (A.FileInfo.has_value() && B.FileInfo.has_value())
 				{
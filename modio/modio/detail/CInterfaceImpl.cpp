@@ -6552,6 +6552,12 @@ MODIODLL_EXPORT void ModioRunPendingHandlers()
 }	
 
 
+MODIODLL_EXPORT void ModioDispatchCallbacks()
+{
+	Modio::DispatchCallbacks();
+}	
+
+
 MODIODLL_EXPORT CModioModCollectionMap* ModioQueryUserSubscriptions()
 {
 	return new CModioModCollectionMap{ Modio::QueryUserSubscriptions()};
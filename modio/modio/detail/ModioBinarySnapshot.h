@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioCoreTypes.h"
+#include "modio/detail/JsonWrapper.h"
+#include <cstdint>
+#include <string>
+
+namespace Modio
+{
+	class ModCollection;
+
+	namespace Detail
+	{
+		class Buffer;
+
+		/// @brief Kind of data held by a binary snapshot, stored in its header so one is never loaded as the other
+		enum class BinarySnapshotType : std::uint32_t
+		{
+			ModCollection = 1,
+			UserData = 2
+		};
+
+		/// @brief Appends little endian integers and length-prefixed byte strings to a snapshot being written
+		class BinarySnapshotWriter
+		{
+		public:
+			MODIO_IMPL void WriteU32(std::uint32_t Value);
+			MODIO_IMPL void WriteU64(std::uint64_t Value);
+			MODIO_IMPL void WriteI64(std::int64_t Value);
+			/// @brief Writes the size of the bytes as a U32, then the bytes themselves
+			MODIO_IMPL void WriteBytes(const void* Data, std::size_t Size);
+			MODIO_IMPL void WriteString(const std::string& Value);
+
+			/// @brief Number of bytes written so far, which is also the offset of the next byte written
+			MODIO_IMPL std::size_t GetSize() const;
+
+			/// @brief Overwrites a U32 written earlier, for sizes that are only known once what follows is written
+			MODIO_IMPL void PatchU32(std::size_t Offset, std::uint32_t Value);
+
+			MODIO_IMPL const std::string& GetData() const;
+
+		private:
+			std::string Data {};
+		};
+
+		/// @brief Reads the values written by BinarySnapshotWriter back. Every read fails, leaving the output
+		/// unchanged, if the snapshot is too short to hold the value
+		class BinarySnapshotReader
+		{
+		public:
+			MODIO_IMPL BinarySnapshotReader(const unsigned char* Data, std::size_t Size);
+
+			MODIO_IMPL bool ReadU32(std::uint32_t& Value);
+			MODIO_IMPL bool ReadU64(std::uint64_t& Value);
+			MODIO_IMPL bool ReadI64(std::int64_t& Value);
+			/// @brief Reads a length-prefixed byte string without copying it
+			MODIO_IMPL bool ReadBytes(const unsigned char*& BytesStart, std::size_t& BytesSize);
+			MODIO_IMPL bool ReadString(std::string& Value);
+			MODIO_IMPL bool Skip(std::size_t NumBytes);
+
+			MODIO_IMPL std::size_t GetOffset() const;
+			MODIO_IMPL std::size_t GetRemaining() const;
+
+		private:
+			const unsigned char* Data = nullptr;
+			std::size_t Size = 0;
+			std::size_t Offset = 0;
+		};
+
+		/// @brief true if the buffer starts with a binary snapshot header rather than JSON
+		MODIO_IMPL bool IsBinarySnapshot(const Modio::Detail::Buffer& SnapshotData);
+
+		/// @brief Writes the system mod collection as a binary snapshot.
+		///
+		/// The snapshot header is followed by the journal generation and the number of entries. Each entry is
+		/// prefixed with its size so readers can skip fields added by later versions. The hot fields of an entry are
+		/// stored flat: ID, state, size on disk, never-retry reason, modfile ID, local subscriptions and path. The
+		/// profile is stored last as the MessagePack blob the entry keeps it in, so neither saving nor loading the
+		/// snapshot decodes it.
+		/// @param JournalGeneration Generation of the mod collection journal that applies on top of the snapshot
+		MODIO_IMPL Modio::Detail::Buffer EncodeModCollectionSnapshot(const Modio::ModCollection& Collection,
+																	 std::uint64_t JournalGeneration);
+
+		/// @brief Loads a snapshot written by EncodeModCollectionSnapshot into the collection
+		/// @return false if the data is not a valid mod collection snapshot, in which case the collection is left
+		/// unchanged
+		MODIO_IMPL bool DecodeModCollectionSnapshot(const Modio::Detail::Buffer& SnapshotData,
+													Modio::ModCollection& Collection,
+													std::uint64_t& JournalGeneration);
+
+		/// @brief Wraps a JSON document in a binary snapshot, encoded as MessagePack. Used for data that is small
+		/// but is still read back on every startup
+		MODIO_IMPL Modio::Detail::Buffer EncodeJsonSnapshot(Modio::Detail::BinarySnapshotType Type,
+															const nlohmann::json& Document);
+
+		/// @brief Reads the document back from a snapshot written by EncodeJsonSnapshot
+		/// @return The document, or a discarded value if the data is not a valid snapshot of that type
+		MODIO_IMPL nlohmann::json DecodeJsonSnapshot(Modio::Detail::BinarySnapshotType Type,
+													 const Modio::Detail::Buffer& SnapshotData);
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioBinarySnapshot.ipp"
+#endif
@@ -0,0 +1,400 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioBinarySnapshot.h"
+#endif
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioErrorCode.h"
+#include "modio/core/ModioLogger.h"
+#include "modio/core/ModioModCollectionEntry.h"
+#include "modio/detail/ModioCRC.h"
+#include "modio/detail/serialization/ModioModCollectionEntrySerialization.h"
+#include <algorithm>
+#include <vector>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		constexpr unsigned char BinarySnapshotMagic[4] = {'M', 'S', 'N', 'P'};
+		// Bumped whenever the layout of a snapshot changes in a way older readers cannot skip over. Snapshots of any
+		// other version are rejected, and the SDK falls back to the JSON files
+		constexpr std::uint32_t BinarySnapshotFormatVersion = 1;
+		// Magic, type, format version, size of the body and CRC32 of the body
+		constexpr std::size_t BinarySnapshotHeaderSize = 4 + 4 + 4 + 8 + 4;
+
+		void BinarySnapshotWriter::WriteU32(std::uint32_t Value)
+		{
+			for (std::size_t ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+			{
+				Data.push_back(static_cast<char>(Value >> (8 * ByteIndex)));
+			}
+		}
+
+		void BinarySnapshotWriter::WriteU64(std::uint64_t Value)
+		{
+			for (std::size_t ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+			{
+				Data.push_back(static_cast<char>(Value >> (8 * ByteIndex)));
+			}
+		}
+
+		void BinarySnapshotWriter::WriteI64(std::int64_t Value)
+		{
+			WriteU64(static_cast<std::uint64_t>(Value));
+		}
+
+		void BinarySnapshotWriter::WriteBytes(const void* Bytes, std::size_t BytesSize)
+		{
+			WriteU32(static_cast<std::uint32_t>(BytesSize));
+			Data.append(static_cast<const char*>(Bytes), BytesSize);
+		}
+
+		void BinarySnapshotWriter::WriteString(const std::string& Value)
+		{
+			WriteBytes(Value.data(), Value.size());
+		}
+
+		std::size_t BinarySnapshotWriter::GetSize() const
+		{
+			return Data.size();
+		}
+
+		void BinarySnapshotWriter::PatchU32(std::size_t Offset, std::uint32_t Value)
+		{
+			for (std::size_t ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+			{
+				Data[Offset + ByteIndex] = static_cast<char>(Value >> (8 * ByteIndex));
+			}
+		}
+
+		const std::string& BinarySnapshotWriter::GetData() const
+		{
+			return Data;
+		}
+
+		BinarySnapshotReader::BinarySnapshotReader(const unsigned char* Data, std::size_t Size)
+			: Data(Data),
+			  Size(Size)
+		{}
+
+		bool BinarySnapshotReader::ReadU32(std::uint32_t& Value)
+		{
+			if (GetRemaining() < 4)
+			{
+				return false;
+			}
+			Value = 0;
+			for (std::size_t ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+			{
+				Value |= std::uint32_t(Data[Offset++]) << (8 * ByteIndex);
+			}
+			return true;
+		}
+
+		bool BinarySnapshotReader::ReadU64(std::uint64_t& Value)
+		{
+			if (GetRemaining() < 8)
+			{
+				return false;
+			}
+			Value = 0;
+			for (std::size_t ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+			{
+				Value |= std::uint64_t(Data[Offset++]) << (8 * ByteIndex);
+			}
+			return true;
+		}
+
+		bool BinarySnapshotReader::ReadI64(std::int64_t& Value)
+		{
+			std::uint64_t RawValue = 0;
+			if (!ReadU64(RawValue))
+			{
+				return false;
+			}
+			Value = static_cast<std::int64_t>(RawValue);
+			return true;
+		}
+
+		bool BinarySnapshotReader::ReadBytes(const unsigned char*& BytesStart, std::size_t& BytesSize)
+		{
+			std::size_t StartOffset = Offset;
+			std::uint32_t Length = 0;
+			if (!ReadU32(Length) || GetRemaining() < Length)
+			{
+				Offset = StartOffset;
+				return false;
+			}
+			BytesStart = Data + Offset;
+			BytesSize = Length;
+			Offset += Length;
+			return true;
+		}
+
+		bool BinarySnapshotReader::ReadString(std::string& Value)
+		{
+			const unsigned char* BytesStart = nullptr;
+			std::size_t BytesSize = 0;
+			if (!ReadBytes(BytesStart, BytesSize))
+			{
+				return false;
+			}
+			Value.assign(reinterpret_cast<const char*>(BytesStart), BytesSize);
+			return true;
+		}
+
+		bool BinarySnapshotReader::Skip(std::size_t NumBytes)
+		{
+			if (GetRemaining() < NumBytes)
+			{
+				return false;
+			}
+			Offset += NumBytes;
+			return true;
+		}
+
+		std::size_t BinarySnapshotReader::GetOffset() const
+		{
+			return Offset;
+		}
+
+		std::size_t BinarySnapshotReader::GetRemaining() const
+		{
+			return Size - Offset;
+		}
+
+		inline Modio::Detail::Buffer FinishBinarySnapshot(Modio::Detail::BinarySnapshotType Type,
+														  const std::string& Body)
+		{
+			Modio::Detail::Buffer Snapshot(BinarySnapshotHeaderSize + Body.size());
+			std::copy(Body.begin(), Body.end(), Snapshot.begin() + BinarySnapshotHeaderSize);
+
+			BinarySnapshotWriter Header;
+			Header.WriteU32(static_cast<std::uint32_t>(Type));
+			Header.WriteU32(BinarySnapshotFormatVersion);
+			Header.WriteU64(Body.size());
+			Header.WriteU32(Modio::Detail::CRC32(reinterpret_cast<const unsigned char*>(Body.data()), Body.size()));
+
+			std::copy(std::begin(BinarySnapshotMagic), std::end(BinarySnapshotMagic), Snapshot.begin());
+			std::copy(Header.GetData().begin(), Header.GetData().end(), Snapshot.begin() + 4);
+			return Snapshot;
+		}
+
+		/// @brief Validates the header of a snapshot
+		/// @return A reader over the body of the snapshot, or empty if the snapshot is not valid
+		inline Modio::Optional<BinarySnapshotReader> OpenBinarySnapshot(Modio::Detail::BinarySnapshotType Type,
+																		const Modio::Detail::Buffer& SnapshotData)
+		{
+			if (!IsBinarySnapshot(SnapshotData))
+			{
+				return {};
+			}
+
+			BinarySnapshotReader HeaderReader(SnapshotData.Data(), SnapshotData.GetSize());
+			std::uint32_t SnapshotType = 0;
+			std::uint32_t FormatVersion = 0;
+			std::uint64_t BodySize = 0;
+			std::uint32_t BodyCRC = 0;
+			HeaderReader.Skip(4);
+			if (!HeaderReader.ReadU32(SnapshotType) || !HeaderReader.ReadU32(FormatVersion) ||
+				!HeaderReader.ReadU64(BodySize) || !HeaderReader.ReadU32(BodyCRC))
+			{
+				return {};
+			}
+
+			if (SnapshotType != static_cast<std::uint32_t>(Type) || FormatVersion != BinarySnapshotFormatVersion ||
+				BodySize != HeaderReader.GetRemaining())
+			{
+				Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::Core,
+											"Ignoring snapshot of type {} version {} with a {} byte body",
+											SnapshotType, FormatVersion, BodySize);
+				return {};
+			}
+
+			// The CRC is checked up front so the parts of the snapshot that are decoded later can be trusted
+			if (Modio::Detail::CRC32(SnapshotData.Data() + BinarySnapshotHeaderSize,
+									 static_cast<std::size_t>(BodySize)) != BodyCRC)
+			{
+				Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::Core,
+											"Ignoring corrupt snapshot of type {}", SnapshotType);
+				return {};
+			}
+
+			return BinarySnapshotReader(SnapshotData.Data() + BinarySnapshotHeaderSize,
+										static_cast<std::size_t>(BodySize));
+		}
+
+		bool IsBinarySnapshot(const Modio::Detail::Buffer& SnapshotData)
+		{
+			return SnapshotData.GetSize() >= BinarySnapshotHeaderSize &&
+				   std::equal(std::begin(BinarySnapshotMagic), std::end(BinarySnapshotMagic), SnapshotData.Data());
+		}
+
+		Modio::Detail::Buffer EncodeModCollectionSnapshot(const Modio::ModCollection& Collection,
+														  std::uint64_t JournalGeneration)
+		{
+			BinarySnapshotWriter Writer;
+			Writer.WriteU64(JournalGeneration);
+			Writer.WriteU32(static_cast<std::uint32_t>(Collection.Entries().size()));
+
+			for (const auto& Mod : Collection.Entries())
+			{
+				const Modio::ModCollectionEntry& Entry = *Mod.second;
+				Modio::ModCollectionEntryConstAccessor Helper(Entry);
+
+				std::size_t EntrySizeOffset = Writer.GetSize();
+				Writer.WriteU32(0);
+
+				Writer.WriteI64(Entry.GetID());
+				Writer.WriteU32(static_cast<std::uint32_t>(Modio::GetPersistentModState(Entry)));
+				Writer.WriteU64(Entry.GetRawSizeOnDisk());
+				Writer.WriteI64(Entry.GetNeverRetryReason().value());
+				Writer.WriteU64(Modio::Detail::ModioErrorCategoryID(Entry.GetNeverRetryReason().category()));
+
+				Modio::Optional<Modio::FileMetadataID> ModfileID = Entry.GetModfileID();
+				Writer.WriteU32(ModfileID.has_value() ? 1 : 0);
+				Writer.WriteI64(ModfileID.has_value() ? std::int64_t(ModfileID.value()) : 0);
+
+				std::set<Modio::UserID> LocalUserSubscriptions = Entry.GetLocalUserSubscriptions();
+				Writer.WriteU32(static_cast<std::uint32_t>(LocalUserSubscriptions.size()));
+				for (Modio::UserID Subscriber : LocalUserSubscriptions)
+				{
+					Writer.WriteI64(Subscriber);
+				}
+
+				Writer.WriteString(Entry.GetPath());
+
+				const std::vector<std::uint8_t>& EncodedProfile = Helper.GetEncodedModProfile();
+				Writer.WriteBytes(EncodedProfile.data(), EncodedProfile.size());
+
+				Writer.PatchU32(EntrySizeOffset,
+								static_cast<std::uint32_t>(Writer.GetSize() - EntrySizeOffset - sizeof(std::uint32_t)));
+			}
+
+			return FinishBinarySnapshot(Modio::Detail::BinarySnapshotType::ModCollection, Writer.GetData());
+		}
+
+		bool DecodeModCollectionSnapshot(const Modio::Detail::Buffer& SnapshotData, Modio::ModCollection& Collection,
+										 std::uint64_t& JournalGeneration)
+		{
+			Modio::Optional<BinarySnapshotReader> Reader =
+				OpenBinarySnapshot(Modio::Detail::BinarySnapshotType::ModCollection, SnapshotData);
+			if (!Reader.has_value())
+			{
+				return false;
+			}
+
+			std::uint64_t SnapshotGeneration = 0;
+			std::uint32_t NumEntries = 0;
+			if (!Reader->ReadU64(SnapshotGeneration) || !Reader->ReadU32(NumEntries))
+			{
+				return false;
+			}
+
+			std::map<Modio::ModID, std::shared_ptr<Modio::ModCollectionEntry>> LoadedEntries;
+			for (std::uint32_t EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+			{
+				std::uint32_t EntrySize = 0;
+				if (!Reader->ReadU32(EntrySize) || Reader->GetRemaining() < EntrySize)
+				{
+					return false;
+				}
+				std::size_t EntryEnd = Reader->GetOffset() + EntrySize;
+
+				Modio::ModCollectionEntry Entry;
+				Modio::ModCollectionEntryAccessor Helper(Entry);
+
+				std::int64_t ModID = 0;
+				std::uint32_t State = 0;
+				std::uint64_t SizeOnDisk = 0;
+				std::int64_t NeverRetryCode = 0;
+				std::uint64_t NeverRetryCategory = 0;
+				std::uint32_t bHasModfileID = 0;
+				std::int64_t ModfileID = 0;
+				std::uint32_t NumSubscriptions = 0;
+				if (!Reader->ReadI64(ModID) || !Reader->ReadU32(State) || !Reader->ReadU64(SizeOnDisk) ||
+					!Reader->ReadI64(NeverRetryCode) || !Reader->ReadU64(NeverRetryCategory) ||
+					!Reader->ReadU32(bHasModfileID) || !Reader->ReadI64(ModfileID) ||
+					!Reader->ReadU32(NumSubscriptions))
+				{
+					return false;
+				}
+
+				Helper.GetID() = Modio::ModID(ModID);
+				Helper.GetCurrentState().store(static_cast<Modio::ModState>(State));
+				Helper.GetRawSizeOnDisk() = Modio::FileSize(SizeOnDisk);
+				Helper.GetNeverRetryReason() =
+					std::error_code(static_cast<int>(NeverRetryCode),
+									Modio::Detail::GetModioErrorCategoryByID(NeverRetryCategory));
+
+				for (std::uint32_t SubscriptionIndex = 0; SubscriptionIndex < NumSubscriptions; ++SubscriptionIndex)
+				{
+					std::int64_t Subscriber = 0;
+					if (!Reader->ReadI64(Subscriber))
+					{
+						return false;
+					}
+					Helper.GetLocalUserSubscriptions().insert(Modio::UserID(Subscriber));
+				}
+
+				const unsigned char* ProfileStart = nullptr;
+				std::size_t ProfileSize = 0;
+				if (!Reader->ReadString(Helper.GetPath()) || !Reader->ReadBytes(ProfileStart, ProfileSize) ||
+					Reader->GetOffset() > EntryEnd)
+				{
+					return false;
+				}
+				Modio::Optional<Modio::FileMetadataID> EntryModfileID;
+				if (bHasModfileID)
+				{
+					EntryModfileID = Modio::FileMetadataID(ModfileID);
+				}
+				Helper.SetEncodedModProfile(std::vector<std::uint8_t>(ProfileStart, ProfileStart + ProfileSize),
+											EntryModfileID);
+
+				// Fields appended by later versions of the format are skipped
+				Reader->Skip(EntryEnd - Reader->GetOffset());
+
+				// Copied like entries loaded from JSON, which also resets the retries available this session
+				LoadedEntries[Entry.GetID()] = std::make_shared<Modio::ModCollectionEntry>(Entry);
+			}
+
+			for (auto& LoadedEntry : LoadedEntries)
+			{
+				Collection.Entries()[LoadedEntry.first] = LoadedEntry.second;
+			}
+			JournalGeneration = SnapshotGeneration;
+			return true;
+		}
+
+		Modio::Detail::Buffer EncodeJsonSnapshot(Modio::Detail::BinarySnapshotType Type,
+												 const nlohmann::json& Document)
+		{
+			std::vector<std::uint8_t> EncodedDocument = nlohmann::json::to_msgpack(Document);
+			return FinishBinarySnapshot(Type, std::string(EncodedDocument.begin(), EncodedDocument.end()));
+		}
+
+		nlohmann::json DecodeJsonSnapshot(Modio::Detail::BinarySnapshotType Type,
+										  const Modio::Detail::Buffer& SnapshotData)
+		{
+			Modio::Optional<BinarySnapshotReader> Reader = OpenBinarySnapshot(Type, SnapshotData);
+			if (!Reader.has_value())
+			{
+				return nlohmann::json(nlohmann::json::value_t::discarded);
+			}
+
+			const unsigned char* DocumentStart = SnapshotData.Data() + BinarySnapshotHeaderSize;
+			return nlohmann::json::from_msgpack(DocumentStart, DocumentStart + Reader->GetRemaining(), true, false);
+		}
+	} // namespace Detail
+} // namespace Modio
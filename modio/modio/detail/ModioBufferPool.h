@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioSplitCompilation.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Pool of the memory blocks backing Modio::Detail::Buffer and the state of asynchronous operations.
+		/// Blocks are sized in powers of two from 64 bytes to 2MiB, and are aligned to their size up to 4KiB so that
+		/// aligned buffers need no padding. A freed block is kept in a cache belonging to the thread that freed it, and
+		/// overflows into a free list shared by all threads, so a download or extraction that repeatedly allocates and
+		/// frees objects of the same size reuses the same few blocks. Larger blocks are not pooled
+		class BufferPool
+		{
+		public:
+			/// @brief Size class of blocks that were allocated directly rather than taken from the pool
+			static constexpr std::uint8_t Unpooled = 0xFF;
+
+			/// @brief Largest alignment a block can be allocated with
+			static constexpr std::size_t MaxAlignment = 4 * 1024;
+
+			/// @brief Allocates a block of at least Size bytes. The contents of the block are unspecified
+			/// @param OutSizeClass Receives the size class of the block, which must be passed to Deallocate
+			/// @param Alignment Alignment of the block. Must be a power of two no greater than MaxAlignment
+			MODIO_IMPL static unsigned char* Allocate(std::size_t Size, std::uint8_t& OutSizeClass,
+													  std::size_t Alignment = 1);
+
+			MODIO_IMPL static void Deallocate(unsigned char* Block, std::uint8_t SizeClass);
+
+			/// @return The size class for a block of Size bytes, or Unpooled if it is too large to pool
+			MODIO_IMPL static std::uint8_t GetSizeClass(std::size_t Size);
+
+		private:
+			static constexpr std::size_t MinSizeClassBits = 6;
+			static constexpr std::size_t MaxSizeClassBits = 21;
+			static constexpr std::size_t NumSizeClasses = MaxSizeClassBits - MinSizeClassBits + 1;
+
+			struct FreeList
+			{
+				std::mutex Mutex {};
+				std::vector<unsigned char*> Blocks {};
+			};
+
+			/// @brief Free lists shared by every thread, one per size class
+			class GlobalFreeLists
+			{
+			public:
+				MODIO_IMPL static GlobalFreeLists& Get();
+
+				MODIO_IMPL ~GlobalFreeLists();
+
+				/// @return A block from the free list, or nullptr if it is empty
+				MODIO_IMPL unsigned char* Pop(std::uint8_t SizeClass);
+
+				/// @return false if the free list is full, in which case the caller frees the block
+				MODIO_IMPL bool Push(unsigned char* Block, std::uint8_t SizeClass);
+
+				/// @brief Set once the free lists are destroyed at exit, after which blocks are freed directly
+				MODIO_IMPL static std::atomic<bool>& IsDestroyed();
+
+			private:
+				std::array<FreeList, NumSizeClasses> Lists {};
+			};
+
+			/// @brief Blocks freed by the current thread, taken without locking by later allocations on that thread
+			class ThreadCache
+			{
+			public:
+				MODIO_IMPL ThreadCache();
+
+				/// @brief Returns the cached blocks to the global free lists when the thread exits
+				MODIO_IMPL ~ThreadCache();
+
+				/// @return The current thread's cache, or nullptr if it has already been destroyed
+				MODIO_IMPL static ThreadCache* Get();
+
+				MODIO_IMPL unsigned char* Pop(std::uint8_t SizeClass);
+
+				/// @return false if the cache is full, in which case the caller gives the block to the global lists
+				MODIO_IMPL bool Push(unsigned char* Block, std::uint8_t SizeClass);
+
+			private:
+				MODIO_IMPL static bool& IsDestroyed();
+
+				std::array<std::vector<unsigned char*>, NumSizeClasses> Blocks {};
+			};
+
+			static std::size_t GetClassSize(std::uint8_t SizeClass)
+			{
+				return std::size_t(1) << (MinSizeClassBits + SizeClass);
+			}
+
+			/// @return The alignment blocks of SizeClass are allocated with. Unpooled blocks are always given the
+			/// largest alignment, as they are freed without knowing what they were allocated with
+			static std::size_t GetBlockAlignment(std::uint8_t SizeClass)
+			{
+				return SizeClass == Unpooled || GetClassSize(SizeClass) > MaxAlignment ? MaxAlignment
+																					   : GetClassSize(SizeClass);
+			}
+
+			MODIO_IMPL static unsigned char* AllocateBlock(std::size_t Size, std::uint8_t SizeClass);
+
+			MODIO_IMPL static void FreeBlock(unsigned char* Block, std::uint8_t SizeClass);
+		};
+
+		/// @docinternal
+		/// @brief Deleter returning a block allocated by Modio::Detail::BufferPool to the pool
+		struct BufferPoolDeleter
+		{
+			std::uint8_t SizeClass = Modio::Detail::BufferPool::Unpooled;
+
+			void operator()(unsigned char* Block) const
+			{
+				Modio::Detail::BufferPool::Deallocate(Block, SizeClass);
+			}
+		};
+
+		/// @docinternal
+		/// @brief Standard allocator taking its memory from Modio::Detail::BufferPool, for objects that are created
+		/// and destroyed over and over such as the state of asynchronous operations
+		template<typename T>
+		class PooledAllocator
+		{
+			// No alignment is passed to the pool, so only the default alignment is supported
+			static_assert(alignof(T) <= alignof(std::max_align_t),
+						  "PooledAllocator does not support over-aligned types");
+
+		public:
+			using value_type = T;
+
+			PooledAllocator() = default;
+
+			template<typename Other>
+			PooledAllocator(const PooledAllocator<Other>&) noexcept
+			{}
+
+			T* allocate(std::size_t Count)
+			{
+				std::uint8_t SizeClass = Modio::Detail::BufferPool::Unpooled;
+				return reinterpret_cast<T*>(Modio::Detail::BufferPool::Allocate(Count * sizeof(T), SizeClass));
+			}
+
+			void deallocate(T* Pointer, std::size_t Count)
+			{
+				Modio::Detail::BufferPool::Deallocate(reinterpret_cast<unsigned char*>(Pointer),
+													  Modio::Detail::BufferPool::GetSizeClass(Count * sizeof(T)));
+			}
+
+			template<typename Other>
+			bool operator==(const PooledAllocator<Other>&) const
+			{
+				return true;
+			}
+
+			template<typename Other>
+			bool operator!=(const PooledAllocator<Other>&) const
+			{
+				return false;
+			}
+		};
+
+		/// @docinternal
+		/// @brief Equivalent of Modio::MakeStable that allocates the object and its reference count from
+		/// Modio::Detail::BufferPool
+		template<typename Object, typename... Types>
+		std::shared_ptr<Object> MakePooled(Types&&... Args)
+		{
+			return std::allocate_shared<Object>(Modio::Detail::PooledAllocator<Object>(), std::forward<Types>(Args)...);
+		}
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioBufferPool.ipp"
+#endif
@@ -0,0 +1,214 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioBufferPool.h"
+#endif
+
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/ModioRuntimeStats.h"
+#include <algorithm>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		unsigned char* BufferPool::Allocate(std::size_t Size, std::uint8_t& OutSizeClass, std::size_t Alignment)
+		{
+			// Blocks are aligned to their size, so a block at least Alignment bytes long is aligned to it
+			OutSizeClass = GetSizeClass(std::max(Size, Alignment));
+			if (OutSizeClass == Unpooled)
+			{
+				Modio::Detail::RuntimeStatsCollector::Get().RecordPoolAllocation(false);
+				return AllocateBlock(Size, Unpooled);
+			}
+
+			unsigned char* Block = nullptr;
+			if (ThreadCache* Cache = ThreadCache::Get())
+			{
+				Block = Cache->Pop(OutSizeClass);
+			}
+			if (Block == nullptr && !GlobalFreeLists::IsDestroyed().load(std::memory_order_acquire))
+			{
+				Block = GlobalFreeLists::Get().Pop(OutSizeClass);
+			}
+
+			Modio::Detail::RuntimeStatsCollector::Get().RecordPoolAllocation(Block != nullptr);
+			return Block != nullptr ? Block : AllocateBlock(GetClassSize(OutSizeClass), OutSizeClass);
+		}
+
+		void BufferPool::Deallocate(unsigned char* Block, std::uint8_t SizeClass)
+		{
+			if (SizeClass != Unpooled)
+			{
+				ThreadCache* Cache = ThreadCache::Get();
+				if (Cache != nullptr && Cache->Push(Block, SizeClass))
+				{
+					return;
+				}
+				// Buffers owned by other static objects may be freed after the free lists during exit
+				if (!GlobalFreeLists::IsDestroyed().load(std::memory_order_acquire) &&
+					GlobalFreeLists::Get().Push(Block, SizeClass))
+				{
+					return;
+				}
+			}
+			FreeBlock(Block, SizeClass);
+		}
+
+		std::uint8_t BufferPool::GetSizeClass(std::size_t Size)
+		{
+			if (Size > (std::size_t(1) << MaxSizeClassBits))
+			{
+				return Unpooled;
+			}
+
+			std::uint8_t SizeClass = 0;
+			while (GetClassSize(SizeClass) < Size)
+			{
+				++SizeClass;
+			}
+			return SizeClass;
+		}
+
+		unsigned char* BufferPool::AllocateBlock(std::size_t Size, std::uint8_t SizeClass)
+		{
+			return static_cast<unsigned char*>(::operator new(Size, std::align_val_t(GetBlockAlignment(SizeClass))));
+		}
+
+		void BufferPool::FreeBlock(unsigned char* Block, std::uint8_t SizeClass)
+		{
+			::operator delete(Block, std::align_val_t(GetBlockAlignment(SizeClass)));
+		}
+
+		BufferPool::GlobalFreeLists& BufferPool::GlobalFreeLists::Get()
+		{
+			static GlobalFreeLists Instance;
+			return Instance;
+		}
+
+		BufferPool::GlobalFreeLists::~GlobalFreeLists()
+		{
+			IsDestroyed().store(true, std::memory_order_release);
+			for (std::uint8_t SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+			{
+				FreeList& List = Lists[SizeClass];
+				std::lock_guard<std::mutex> Lock(List.Mutex);
+				for (unsigned char* Block : List.Blocks)
+				{
+					FreeBlock(Block, SizeClass);
+				}
+				List.Blocks.clear();
+			}
+		}
+
+		unsigned char* BufferPool::GlobalFreeLists::Pop(std::uint8_t SizeClass)
+		{
+			FreeList& List = Lists[SizeClass];
+			std::lock_guard<std::mutex> Lock(List.Mutex);
+			if (List.Blocks.empty())
+			{
+				return nullptr;
+			}
+			unsigned char* Block = List.Blocks.back();
+			List.Blocks.pop_back();
+			return Block;
+		}
+
+		bool BufferPool::GlobalFreeLists::Push(unsigned char* Block, std::uint8_t SizeClass)
+		{
+			// Always keep at least one block, so the largest classes are pooled too
+			std::size_t MaxBlocks = std::max<std::size_t>(
+				Constants::Configuration::BufferPoolGlobalBytesPerSizeClass / GetClassSize(SizeClass), 1);
+
+			FreeList& List = Lists[SizeClass];
+			std::lock_guard<std::mutex> Lock(List.Mutex);
+			if (List.Blocks.size() >= MaxBlocks)
+			{
+				return false;
+			}
+			List.Blocks.push_back(Block);
+			return true;
+		}
+
+		std::atomic<bool>& BufferPool::GlobalFreeLists::IsDestroyed()
+		{
+			static std::atomic<bool> bDestroyed {false};
+			return bDestroyed;
+		}
+
+		BufferPool::ThreadCache::ThreadCache()
+		{
+			// Constructing the global free lists first means they are destroyed after the caches of threads that exit
+			// before static destruction, so those caches can return their blocks to them
+			GlobalFreeLists::Get();
+		}
+
+		BufferPool::ThreadCache::~ThreadCache()
+		{
+			IsDestroyed() = true;
+			// A thread that exits once static destruction has started may outlive the global free lists
+			bool bGlobalListsDestroyed = GlobalFreeLists::IsDestroyed().load(std::memory_order_acquire);
+			for (std::uint8_t SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+			{
+				for (unsigned char* Block : Blocks[SizeClass])
+				{
+					if (bGlobalListsDestroyed || !GlobalFreeLists::Get().Push(Block, SizeClass))
+					{
+						FreeBlock(Block, SizeClass);
+					}
+				}
+			}
+		}
+
+		BufferPool::ThreadCache* BufferPool::ThreadCache::Get()
+		{
+			// Checked first, as the cache must not be used again once it is destroyed when the thread exits
+			if (IsDestroyed())
+			{
+				return nullptr;
+			}
+			static thread_local ThreadCache Instance;
+			return &Instance;
+		}
+
+		unsigned char* BufferPool::ThreadCache::Pop(std::uint8_t SizeClass)
+		{
+			std::vector<unsigned char*>& CachedBlocks = Blocks[SizeClass];
+			if (CachedBlocks.empty())
+			{
+				return nullptr;
+			}
+			unsigned char* Block = CachedBlocks.back();
+			CachedBlocks.pop_back();
+			return Block;
+		}
+
+		bool BufferPool::ThreadCache::Push(unsigned char* Block, std::uint8_t SizeClass)
+		{
+			std::size_t MaxBlocks = std::max<std::size_t>(
+				Constants::Configuration::BufferPoolThreadCacheBytesPerSizeClass / GetClassSize(SizeClass), 1);
+
+			std::vector<unsigned char*>& CachedBlocks = Blocks[SizeClass];
+			if (CachedBlocks.size() >= MaxBlocks)
+			{
+				return false;
+			}
+			CachedBlocks.push_back(Block);
+			return true;
+		}
+
+		bool& BufferPool::ThreadCache::IsDestroyed()
+		{
+			static thread_local bool bDestroyed = false;
+			return bDestroyed;
+		}
+	} // namespace Detail
+} // namespace Modio
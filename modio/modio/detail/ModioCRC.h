@@ -28,6 +28,10 @@ namespace Modio
 		uint32_t CRC32(Modio::Detail::Buffer& Data, uint32_t PreviousCRC32 = 0,
 					   Modio::Optional<std::size_t> UntilByte = Modio::Optional<size_t> {});
 
+		/// @brief Same as above, for bytes that are not held in a Buffer of their own, such as a section of a larger
+		/// buffer
+		uint32_t CRC32(const unsigned char* Data, std::size_t Size, uint32_t PreviousCRC32 = 0);
+
 	} // namespace Detail
 } // namespace Modio
 
@@ -81,5 +81,15 @@ namespace Modio
 			return ~CRC;
 		}
 
+		uint32_t CRC32(const unsigned char* Data, std::size_t Size, uint32_t PreviousCRC32)
+		{
+			uint32_t CRC = ~PreviousCRC32;
+			for (std::size_t ByteIndex = 0; ByteIndex < Size; ++ByteIndex)
+			{
+				CRC = (CRC >> 8) ^ Crc32Lookup[(CRC ^ Data[ByteIndex]) & 0xff];
+			}
+			return ~CRC;
+		}
+
 	} // namespace Detail
 } // namespace Modio
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/detail/AsioWrapper.h"
+#include <cstdint>
+#include <memory>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Threads that CPU-bound steps of operations (such as inflating archive entries and hashing files) are
+		/// run on when the SDK is initialized with the ComputeThreads extended parameter.
+		///
+		/// The SDK's state is only ever touched from the thread running the global io_context, which serializes every
+		/// operation the same way a strand would. Work sent to the pool therefore only touches the data it is given,
+		/// never the session data or the services, and the operation that sent it resumes on the global io_context
+		/// (see Modio::Detail::RunOnComputePoolAsync). Start and Stop are only called while no handlers are running
+		/// elsewhere: from the initialization operation and from ShutdownAsync with the shutdown lock held.
+		class ComputePool
+		{
+		public:
+			/// @brief Creates the pool with the given number of threads, replacing any existing pool. With zero
+			/// threads there is no pool and work is run inline by the operations that would have sent it
+			MODIO_IMPL static void Start(std::uint32_t NumThreads);
+
+			/// @brief Waits for the work already sent to the pool to finish, then destroys the pool
+			MODIO_IMPL static void Stop();
+
+			/// @return The pool, or null if work should be run inline
+			MODIO_IMPL static ModioAsio::thread_pool* Get();
+
+		private:
+			MODIO_IMPL static std::unique_ptr<ModioAsio::thread_pool>& GetStorage();
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioComputePool.ipp"
+#endif
@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioComputePool.h"
+#endif
+
+namespace Modio
+{
+	namespace Detail
+	{
+		std::unique_ptr<ModioAsio::thread_pool>& ComputePool::GetStorage()
+		{
+			static std::unique_ptr<ModioAsio::thread_pool> Pool;
+			return Pool;
+		}
+
+		void ComputePool::Start(std::uint32_t NumThreads)
+		{
+			Stop();
+			if (NumThreads > 0)
+			{
+				GetStorage() = std::make_unique<ModioAsio::thread_pool>(NumThreads);
+			}
+		}
+
+		void ComputePool::Stop()
+		{
+			std::unique_ptr<ModioAsio::thread_pool>& Pool = GetStorage();
+			if (Pool)
+			{
+				Pool->join();
+				Pool.reset();
+			}
+		}
+
+		ModioAsio::thread_pool* ComputePool::Get()
+		{
+			return GetStorage().get();
+		}
+	} // namespace Detail
+} // namespace Modio
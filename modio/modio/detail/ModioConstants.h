@@ -50,6 +50,7 @@ namespace Modio
 				constexpr const char* Nonce = "nonce";
 				constexpr const char* AccessToken = "access_token";
 				constexpr const char* UploadID = "upload_id";
+				constexpr const char* FileHash = "filehash";
 				constexpr const char* DisplayName = "display_name_portal";
 			} // namespace APIStrings
 			namespace QueryParamStrings
@@ -62,6 +63,7 @@ namespace Modio
 			{
 				constexpr const char* UserSubscriptionList = "subscriptions";
 				constexpr const char* ModCollection = "Mods";
+				constexpr const char* ModCollectionGeneration = "Generation";
 				constexpr const char* DeferredUnsubscribes = "DeferredUnsubscribes";
 				constexpr const char* ModEntryID = "ID";
 				constexpr const char* OAuth = "OAuth";
@@ -75,6 +77,7 @@ namespace Modio
 				constexpr const char* RootLocalStoragePath = "RootLocalStoragePath";
 				constexpr const char* ModNeverRetryCategory = "NeverRetryCategory";
 				constexpr const char* ModNeverRetryCode = "NeverRetryCode";
+				constexpr const char* ModEntryRemoved = "Removed";
 				constexpr const char* WalletBalance = "balance";
 				constexpr const char* GrossAmount = "gross_amount";
 				constexpr const char* TokenEntity = "entity";
@@ -90,6 +93,40 @@ namespace Modio
 				// The maximum size a file section to upload using a multipart operation
 				// For reference, these are 50MiB = 52MB
 				constexpr uintmax_t MultipartMaxFilePartSize = 52428800;
+				// The number of parts of a multipart upload sent concurrently, unless overridden with the
+				// MultipartUploadConcurrency extended initialization parameter
+				constexpr std::uint32_t DefaultMultipartUploadConcurrency = 4;
+				// Upper bound for MultipartUploadConcurrency, as every part in flight holds its own connection
+				constexpr std::uint32_t MaxMultipartUploadConcurrency = 16;
+				// Upper bound for the ComputeThreads extended initialization parameter
+				constexpr std::uint32_t MaxComputeThreads = 16;
+				// Upper bound for the IOThreads extended initialization parameter
+				constexpr std::uint32_t MaxIOThreads = 16;
+				// Longest the SDK's worker thread parks for before checking for queued tasks again, unless overridden
+				// with the WorkerIdleIntervalMicroseconds extended initialization parameter
+				constexpr auto DefaultWorkerIdleInterval = std::chrono::microseconds(1000);
+				// Upper bound for WorkerIdleIntervalMicroseconds, as a task queued while the worker is parked may wait
+				// this long to start
+				constexpr auto MaxWorkerIdleInterval = std::chrono::microseconds(100000);
+				// Delay before the first retry of a failed multipart part upload, doubled on every subsequent retry
+				constexpr auto MultipartPartRetryInitialDelay = std::chrono::seconds(2);
+				// How often the MD5 state of a modfile download is saved, so an interrupted download can resume hashing
+				// where it stopped instead of reading the partial file again
+				constexpr std::uint64_t DownloadHashCheckpointInterval = 8 * 1024 * 1024;
+				// Number of times a modfile is downloaded again after it failed to match the MD5 the server reported,
+				// before the installation fails
+				constexpr std::uint8_t MaxModfileVerificationRetries = 2;
+				// Number of records the mod collection journal may hold before the next save writes the whole collection
+				// to the state.bin snapshot instead and starts an empty journal
+				constexpr std::uint32_t ModCollectionJournalMaxRecords = 512;
+				// Size the mod collection journal may grow to before it is compacted, whatever its number of records
+				constexpr std::uint64_t ModCollectionJournalMaxSize = 4 * 1024 * 1024;
+				// The mod collection is also exported to state.json on every this many compactions, or whenever
+				// state.json is missing. It is only read if state.bin cannot be, so most compactions skip writing it
+				constexpr std::uint64_t ModCollectionExportInterval = 16;
+				// How long the responses for mod list pages fetched by ListAllModsWithPrefetchAsync stay in the cache,
+				// which is longer than other responses as they are only used once the caller scrolls to them
+				constexpr auto PrefetchedModListPageCacheLifetime = std::chrono::minutes(5);
 				// A heartbeat POST request is required to be submitted at-most every 5 minutes (300s).
 				// We send a heartbeat by default at half that requirement to ensure we do not time out.
 				constexpr uint32_t MetricsHeartbeatIntervalSeconds = 150;
@@ -99,6 +136,24 @@ namespace Modio
 				// By applying this universally, we avoid mod creation on platforms without the limit
 				// that would otherwise encounter issues when run on Windows systems.
 				constexpr std::size_t UniversalMaxPath = 260;
+				// When adding a file to an archive in Automatic mode, the first block is deflated as a sample. If the
+				// sample does not shrink by at least this percentage, the file is written with Store instead
+				constexpr std::uint64_t ArchiveStoreMinimumSavingsPercent = 5;
+				// Number of log messages that can be waiting to be formatted at once. Messages logged while this many
+				// are waiting are dropped. Must be a power of two
+				constexpr std::size_t LogRingBufferCapacity = 1024;
+				// Bytes each waiting log message has for copies of its arguments. Messages whose arguments do not fit
+				// are formatted when they are logged instead
+				constexpr std::size_t LogRecordArgStorageSize = 128;
+				// Number of one-second intervals the recent throughput reported by Modio::QueryRuntimeStats is
+				// averaged over. The interval in progress is not counted
+				constexpr std::size_t RuntimeStatsThroughputWindowSeconds = 5;
+				// Bytes of freed Modio::Detail::BufferPool blocks of each size class a thread keeps for its own later
+				// allocations. At least one block of each class is always kept
+				constexpr std::size_t BufferPoolThreadCacheBytesPerSizeClass = 256 * 1024;
+				// Bytes of freed Modio::Detail::BufferPool blocks of each size class kept for any thread once the
+				// freeing thread's cache is full. Blocks beyond this are returned to the system
+				constexpr std::size_t BufferPoolGlobalBytesPerSizeClass = 1024 * 1024;
 			} // namespace Configuration
 			namespace PlatformNames
 			{
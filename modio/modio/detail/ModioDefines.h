@@ -35,6 +35,17 @@
 	#define MODIO_TRACK_OPS 0
 #endif
 
+// Lowest Modio::LogLevel (0 for Trace up to 4 for Error) whose messages are compiled into MODIO_LOG. Messages below
+// it are removed at compile time along with the evaluation of their arguments, so release builds leave out Trace
+// logging unless this is overridden
+#ifndef MODIO_MIN_LOG_LEVEL
+	#if MODIO_RELEASE
+		#define MODIO_MIN_LOG_LEVEL 1
+	#else
+		#define MODIO_MIN_LOG_LEVEL 0
+	#endif
+#endif
+
 // BEGIN ASIO DEFINES
 #ifndef ASIO_STANDALONE
 	#define MODIO_DEFINED_ASIO_STANDALONE
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioStdTypes.h"
+#include "modio/detail/AsioWrapper.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Strand of the I/O thread pool. Each HttpRequest and File that runs on the pool has its own
+		using IOStrand = ModioAsio::strand<ModioAsio::thread_pool::executor_type>;
+
+		/// @docinternal
+		/// @brief Threads that the platform steps of HTTP requests and file reads and writes are run on when the SDK is
+		/// initialized with the IOThreads extended parameter, on platforms built with MODIO_PLATFORM_IO_THREADS.
+		///
+		/// Session data, mod management, the cache and every other service stay on the global io_context, which
+		/// serializes them as a single core strand. Each HttpRequest and File gets its own strand of this pool instead,
+		/// so the steps of one request or file never overlap while different requests and files progress in parallel.
+		/// The platform operations running there only touch their own request or file and the platform's shared state,
+		/// which those platforms guard, and the operation that started them resumes on the global io_context (see
+		/// Modio::Detail::RunOnIOStrandAsync).
+		class IOThreadPool
+		{
+		public:
+			/// @brief Creates the pool with the given number of threads, replacing any existing pool. With zero
+			/// threads, or on platforms without MODIO_PLATFORM_IO_THREADS, there is no pool and HTTP requests and files
+			/// run their platform operations on the global io_context
+			MODIO_IMPL static void Start(std::uint32_t NumThreads);
+
+			/// @brief Waits for the pool's threads to go idle and exit. Only called once HasPendingOperations is false,
+			/// as operations on the pool may be waiting on the global io_context
+			MODIO_IMPL static void Stop();
+
+			/// @return A new strand of the pool, or an empty optional if there is no pool
+			MODIO_IMPL static Modio::Optional<IOStrand> MakeStrand();
+
+			/// @return True while an operation sent to a strand has not yet resumed its caller, so that shutdown can
+			/// keep flushing the old io_context until those operations have been cancelled
+			MODIO_IMPL static bool HasPendingOperations();
+
+			/// @brief Called by Modio::Detail::RunOnIOStrandOp when it is created and when it resumes its caller
+			MODIO_IMPL static void BeginOperation();
+			MODIO_IMPL static void EndOperation();
+
+		private:
+			MODIO_IMPL static std::unique_ptr<ModioAsio::thread_pool>& GetStorage();
+			MODIO_IMPL static std::vector<std::unique_ptr<ModioAsio::thread_pool>>& GetRetiredPools();
+			MODIO_IMPL static std::atomic<std::uint32_t>& GetPendingOperationCount();
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioIOThreadPool.ipp"
+#endif
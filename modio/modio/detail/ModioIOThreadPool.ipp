@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioIOThreadPool.h"
+#endif
+
+namespace Modio
+{
+	namespace Detail
+	{
+		std::unique_ptr<ModioAsio::thread_pool>& IOThreadPool::GetStorage()
+		{
+			static std::unique_ptr<ModioAsio::thread_pool> Pool;
+			return Pool;
+		}
+
+		std::vector<std::unique_ptr<ModioAsio::thread_pool>>& IOThreadPool::GetRetiredPools()
+		{
+			static std::vector<std::unique_ptr<ModioAsio::thread_pool>> RetiredPools;
+			return RetiredPools;
+		}
+
+		std::atomic<std::uint32_t>& IOThreadPool::GetPendingOperationCount()
+		{
+			static std::atomic<std::uint32_t> PendingOperations {0};
+			return PendingOperations;
+		}
+
+		void IOThreadPool::Start(std::uint32_t NumThreads)
+		{
+			Stop();
+#ifdef MODIO_PLATFORM_IO_THREADS
+			if (NumThreads > 0)
+			{
+				GetStorage() = std::make_unique<ModioAsio::thread_pool>(NumThreads);
+			}
+#else
+			(void) NumThreads;
+#endif
+		}
+
+		void IOThreadPool::Stop()
+		{
+			std::unique_ptr<ModioAsio::thread_pool>& Pool = GetStorage();
+			if (Pool)
+			{
+				Pool->join();
+				// Kept rather than destroyed, as a File or HttpRequest that outlives shutdown may still hold a strand
+				// of it and strands unregister from their pool when they are destroyed
+				GetRetiredPools().push_back(std::move(Pool));
+			}
+		}
+
+		Modio::Optional<IOStrand> IOThreadPool::MakeStrand()
+		{
+			std::unique_ptr<ModioAsio::thread_pool>& Pool = GetStorage();
+			if (Pool)
+			{
+				return ModioAsio::make_strand(Pool->get_executor());
+			}
+			return {};
+		}
+
+		bool IOThreadPool::HasPendingOperations()
+		{
+			return GetPendingOperationCount().load(std::memory_order_acquire) > 0;
+		}
+
+		void IOThreadPool::BeginOperation()
+		{
+			GetPendingOperationCount().fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void IOThreadPool::EndOperation()
+		{
+			GetPendingOperationCount().fetch_sub(1, std::memory_order_release);
+		}
+	} // namespace Detail
+} // namespace Modio
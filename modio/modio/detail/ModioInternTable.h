@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Hands out shared, immutable copies of values so that equal values stored in many places share one
+		/// allocation. Values are looked up by a key that identifies them (such as a user ID or a tag name) and only
+		/// shared if they are also equal, so a newer version of a value replaces the interned one rather than being
+		/// dropped. The table only holds weak references: a value is freed once nothing that interned it holds it
+		/// any longer, and slots for freed values are pruned as the table grows.
+		template<typename KeyType, typename ValueType, typename EqualType = std::equal_to<ValueType>,
+				 typename HashType = std::hash<KeyType>>
+		class InternTable
+		{
+		public:
+			/// @return The interned copy of the value
+			std::shared_ptr<const ValueType> Intern(const KeyType& Key, ValueType Value)
+			{
+				std::weak_ptr<const ValueType>& Slot = Entries[Key];
+				std::shared_ptr<const ValueType> Interned = Slot.lock();
+				if (Interned && EqualType {}(*Interned, Value))
+				{
+					return Interned;
+				}
+
+				Interned = std::make_shared<const ValueType>(std::move(Value));
+				Slot = Interned;
+				if (Entries.size() >= NextPruneSize)
+				{
+					Prune();
+				}
+				return Interned;
+			}
+
+		private:
+			void Prune()
+			{
+				for (auto Entry = Entries.begin(); Entry != Entries.end();)
+				{
+					if (Entry->second.expired())
+					{
+						Entry = Entries.erase(Entry);
+					}
+					else
+					{
+						++Entry;
+					}
+				}
+				// Doubling the threshold keeps pruning amortized constant per interned value
+				NextPruneSize = Entries.size() * 2 > MinPruneSize ? Entries.size() * 2 : MinPruneSize;
+			}
+
+			static constexpr std::size_t MinPruneSize = 64;
+
+			std::unordered_map<KeyType, std::weak_ptr<const ValueType>, HashType> Entries {};
+			std::size_t NextPruneSize = MinPruneSize;
+		};
+	} // namespace Detail
+} // namespace Modio
@@ -26,15 +26,35 @@ namespace Modio
 		class Buffer;
 		class DynamicBuffer;
 
+		/// @docinternal
+		/// @brief Looks up a key with a single search of the object, without first building a std::string for keys
+		/// given as literals
+		/// @return The value, or null if the JSON is not an object, does not contain the key or the value is null
+		inline const nlohmann::json* FindNonNull(const nlohmann::json& Json, const char* Key)
+		{
+			nlohmann::json::const_iterator Value = Json.find(Key);
+			if (Value == Json.end() || Value->is_null())
+			{
+				return nullptr;
+			}
+			return &*Value;
+		}
+
+		/// @docinternal
+		inline const nlohmann::json* FindNonNull(const nlohmann::json& Json, const std::string& Key)
+		{
+			return FindNonNull(Json, Key.c_str());
+		}
+
 		/// @docinternal
 		/// @brief Make sure JSON element parsing is executed when checking for key
 		/// location and validity
-		template<typename T>
-		inline bool ParseSafe(const nlohmann::json& Json, T& OutVar, const std::string& Key)
+		template<typename T, typename KeyType>
+		inline bool ParseSafe(const nlohmann::json& Json, T& OutVar, const KeyType& Key)
 		{
-			if (Json.contains(Key) && !Json.at(Key).is_null())
+			if (const nlohmann::json* Value = FindNonNull(Json, Key))
 			{
-				Json.at(Key).get_to<T>(OutVar);
+				Value->get_to<T>(OutVar);
 				return true;
 			}
 			else
@@ -47,13 +67,12 @@ namespace Modio
 			}
 		}
 
-		template<>
-		inline bool ParseSafe<Modio::filesystem::path>(const nlohmann::json& Json, Modio::filesystem::path& OutVar,
-													   const std::string& Key)
+		template<typename KeyType>
+		inline bool ParseSafe(const nlohmann::json& Json, Modio::filesystem::path& OutVar, const KeyType& Key)
 		{
-			if (Json.contains(Key) && !Json.at(Key).is_null())
+			if (const nlohmann::json* Value = FindNonNull(Json, Key))
 			{
-				std::string PathString = Json.at(Key).get<std::string>();
+				std::string PathString = Value->get<std::string>();
 				OutVar = Modio::filesystem::path(PathString);
 				return true;
 			}
@@ -78,30 +97,19 @@ namespace Modio
 		}
 
 		/// @docnone
-		template<typename T>
-		inline bool ParseSubobjectSafe(const nlohmann::json& Json, T& OutVar, const std::string& SubobjectKey,
-									   const std::string& Key)
+		template<typename T, typename SubobjectKeyType, typename KeyType>
+		inline bool ParseSubobjectSafe(const nlohmann::json& Json, T& OutVar, const SubobjectKeyType& SubobjectKey,
+									   const KeyType& Key)
 		{
-			if (Json.contains(SubobjectKey))
+			if (const nlohmann::json* Subobject = FindNonNull(Json, SubobjectKey))
 			{
-				const nlohmann::json& Subobject = Json.at(SubobjectKey);
-				if (!Subobject.is_null())
-				{
-					return ParseSafe(Subobject, OutVar, Key);
-				}
-				else
-				{
-#ifdef MODIO_TRACE_JSON_PARSER
-					Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::Core,
-												"Subobject is null for SubobjectKey: {}", SubobjectKey);
-#endif
-				}
+				return ParseSafe(*Subobject, OutVar, Key);
 			}
 			else
 			{
 #ifdef MODIO_TRACE_JSON_PARSER
 				Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::Core,
-											"Json does not contain SubobjectKey: {}", SubobjectKey);
+											"Json does not contain a non-null SubobjectKey: {}", SubobjectKey);
 #endif
 			}
 			return false;
@@ -57,10 +57,16 @@ bool Modio::Detail::ParseArraySizeSafe(const nlohmann::json& Json, std::size_t&
 
 nlohmann::json Modio::Detail::ToJson(const Modio::Detail::DynamicBuffer& ResponseBuffer)
 {
-	Modio::Detail::Buffer LinearBuffer(ResponseBuffer.size());
-	Modio::Detail::BufferCopy(LinearBuffer, ResponseBuffer);
 	MODIO_PROFILE_SCOPE(JsonParse);
-	return Modio::Detail::ToJson(LinearBuffer);
+	if (ResponseBuffer.size() == 0)
+	{
+		return nlohmann::json {};
+	}
+
+	// Parsed in place across the buffer's segments, so a large response is never held twice. Invalid JSON gives a
+	// discarded value, which "TryMarshalResponse" turns into an empty object
+	return nlohmann::json::parse(Modio::Detail::DynamicBufferByteIterator(ResponseBuffer),
+								 Modio::Detail::DynamicBufferByteIterator(), nullptr, false);
 }
 
 nlohmann::json Modio::Detail::ToJson(const Modio::filesystem::path& Path)
@@ -77,13 +83,6 @@ nlohmann::json Modio::Detail::ToJson(const Modio::Detail::Buffer& InBuffer)
 		return nlohmann::json {};
 	}
 
-	// This checks that the data to parse is JSON compatible.
-	if (nlohmann::json::accept(InBuffer.Data()) == false)
-	{
-		// This negative case will return a discarded type, used by "TryMarshalResponse"
-		// to return an empty object
-        return nlohmann::json::value_t::discarded;
-	}
-
-	return nlohmann::json::parse(InBuffer.Data(), nullptr, false);
+	// Invalid JSON gives a discarded value, so there is no need to check the data with a separate pass first
+	return nlohmann::json::parse(InBuffer.begin(), InBuffer.end(), nullptr, false);
 }
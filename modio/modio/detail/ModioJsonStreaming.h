@@ -0,0 +1,336 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioStdTypes.h"
+#include "modio/detail/JsonWrapper.h"
+#include "modio/detail/ModioProfiling.h"
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Tells the streaming list reader which keys of an element's object the element's from_json reads.
+		/// The values of any other key are skipped while they are parsed instead of being built into the element.
+		/// Reads every key unless specialized next to the from_json of the element type
+		template<typename T>
+		struct JsonStreamedFields
+		{
+			static bool IsRead(const std::string& /*Key*/)
+			{
+				return true;
+			}
+		};
+
+		/// @docinternal
+		/// @return Whether a key list is sorted, so that a JsonStreamedFields specialization can check its list with a
+		/// static_assert before searching it with std::binary_search
+		template<std::size_t NumKeys>
+		constexpr bool IsSortedKeyList(const std::array<std::string_view, NumKeys>& Keys)
+		{
+			for (std::size_t Index = 1; Index < NumKeys; ++Index)
+			{
+				if (!(Keys[Index - 1] < Keys[Index]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// @docinternal
+		/// @brief SAX handler that reads a paged list response (an envelope object holding the paging fields and a
+		/// "data" array of elements) in a single pass over the response text.
+		///
+		/// Only one element is held as JSON at a time: it is built while it is parsed, handed to the element's
+		/// from_json as soon as it is closed and then released. Scalars in the envelope are kept for the list's own
+		/// from_json, and anything else outside the elements is skipped without being stored.
+		template<typename ListType>
+		class JsonPagedListReader
+		{
+		public:
+			using ElementType =
+				typename std::decay<decltype(std::declval<ListType&>().GetRawList())>::type::value_type;
+
+			bool null()
+			{
+				return Value(nullptr);
+			}
+
+			bool boolean(bool Val)
+			{
+				return Value(Val);
+			}
+
+			bool number_integer(nlohmann::json::number_integer_t Val)
+			{
+				return Value(Val);
+			}
+
+			bool number_unsigned(nlohmann::json::number_unsigned_t Val)
+			{
+				return Value(Val);
+			}
+
+			bool number_float(nlohmann::json::number_float_t Val, const nlohmann::json::string_t& /*RawValue*/)
+			{
+				return Value(Val);
+			}
+
+			bool string(nlohmann::json::string_t& Val)
+			{
+				return Value(Val);
+			}
+
+			bool binary(nlohmann::json::binary_t& Val)
+			{
+				return Value(nlohmann::json::binary(Val));
+			}
+
+			bool start_object(std::size_t /*NumElements*/)
+			{
+				if (SkipDepth > 0)
+				{
+					++SkipDepth;
+					return true;
+				}
+				if (!ElementStack.empty())
+				{
+					return StartElementContainer(nlohmann::json::object());
+				}
+				if (Depth == 0)
+				{
+					Depth = 1;
+					return true;
+				}
+				if (Depth == 2)
+				{
+					Element = nlohmann::json::object();
+					ElementStack.push_back(&Element);
+					return true;
+				}
+				// Objects in the envelope are not part of the page
+				SkipDepth = 1;
+				return true;
+			}
+
+			bool key(nlohmann::json::string_t& Key)
+			{
+				if (SkipDepth > 0)
+				{
+					return true;
+				}
+				if (!ElementStack.empty())
+				{
+					if (ElementStack.size() == 1 && !JsonStreamedFields<ElementType>::IsRead(Key))
+					{
+						bSkipNextElementValue = true;
+						return true;
+					}
+					PendingElementValue = &(*ElementStack.back())[Key];
+					return true;
+				}
+				bDataKey = Key == "data";
+				if (!bDataKey)
+				{
+					PendingEnvelopeKey.assign(Key);
+				}
+				return true;
+			}
+
+			bool end_object()
+			{
+				if (SkipDepth > 0)
+				{
+					--SkipDepth;
+					return true;
+				}
+				if (!ElementStack.empty())
+				{
+					ElementStack.pop_back();
+					if (ElementStack.empty())
+					{
+						using nlohmann::from_json;
+						ElementType Item {};
+						from_json(Element, Item);
+						Elements.push_back(std::move(Item));
+						Element = nullptr;
+					}
+					return true;
+				}
+				Depth = 0;
+				return true;
+			}
+
+			bool start_array(std::size_t /*NumElements*/)
+			{
+				if (SkipDepth > 0)
+				{
+					++SkipDepth;
+					return true;
+				}
+				if (!ElementStack.empty())
+				{
+					return StartElementContainer(nlohmann::json::array());
+				}
+				if (Depth == 0)
+				{
+					// A bare array is not a paged list response
+					return false;
+				}
+				if (Depth == 1 && bDataKey)
+				{
+					Depth = 2;
+					return true;
+				}
+				SkipDepth = 1;
+				return true;
+			}
+
+			bool end_array()
+			{
+				if (SkipDepth > 0)
+				{
+					--SkipDepth;
+					return true;
+				}
+				if (!ElementStack.empty())
+				{
+					ElementStack.pop_back();
+					return true;
+				}
+				Depth = 1;
+				return true;
+			}
+
+			template<typename ExceptionType>
+			bool parse_error(std::size_t /*Position*/, const std::string& /*LastToken*/,
+							 const ExceptionType& /*Exception*/)
+			{
+				return false;
+			}
+
+			/// @brief Fills in the list from what was read. Only meaningful once the whole response has been parsed
+			void Finish(ListType& Result)
+			{
+				using nlohmann::from_json;
+				// The envelope has no "data", so this only sets the paging fields
+				from_json(Envelope, Result);
+				Result.GetRawList() = std::move(Elements);
+			}
+
+		private:
+			template<typename ValueType>
+			bool Value(ValueType&& Val)
+			{
+				if (SkipDepth > 0)
+				{
+					return true;
+				}
+				if (!ElementStack.empty())
+				{
+					if (bSkipNextElementValue)
+					{
+						bSkipNextElementValue = false;
+						return true;
+					}
+					AddElementValue(nlohmann::json(std::forward<ValueType>(Val)));
+					return true;
+				}
+				if (Depth == 1)
+				{
+					if (!bDataKey)
+					{
+						Envelope[PendingEnvelopeKey] = std::forward<ValueType>(Val);
+					}
+					return true;
+				}
+				// Scalars in the data array are not elements, but a bare scalar is not a paged list response
+				return Depth == 2;
+			}
+
+			bool StartElementContainer(nlohmann::json&& Container)
+			{
+				if (bSkipNextElementValue)
+				{
+					bSkipNextElementValue = false;
+					SkipDepth = 1;
+					return true;
+				}
+				ElementStack.push_back(AddElementValue(std::move(Container)));
+				return true;
+			}
+
+			nlohmann::json* AddElementValue(nlohmann::json&& Val)
+			{
+				nlohmann::json& Parent = *ElementStack.back();
+				if (Parent.is_array())
+				{
+					Parent.push_back(std::move(Val));
+					return &Parent.back();
+				}
+				*PendingElementValue = std::move(Val);
+				return PendingElementValue;
+			}
+
+			/// @brief 0 outside the envelope, 1 inside it and 2 inside its data array
+			std::size_t Depth = 0;
+			/// @brief Number of containers open inside a value that is being skipped
+			std::size_t SkipDepth = 0;
+			bool bDataKey = false;
+			bool bSkipNextElementValue = false;
+			std::string PendingEnvelopeKey {};
+			nlohmann::json Envelope = nlohmann::json::object();
+
+			nlohmann::json Element {};
+			/// @brief Containers of the element that are currently open, the element itself first
+			std::vector<nlohmann::json*> ElementStack {};
+			nlohmann::json* PendingElementValue = nullptr;
+
+			std::vector<ElementType> Elements {};
+		};
+
+		/// @docinternal
+		/// @brief Marshals a paged list response with JsonPagedListReader rather than parsing the whole response to
+		/// JSON first. The response is read in place, so the peak memory of parsing a page is one element rather
+		/// than the whole page
+		template<typename ListType>
+		inline Modio::Optional<ListType> TryMarshalListResponse(Modio::Detail::DynamicBuffer& ResponseBuffer)
+		{
+			MODIO_PROFILE_SCOPE(TryMarshalListResponse);
+			ListType ResultStructure;
+
+			if (ResponseBuffer.size() == 0)
+			{
+				return ResultStructure;
+			}
+
+			JsonPagedListReader<ListType> Reader;
+			if (!nlohmann::json::sax_parse(Modio::Detail::DynamicBufferByteIterator(ResponseBuffer),
+										   Modio::Detail::DynamicBufferByteIterator(), &Reader))
+			{
+				return {};
+			}
+
+			Reader.Finish(ResultStructure);
+			return ResultStructure;
+		}
+	} // namespace Detail
+} // namespace Modio
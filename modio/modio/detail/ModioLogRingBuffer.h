@@ -0,0 +1,357 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioCoreTypes.h"
+#include "modio/detail/FmtWrapper.h"
+#include "modio/detail/ModioConstants.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Type a log argument is copied into when its message is captured. Arguments are only formatted once
+		/// the record is read, so anything that refers to the caller's memory is copied into a string
+		template<typename T>
+		struct LogCapturedType
+		{
+			using Type = T;
+		};
+
+		template<>
+		struct LogCapturedType<const char*>
+		{
+			using Type = std::string;
+		};
+
+		template<>
+		struct LogCapturedType<char*>
+		{
+			using Type = std::string;
+		};
+
+		template<>
+		struct LogCapturedType<std::string_view>
+		{
+			using Type = std::string;
+		};
+
+		template<>
+		struct LogCapturedType<fmt::string_view>
+		{
+			using Type = std::string;
+		};
+
+		template<typename T>
+		using LogCaptured = typename LogCapturedType<typename std::decay<T>::type>::Type;
+
+		/// @docinternal
+		/// @brief Format string that MODIO_LOG has checked is a string literal at compile time, so a LogRecord can
+		/// refer to it instead of copying it. Only MODIO_LOG should construct one
+		struct LogLiteral
+		{
+			const char* Format;
+		};
+
+		/// @docinternal
+		/// @brief A message that has been logged but not formatted yet. Holds the message's format string and copies
+		/// of its arguments in place, and formats them when the message is read from the LogRingBuffer
+		class LogRecord
+		{
+		public:
+			LogRecord() = default;
+			LogRecord(const LogRecord&) = delete;
+			LogRecord& operator=(const LogRecord&) = delete;
+
+			~LogRecord()
+			{
+				Reset();
+			}
+
+			/// @brief Captures a message whose format string is a string literal, which is referred to rather than
+			/// copied
+			template<typename... ArgTypes>
+			void Capture(Modio::LogLevel InLevel, Modio::LogCategory InCategory, Modio::Detail::LogLiteral InFormat,
+						 ArgTypes&&... Args)
+			{
+				SetHeader(InLevel, InCategory);
+				using TupleType = std::tuple<Modio::Detail::LogCaptured<ArgTypes>...>;
+				if constexpr (FitsInPlace<TupleType>())
+				{
+					new (ArgStorage) TupleType(std::forward<ArgTypes>(Args)...);
+					Format = InFormat.Format;
+					FormatFn = &FormatCaptured<TupleType>;
+					DestroyFn = &DestroyCaptured<TupleType>;
+				}
+				else
+				{
+					CaptureFormatted(fmt::format(fmt::runtime(InFormat.Format), std::forward<ArgTypes>(Args)...));
+				}
+			}
+
+			/// @brief Captures a message whose format string is not known to be a literal, which is copied along with
+			/// the arguments
+			template<typename... ArgTypes>
+			void Capture(Modio::LogLevel InLevel, Modio::LogCategory InCategory, std::string InFormat,
+						 ArgTypes&&... Args)
+			{
+				SetHeader(InLevel, InCategory);
+				using TupleType = std::tuple<std::string, std::tuple<Modio::Detail::LogCaptured<ArgTypes>...>>;
+				if constexpr (FitsInPlace<TupleType>())
+				{
+					TupleType* Captured = new (ArgStorage) TupleType(
+						std::move(InFormat),
+						std::tuple<Modio::Detail::LogCaptured<ArgTypes>...>(std::forward<ArgTypes>(Args)...));
+					// The record is never moved while it holds arguments, so the pointer stays valid
+					Format = std::get<0>(*Captured).c_str();
+					FormatFn = &FormatCapturedWithOwnedFormat<TupleType>;
+					DestroyFn = &DestroyCaptured<TupleType>;
+				}
+				else
+				{
+					CaptureFormatted(fmt::format(fmt::runtime(InFormat), std::forward<ArgTypes>(Args)...));
+				}
+			}
+
+			/// @brief Appends the formatted message to Out
+			void FormatMessage(std::string& Out)
+			{
+				if (FormatFn != nullptr)
+				{
+					FormatFn(Out, Format, ArgStorage);
+				}
+			}
+
+			/// @brief Releases the captured arguments
+			void Reset()
+			{
+				if (DestroyFn != nullptr)
+				{
+					DestroyFn(ArgStorage);
+				}
+				Format = nullptr;
+				FormatFn = nullptr;
+				DestroyFn = nullptr;
+			}
+
+			Modio::LogLevel GetLevel() const
+			{
+				return Level;
+			}
+
+			Modio::LogCategory GetCategory() const
+			{
+				return Category;
+			}
+
+			std::chrono::system_clock::time_point GetTime() const
+			{
+				return Time;
+			}
+
+		private:
+			using FormatFnType = void (*)(std::string& Out, const char* Format, void* Captured);
+			using DestroyFnType = void (*)(void* Captured);
+
+			template<typename TupleType>
+			static constexpr bool FitsInPlace()
+			{
+				return sizeof(TupleType) <= sizeof(ArgStorage) && alignof(TupleType) <= alignof(std::max_align_t);
+			}
+
+			template<typename TupleType>
+			static void FormatCaptured(std::string& Out, const char* Format, void* Captured)
+			{
+				std::apply(
+					[&Out, Format](auto&... Args) {
+						fmt::format_to(std::back_inserter(Out), fmt::runtime(Format), Args...);
+					},
+					*static_cast<TupleType*>(Captured));
+			}
+
+			template<typename TupleType>
+			static void FormatCapturedWithOwnedFormat(std::string& Out, const char* Format, void* Captured)
+			{
+				FormatCaptured<typename std::tuple_element<1, TupleType>::type>(
+					Out, Format, &std::get<1>(*static_cast<TupleType*>(Captured)));
+			}
+
+			template<typename TupleType>
+			static void DestroyCaptured(void* Captured)
+			{
+				static_cast<TupleType*>(Captured)->~TupleType();
+			}
+
+			void SetHeader(Modio::LogLevel InLevel, Modio::LogCategory InCategory)
+			{
+				Level = InLevel;
+				Category = InCategory;
+				Time = std::chrono::system_clock::now();
+			}
+
+			/// @brief Fallback for arguments too large to be held in place: the message is formatted straight away
+			void CaptureFormatted(std::string Message)
+			{
+				using TupleType = std::tuple<std::string>;
+				static_assert(FitsInPlace<TupleType>(), "LogRecordArgStorageSize must be able to hold a string");
+				new (ArgStorage) TupleType(std::move(Message));
+				Format = "{}";
+				FormatFn = &FormatCaptured<TupleType>;
+				DestroyFn = &DestroyCaptured<TupleType>;
+			}
+
+			Modio::LogLevel Level = Modio::LogLevel::Trace;
+			Modio::LogCategory Category = Modio::LogCategory::Core;
+			std::chrono::system_clock::time_point Time {};
+			const char* Format = nullptr;
+			FormatFnType FormatFn = nullptr;
+			DestroyFnType DestroyFn = nullptr;
+			alignas(std::max_align_t) unsigned char ArgStorage[Constants::Configuration::LogRecordArgStorageSize] {};
+		};
+
+		/// @docinternal
+		/// @brief Fixed-size lock-free queue of LogRecords. Any number of threads may push records while another reads
+		/// them, and no memory is allocated once the buffer has been created beyond what copying the arguments needs.
+		/// A record pushed while the buffer is full is dropped and counted rather than blocking the thread logging it
+		class LogRingBuffer
+		{
+		public:
+			/// @param Capacity Number of records the buffer holds. Must be a power of two
+			explicit LogRingBuffer(std::size_t Capacity)
+				: Cells(new Cell[Capacity]),
+				  Mask(Capacity - 1)
+			{
+				for (std::size_t Index = 0; Index < Capacity; ++Index)
+				{
+					Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+				}
+			}
+
+			/// @brief Captures a message into the next free record
+			/// @return false if the buffer was full and the message was dropped
+			template<typename FormatType, typename... ArgTypes>
+			bool TryPush(Modio::LogLevel Level, Modio::LogCategory Category, FormatType&& Format, ArgTypes&&... Args)
+			{
+				std::size_t Position = EnqueuePosition.load(std::memory_order_relaxed);
+				Cell* Target = nullptr;
+				while (true)
+				{
+					Target = &Cells[Position & Mask];
+					std::size_t Sequence = Target->Sequence.load(std::memory_order_acquire);
+					std::intptr_t Difference =
+						static_cast<std::intptr_t>(Sequence) - static_cast<std::intptr_t>(Position);
+					if (Difference == 0)
+					{
+						if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (Difference < 0)
+					{
+						DroppedCount.fetch_add(1, std::memory_order_relaxed);
+						return false;
+					}
+					else
+					{
+						Position = EnqueuePosition.load(std::memory_order_relaxed);
+					}
+				}
+
+				Target->Record.Capture(Level, Category, std::forward<FormatType>(Format),
+									   std::forward<ArgTypes>(Args)...);
+				Target->Sequence.store(Position + 1, std::memory_order_release);
+				return true;
+			}
+
+			/// @brief Passes every record that has been pushed so far to Consumer, oldest first, then releases it. The
+			/// record is released even if Consumer throws, so the buffer keeps accepting records
+			/// @return The number of records consumed
+			template<typename ConsumerType>
+			std::size_t ConsumeAll(ConsumerType&& Consumer)
+			{
+				std::size_t NumConsumed = 0;
+				std::size_t Position = DequeuePosition.load(std::memory_order_relaxed);
+				while (true)
+				{
+					Cell* Source = &Cells[Position & Mask];
+					std::size_t Sequence = Source->Sequence.load(std::memory_order_acquire);
+					std::intptr_t Difference =
+						static_cast<std::intptr_t>(Sequence) - static_cast<std::intptr_t>(Position + 1);
+					if (Difference < 0)
+					{
+						// Empty, or the next record is still being written
+						return NumConsumed;
+					}
+					if (Difference > 0 ||
+						!DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+					{
+						Position = DequeuePosition.load(std::memory_order_relaxed);
+						continue;
+					}
+
+					{
+						CellRelease Release {Source, Position + Mask + 1};
+						Consumer(Source->Record);
+					}
+					++NumConsumed;
+					++Position;
+				}
+			}
+
+			/// @return The number of records dropped because the buffer was full, since it was created
+			std::uint64_t GetDroppedCount() const
+			{
+				return DroppedCount.load(std::memory_order_relaxed);
+			}
+
+		private:
+			struct Cell
+			{
+				std::atomic<std::size_t> Sequence;
+				LogRecord Record;
+			};
+
+			/// @brief Hands a consumed cell back to the producers when it goes out of scope
+			struct CellRelease
+			{
+				Cell* Source;
+				std::size_t NextSequence;
+
+				~CellRelease()
+				{
+					Source->Record.Reset();
+					Source->Sequence.store(NextSequence, std::memory_order_release);
+				}
+			};
+
+			std::unique_ptr<Cell[]> Cells;
+			std::size_t Mask;
+			// Kept on separate cache lines so producers and the consumer do not contend for them
+			alignas(64) std::atomic<std::size_t> EnqueuePosition {0};
+			alignas(64) std::atomic<std::size_t> DequeuePosition {0};
+			std::atomic<std::uint64_t> DroppedCount {0};
+		};
+	} // namespace Detail
+} // namespace Modio
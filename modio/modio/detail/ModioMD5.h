@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioSDKForwardDecls.h"
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		class Buffer;
+
+		/// @brief Streaming MD5 digest (RFC 1321), matching the `filehash.md5` the REST API reports for modfiles.
+		/// Data can be fed in arbitrarily sized pieces as it is produced or consumed
+		class MD5
+		{
+		public:
+			static constexpr std::size_t DigestSize = 16;
+			using DigestType = std::array<std::uint8_t, DigestSize>;
+
+			MODIO_IMPL MD5();
+
+			/// @brief Adds bytes to the digest
+			MODIO_IMPL void Update(const unsigned char* Data, std::size_t Size);
+
+			/// @brief Adds the contents of a buffer to the digest. Passed by reference because the data is only read
+			MODIO_IMPL void Update(const Modio::Detail::Buffer& Data);
+
+			/// @brief Computes the digest of all the bytes added so far. Does not modify the running state, so more
+			/// data can still be added afterwards
+			MODIO_IMPL DigestType GetDigest() const;
+
+			/// @brief Same as GetDigest, formatted as 32 lowercase hexadecimal characters like the REST API does
+			MODIO_IMPL std::string GetHexDigest() const;
+
+			/// @brief Number of bytes added to the digest so far
+			MODIO_IMPL std::uint64_t GetBytesHashed() const;
+
+			/// @brief Serializes the running state, so hashing can be resumed from the same point in a later session
+			/// without feeding the bytes hashed so far again
+			MODIO_IMPL Modio::Detail::Buffer SaveState() const;
+
+			/// @brief Restores a running state produced by SaveState
+			/// @return false if SavedState is not a valid state, in which case this digest is left unchanged
+			MODIO_IMPL bool LoadState(const Modio::Detail::Buffer& SavedState);
+
+		private:
+			/// @brief Size of a saved state before the bytes of the pending block: the byte count and the state words
+			static constexpr std::size_t SavedStateHeaderSize = 8 + 4 * 4;
+
+			MODIO_IMPL void ProcessBlock(const unsigned char* Block);
+
+			std::array<std::uint32_t, 4> State;
+			std::array<unsigned char, 64> PendingBlock;
+			std::uint64_t BytesHashed = 0;
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioMD5.ipp"
+#endif
@@ -0,0 +1,234 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioMD5.h"
+#endif
+
+#include "modio/core/ModioBuffer.h"
+#include <algorithm>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		// Per-round shift amounts
+		constexpr std::uint32_t MD5Shifts[64] = {7,	 12, 17, 22, 7,	 12, 17, 22, 7,	 12, 17, 22, 7,	 12, 17, 22,
+												 5,	 9,	 14, 20, 5,	 9,	 14, 20, 5,	 9,	 14, 20, 5,	 9,	 14, 20,
+												 4,	 11, 16, 23, 4,	 11, 16, 23, 4,	 11, 16, 23, 4,	 11, 16, 23,
+												 6,	 10, 15, 21, 6,	 10, 15, 21, 6,	 10, 15, 21, 6,	 10, 15, 21};
+
+		// floor(abs(sin(i + 1)) * 2^32)
+		constexpr std::uint32_t MD5Constants[64] = {
+			0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+			0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+			0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+			0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+			0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+			0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+			0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+			0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+		MD5::MD5() : State {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476}, PendingBlock {} {}
+
+		void MD5::Update(const unsigned char* Data, std::size_t Size)
+		{
+			std::size_t PendingSize = static_cast<std::size_t>(BytesHashed % PendingBlock.size());
+			BytesHashed += Size;
+
+			// Complete a block left over from a previous call first
+			if (PendingSize > 0)
+			{
+				std::size_t BytesToCopy = std::min(Size, PendingBlock.size() - PendingSize);
+				std::copy(Data, Data + BytesToCopy, PendingBlock.data() + PendingSize);
+				Data += BytesToCopy;
+				Size -= BytesToCopy;
+				if (PendingSize + BytesToCopy < PendingBlock.size())
+				{
+					return;
+				}
+				ProcessBlock(PendingBlock.data());
+			}
+
+			// Whole blocks are processed straight from the caller's memory
+			while (Size >= PendingBlock.size())
+			{
+				ProcessBlock(Data);
+				Data += PendingBlock.size();
+				Size -= PendingBlock.size();
+			}
+
+			std::copy(Data, Data + Size, PendingBlock.data());
+		}
+
+		void MD5::Update(const Modio::Detail::Buffer& Data)
+		{
+			Update(Data.Data(), Data.GetSize());
+		}
+
+		MD5::DigestType MD5::GetDigest() const
+		{
+			// Pad a copy so the running state is left untouched
+			MD5 Final = *this;
+
+			std::uint64_t MessageBits = BytesHashed * 8;
+			std::array<unsigned char, 72> Padding {};
+			Padding[0] = 0x80;
+			std::size_t PendingSize = static_cast<std::size_t>(BytesHashed % PendingBlock.size());
+			// Pad to 56 bytes modulo 64, leaving room for the 8-byte message length
+			std::size_t PaddingSize = PendingSize < 56 ? 56 - PendingSize : 120 - PendingSize;
+			for (std::size_t ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+			{
+				Padding[PaddingSize + ByteIndex] = static_cast<unsigned char>(MessageBits >> (8 * ByteIndex));
+			}
+			Final.Update(Padding.data(), PaddingSize + 8);
+
+			DigestType Digest {};
+			for (std::size_t WordIndex = 0; WordIndex < Final.State.size(); ++WordIndex)
+			{
+				for (std::size_t ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+				{
+					Digest[WordIndex * 4 + ByteIndex] =
+						static_cast<std::uint8_t>(Final.State[WordIndex] >> (8 * ByteIndex));
+				}
+			}
+			return Digest;
+		}
+
+		std::string MD5::GetHexDigest() const
+		{
+			constexpr char HexDigits[] = "0123456789abcdef";
+			DigestType Digest = GetDigest();
+			std::string HexDigest;
+			HexDigest.reserve(DigestSize * 2);
+			for (std::uint8_t DigestByte : Digest)
+			{
+				HexDigest.push_back(HexDigits[DigestByte >> 4]);
+				HexDigest.push_back(HexDigits[DigestByte & 0x0f]);
+			}
+			return HexDigest;
+		}
+
+		std::uint64_t MD5::GetBytesHashed() const
+		{
+			return BytesHashed;
+		}
+
+		Modio::Detail::Buffer MD5::SaveState() const
+		{
+			std::size_t PendingSize = static_cast<std::size_t>(BytesHashed % PendingBlock.size());
+			Modio::Detail::Buffer SavedState(SavedStateHeaderSize + PendingSize);
+			unsigned char* Output = SavedState.Data();
+			for (std::size_t ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+			{
+				*Output++ = static_cast<unsigned char>(BytesHashed >> (8 * ByteIndex));
+			}
+			for (std::uint32_t Word : State)
+			{
+				for (std::size_t ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+				{
+					*Output++ = static_cast<unsigned char>(Word >> (8 * ByteIndex));
+				}
+			}
+			std::copy(PendingBlock.data(), PendingBlock.data() + PendingSize, Output);
+			return SavedState;
+		}
+
+		bool MD5::LoadState(const Modio::Detail::Buffer& SavedState)
+		{
+			if (SavedState.GetSize() < SavedStateHeaderSize)
+			{
+				return false;
+			}
+
+			const unsigned char* Input = SavedState.Data();
+			std::uint64_t SavedBytesHashed = 0;
+			for (std::size_t ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+			{
+				SavedBytesHashed |= std::uint64_t(*Input++) << (8 * ByteIndex);
+			}
+
+			// The saved pending block must be exactly as long as the byte count implies
+			std::size_t PendingSize = static_cast<std::size_t>(SavedBytesHashed % PendingBlock.size());
+			if (SavedState.GetSize() != SavedStateHeaderSize + PendingSize)
+			{
+				return false;
+			}
+
+			BytesHashed = SavedBytesHashed;
+			for (std::uint32_t& Word : State)
+			{
+				Word = 0;
+				for (std::size_t ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+				{
+					Word |= std::uint32_t(*Input++) << (8 * ByteIndex);
+				}
+			}
+			std::copy(Input, Input + PendingSize, PendingBlock.data());
+			return true;
+		}
+
+		void MD5::ProcessBlock(const unsigned char* Block)
+		{
+			// Assembled byte by byte rather than through a cast so the result does not depend on the alignment or
+			// endianness of the block
+			std::uint32_t Words[16];
+			for (std::size_t WordIndex = 0; WordIndex < 16; ++WordIndex)
+			{
+				Words[WordIndex] = std::uint32_t(Block[WordIndex * 4]) |
+								   (std::uint32_t(Block[WordIndex * 4 + 1]) << 8) |
+								   (std::uint32_t(Block[WordIndex * 4 + 2]) << 16) |
+								   (std::uint32_t(Block[WordIndex * 4 + 3]) << 24);
+			}
+
+			std::uint32_t A = State[0];
+			std::uint32_t B = State[1];
+			std::uint32_t C = State[2];
+			std::uint32_t D = State[3];
+
+			for (std::uint32_t Round = 0; Round < 64; ++Round)
+			{
+				std::uint32_t F = 0;
+				std::uint32_t WordIndex = 0;
+				if (Round < 16)
+				{
+					F = (B & C) | (~B & D);
+					WordIndex = Round;
+				}
+				else if (Round < 32)
+				{
+					F = (D & B) | (~D & C);
+					WordIndex = (5 * Round + 1) % 16;
+				}
+				else if (Round < 48)
+				{
+					F = B ^ C ^ D;
+					WordIndex = (3 * Round + 5) % 16;
+				}
+				else
+				{
+					F = C ^ (B | ~D);
+					WordIndex = (7 * Round) % 16;
+				}
+
+				F = F + A + MD5Constants[Round] + Words[WordIndex];
+				A = D;
+				D = C;
+				C = B;
+				B = B + ((F << MD5Shifts[Round]) | (F >> (32 - MD5Shifts[Round])));
+			}
+
+			State[0] += A;
+			State[1] += B;
+			State[2] += C;
+			State[3] += D;
+		}
+	} // namespace Detail
+} // namespace Modio
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioCoreTypes.h"
+#include <cstdint>
+#include <mutex>
+#include <set>
+
+namespace Modio
+{
+	class ModCollection;
+
+	namespace Detail
+	{
+		class Buffer;
+
+		/// @brief Write-ahead journal of the changes made to the system mod collection. Rather than rewriting the saved
+		/// collection after every change, each save appends a record for every entry that changed since the previous
+		/// save to state.journal. Entries report their changes as they are made, so a save only visits the entries that
+		/// changed, and their records only hold the fields that changed. Once the journal grows past a threshold the
+		/// next save compacts it: the whole collection is written to the state.bin snapshot under a new generation, and
+		/// the journal starts over for that generation.
+		///
+		/// The journal begins with a header holding the generation of the snapshot it applies to. Each record is a
+		/// 4-byte payload length, the 4-byte CRC32 of the payload and the payload itself, which is either the JSON of
+		/// the ID and changed fields of an entry or a removal marker. Integers are little endian. A journal for another
+		/// generation was left behind by a compaction interrupted after the snapshot was replaced and is ignored.
+		/// Replay stops at the first incomplete or corrupt record, which can only be the tail of an append interrupted
+		/// by a crash.
+		class ModCollectionJournal
+		{
+		public:
+			static constexpr std::size_t HeaderSize = 4 + 8;
+			static constexpr std::size_t RecordHeaderSize = 4 + 4;
+
+			/// @brief Sets up the journal after loading a collection that has no usable journal, so the next save
+			/// compacts
+			/// @param SnapshotGeneration Generation stored in the snapshot
+			MODIO_IMPL void Reset(std::uint64_t SnapshotGeneration, const Modio::ModCollection& Collection);
+
+			/// @brief Applies the records of a journal to the collection loaded from the snapshot, and sets up the
+			/// journal so the next save appends after the last valid record
+			/// @param JournalData Contents of state.journal
+			/// @param SnapshotGeneration Generation stored in the snapshot
+			MODIO_IMPL void Replay(const Modio::Detail::Buffer& JournalData, std::uint64_t SnapshotGeneration,
+								   Modio::ModCollection& Collection);
+
+			/// @brief Size of the valid part of the journal on disk, which is where the next records are written
+			MODIO_IMPL std::uint64_t GetSize() const;
+
+			/// @brief true if the next save has to write the whole collection to the snapshot
+			MODIO_IMPL bool NeedsCompaction() const;
+
+			/// @brief Encodes a record for every entry that was added, changed or removed since the last save, and
+			/// considers those changes saved. The records must be written at the offset GetSize returned beforehand
+			/// @return The encoded records, empty if nothing changed
+			MODIO_IMPL Modio::Detail::Buffer CaptureChanges(const Modio::ModCollection& Collection);
+
+			/// @brief Called by an entry whenever one of its persisted fields changes, and by a collection when it
+			/// removes an entry. Entries of any collection report their changes, the ones that are not in the system
+			/// collection are skipped by the next save
+			MODIO_IMPL static void NotifyEntryChanged(Modio::ModID ID);
+
+			/// @brief Makes the next save compact the journal, because the records on disk may not match what was
+			/// captured
+			MODIO_IMPL void MarkCompactionRequired();
+
+			/// @brief Starts a compaction, considering every entry of the collection saved
+			/// @return The generation to store in the new snapshot
+			MODIO_IMPL std::uint64_t BeginCompaction(const Modio::ModCollection& Collection);
+
+			/// @brief Header of an empty journal for the current generation
+			MODIO_IMPL Modio::Detail::Buffer MakeHeader() const;
+
+			/// @brief Called once the new snapshot and the header of its journal are on disk
+			MODIO_IMPL void CompleteCompaction();
+
+		private:
+			/// @brief IDs of the entries changed since the last save, filled by NotifyEntryChanged
+			struct ChangedEntries
+			{
+				std::mutex Mutex {};
+				std::set<Modio::ModID> IDs {};
+			};
+
+			MODIO_IMPL static ChangedEntries& GetChangedEntries();
+
+			/// @brief Considers every entry of the collection saved, as it is when it was just loaded or written whole
+			MODIO_IMPL void MarkAllSaved(const Modio::ModCollection& Collection);
+
+			std::uint64_t Generation = 0;
+			std::uint64_t Size = 0;
+			std::uint32_t NumRecords = 0;
+			bool bCompactionRequired = true;
+			/// @brief IDs of the entries on disk as of the last save
+			std::set<Modio::ModID> SavedIDs {};
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioModCollectionJournal.ipp"
+#endif
@@ -0,0 +1,280 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioModCollectionJournal.h"
+#endif
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioLogger.h"
+#include "modio/core/ModioModCollectionEntry.h"
+#include "modio/detail/ModioCRC.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/serialization/ModioModCollectionEntrySerialization.h"
+#include <algorithm>
+#include <string>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		constexpr unsigned char ModCollectionJournalMagic[4] = {'M', 'C', 'J', '1'};
+
+		inline std::uint64_t ReadJournalInteger(const unsigned char* Data, std::size_t NumBytes)
+		{
+			std::uint64_t Value = 0;
+			for (std::size_t ByteIndex = 0; ByteIndex < NumBytes; ++ByteIndex)
+			{
+				Value |= std::uint64_t(Data[ByteIndex]) << (8 * ByteIndex);
+			}
+			return Value;
+		}
+
+		inline void AppendJournalInteger(std::string& Output, std::uint64_t Value, std::size_t NumBytes)
+		{
+			for (std::size_t ByteIndex = 0; ByteIndex < NumBytes; ++ByteIndex)
+			{
+				Output.push_back(static_cast<char>(Value >> (8 * ByteIndex)));
+			}
+		}
+
+		inline void AppendJournalRecord(std::string& Output, const nlohmann::json& Payload)
+		{
+			std::string PayloadString = Payload.dump();
+			AppendJournalInteger(Output, PayloadString.size(), 4);
+			AppendJournalInteger(
+				Output,
+				Modio::Detail::CRC32(reinterpret_cast<const unsigned char*>(PayloadString.data()), PayloadString.size()),
+				4);
+			Output += PayloadString;
+		}
+
+		void ModCollectionJournal::Reset(std::uint64_t SnapshotGeneration, const Modio::ModCollection& Collection)
+		{
+			Generation = SnapshotGeneration;
+			Size = 0;
+			NumRecords = 0;
+			bCompactionRequired = true;
+			MarkAllSaved(Collection);
+		}
+
+		void ModCollectionJournal::Replay(const Modio::Detail::Buffer& JournalData, std::uint64_t SnapshotGeneration,
+										  Modio::ModCollection& Collection)
+		{
+			const unsigned char* Data = JournalData.Data();
+			const std::size_t DataSize = JournalData.GetSize();
+
+			if (DataSize < HeaderSize ||
+				!std::equal(std::begin(ModCollectionJournalMagic), std::end(ModCollectionJournalMagic), Data))
+			{
+				Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::ModManagement,
+											"Mod collection journal has no valid header, ignoring it");
+				Reset(SnapshotGeneration, Collection);
+				return;
+			}
+
+			std::uint64_t JournalGeneration = ReadJournalInteger(Data + 4, 8);
+			if (JournalGeneration != SnapshotGeneration)
+			{
+				// the snapshot was compacted but the journal was not restarted before the SDK stopped, so every record
+				// in it is already part of the snapshot. A journal newer than the collection was written after an
+				// older state.json export that is being recovered from; the next generation is kept past it so its
+				// records can never match a later snapshot
+				Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+											"Ignoring mod collection journal for generation {}, the snapshot is "
+											"generation {}",
+											JournalGeneration, SnapshotGeneration);
+				Reset(std::max(SnapshotGeneration, JournalGeneration), Collection);
+				return;
+			}
+
+			std::size_t Offset = HeaderSize;
+			std::uint32_t NumReplayedRecords = 0;
+			while (DataSize - Offset >= RecordHeaderSize)
+			{
+				std::size_t PayloadSize = static_cast<std::size_t>(ReadJournalInteger(Data + Offset, 4));
+				std::uint32_t ExpectedCRC = static_cast<std::uint32_t>(ReadJournalInteger(Data + Offset + 4, 4));
+				if (PayloadSize > DataSize - Offset - RecordHeaderSize)
+				{
+					break;
+				}
+
+				const unsigned char* PayloadStart = Data + Offset + RecordHeaderSize;
+				if (Modio::Detail::CRC32(PayloadStart, PayloadSize) != ExpectedCRC)
+				{
+					break;
+				}
+
+				nlohmann::json Record =
+					nlohmann::json::parse(PayloadStart, PayloadStart + PayloadSize, nullptr, false);
+				if (Record.is_discarded() || !Record.is_object())
+				{
+					break;
+				}
+
+				bool bRemoved = false;
+				Modio::Detail::ParseSafe(Record, bRemoved, Modio::Detail::Constants::JSONKeys::ModEntryRemoved);
+				if (bRemoved)
+				{
+					Modio::ModID RemovedID {};
+					Modio::Detail::ParseSafe(Record, RemovedID, Modio::Detail::Constants::JSONKeys::ModEntryID);
+					Collection.Entries().erase(RemovedID);
+				}
+				else
+				{
+					// A record only holds the fields that changed, so it is applied on top of the entry
+					Modio::ModID ChangedID {};
+					Modio::Detail::ParseSafe(Record, ChangedID, Modio::Detail::Constants::JSONKeys::ModEntryID);
+					std::shared_ptr<Modio::ModCollectionEntry>& Entry = Collection.Entries()[ChangedID];
+					if (Entry == nullptr)
+					{
+						Entry = std::make_shared<Modio::ModCollectionEntry>();
+					}
+					from_json(Record, *Entry);
+				}
+
+				Offset += RecordHeaderSize + PayloadSize;
+				NumReplayedRecords++;
+			}
+
+			if (Offset < DataSize)
+			{
+				Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::ModManagement,
+											"Discarding {} bytes of incomplete records at the end of the mod "
+											"collection journal",
+											DataSize - Offset);
+			}
+			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::ModManagement,
+										"Replayed {} mod collection journal records", NumReplayedRecords);
+
+			Generation = SnapshotGeneration;
+			Size = Offset;
+			NumRecords = NumReplayedRecords;
+			bCompactionRequired = false;
+			MarkAllSaved(Collection);
+		}
+
+		std::uint64_t ModCollectionJournal::GetSize() const
+		{
+			return Size;
+		}
+
+		bool ModCollectionJournal::NeedsCompaction() const
+		{
+			return bCompactionRequired ||
+				   NumRecords >= Modio::Detail::Constants::Configuration::ModCollectionJournalMaxRecords ||
+				   Size >= Modio::Detail::Constants::Configuration::ModCollectionJournalMaxSize;
+		}
+
+		Modio::Detail::Buffer ModCollectionJournal::CaptureChanges(const Modio::ModCollection& Collection)
+		{
+			std::set<Modio::ModID> ChangedIDs;
+			{
+				ChangedEntries& Changed = GetChangedEntries();
+				std::lock_guard<std::mutex> Lock(Changed.Mutex);
+				ChangedIDs.swap(Changed.IDs);
+			}
+
+			std::string Records;
+			for (Modio::ModID ChangedID : ChangedIDs)
+			{
+				auto Entry = Collection.Entries().find(ChangedID);
+				if (Entry != Collection.Entries().end())
+				{
+					std::uint32_t ChangedFields = Entry->second->TakeUnsavedFields();
+					// An entry the journal has not saved yet is written whole, whatever it was copied from
+					if (SavedIDs.insert(ChangedID).second)
+					{
+						ChangedFields = Modio::ModCollectionEntry::PersistedField::All;
+					}
+					if (ChangedFields != 0)
+					{
+						AppendJournalRecord(Records,
+											Modio::ModCollectionEntryFieldsToJson(*Entry->second, ChangedFields));
+						NumRecords++;
+					}
+				}
+				else if (SavedIDs.erase(ChangedID) > 0)
+				{
+					AppendJournalRecord(Records, nlohmann::json::object(
+													 {{Modio::Detail::Constants::JSONKeys::ModEntryID, ChangedID},
+													  {Modio::Detail::Constants::JSONKeys::ModEntryRemoved, true}}));
+					NumRecords++;
+				}
+			}
+
+			Modio::Detail::Buffer RecordBuffer(Records.size());
+			std::copy(Records.begin(), Records.end(), RecordBuffer.begin());
+			Size += Records.size();
+			return RecordBuffer;
+		}
+
+		void ModCollectionJournal::NotifyEntryChanged(Modio::ModID ID)
+		{
+			ChangedEntries& Changed = GetChangedEntries();
+			std::lock_guard<std::mutex> Lock(Changed.Mutex);
+			Changed.IDs.insert(ID);
+		}
+
+		void ModCollectionJournal::MarkCompactionRequired()
+		{
+			bCompactionRequired = true;
+		}
+
+		std::uint64_t ModCollectionJournal::BeginCompaction(const Modio::ModCollection& Collection)
+		{
+			// Stays set until CompleteCompaction, so a compaction that fails is attempted again by the next save
+			bCompactionRequired = true;
+			Generation++;
+			Size = HeaderSize;
+			NumRecords = 0;
+			MarkAllSaved(Collection);
+			return Generation;
+		}
+
+		Modio::Detail::Buffer ModCollectionJournal::MakeHeader() const
+		{
+			std::string Header(std::begin(ModCollectionJournalMagic), std::end(ModCollectionJournalMagic));
+			AppendJournalInteger(Header, Generation, 8);
+
+			Modio::Detail::Buffer HeaderBuffer(Header.size());
+			std::copy(Header.begin(), Header.end(), HeaderBuffer.begin());
+			return HeaderBuffer;
+		}
+
+		void ModCollectionJournal::CompleteCompaction()
+		{
+			bCompactionRequired = false;
+		}
+
+		ModCollectionJournal::ChangedEntries& ModCollectionJournal::GetChangedEntries()
+		{
+			static ChangedEntries Instance;
+			return Instance;
+		}
+
+		void ModCollectionJournal::MarkAllSaved(const Modio::ModCollection& Collection)
+		{
+			{
+				ChangedEntries& Changed = GetChangedEntries();
+				std::lock_guard<std::mutex> Lock(Changed.Mutex);
+				Changed.IDs.clear();
+			}
+
+			SavedIDs.clear();
+			for (const auto& Entry : Collection.Entries())
+			{
+				Entry.second->TakeUnsavedFields();
+				SavedIDs.insert(Entry.first);
+			}
+		}
+	} // namespace Detail
+} // namespace Modio
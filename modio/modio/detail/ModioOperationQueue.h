@@ -16,7 +16,9 @@
 #include "modio/detail/AsioWrapper.h"
 #include "modio/detail/Function2Wrapper.h"
 #include "modio/detail/ModioProfiling.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include <atomic>
+#include <chrono>
 #include <deque>
 #include <memory>
 
@@ -26,18 +28,27 @@ namespace Modio
 	{
 		class OperationQueue : public std::enable_shared_from_this<OperationQueue>
 		{
+			struct QueuedOperation
+			{
+				fu2::unique_function<void()> Operation;
+				// For the wait time reported by Modio::QueryRuntimeStats
+				std::chrono::steady_clock::time_point QueuedAt;
+			};
+
 			std::atomic<bool> OperationInProgress {};
 			std::atomic<std::int32_t> NumWaiters {};
 			// ModioAsio::steady_timer QueueImpl;
-			std::deque<fu2::unique_function<void()>> QueueImpl {};
+			std::deque<QueuedOperation> QueueImpl {};
 			std::atomic<bool> bWasCancelled {};
 			std::string QueueName {};
+			std::shared_ptr<Modio::Detail::OperationQueueStatsRecord> Stats {};
 
 		public:
 			OperationQueue(ModioAsio::io_context& MODIO_UNUSED_ARGUMENT(OwningContext), const char* QueueName)
 				: OperationInProgress(false),
 				  NumWaiters(0),
-				  QueueName(QueueName)
+				  QueueName(QueueName),
+				  Stats(Modio::Detail::RuntimeStatsCollector::Get().RegisterQueue(QueueName))
 			// QueueImpl(OwningContext, std::chrono::steady_clock::time_point::max())
 			{}
 			OperationQueue(const OperationQueue& Other) = delete;
@@ -130,11 +141,14 @@ namespace Modio
 					++NumWaiters;
 					// Preserve the associated executor of the queued operation
 
-					QueueImpl.push_back(std::forward<OperationType>(Operation));
+					QueueImpl.push_back(
+						QueuedOperation {std::forward<OperationType>(Operation), std::chrono::steady_clock::now()});
 					MODIO_PROFILE_COUNTER_SET_NAMED(QueueName.c_str(), std::uint64_t(NumWaiters.load()));
+					Stats->SetDepth(std::uint32_t(NumWaiters.load()));
 				}
 				else
 				{
+					Stats->Wait.Record(std::chrono::steady_clock::duration::zero());
 					ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(),
 							   std::forward<OperationType>(Operation));
 				}
@@ -152,10 +166,12 @@ namespace Modio
 				if (NumWaiters > 0)
 				{
 					--NumWaiters;
+					Stats->Wait.Record(std::chrono::steady_clock::now() - QueueImpl.front().QueuedAt);
 					ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(),
-							   std::move(QueueImpl.front()));
+							   std::move(QueueImpl.front().Operation));
 					QueueImpl.pop_front();
 					MODIO_PROFILE_COUNTER_SET_NAMED(QueueName.c_str(), std::uint64_t(NumWaiters.load()));
+					Stats->SetDepth(std::uint32_t(NumWaiters.load()));
 				}
 			}
 
@@ -170,9 +186,10 @@ namespace Modio
 				// QueueImpl.cancel();
 				for (auto& QueueEntry : QueueImpl)
 				{
-					QueueEntry();
+					QueueEntry.Operation();
 				}
 				QueueImpl.clear();
+				Stats->SetDepth(0);
 
 				OperationInProgress.exchange(false);
 			}
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioCoreTypes.h"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Modio
+{
+	class ModCollection;
+	class ModCollectionEntry;
+	class UserSubscriptionList;
+
+	namespace Detail
+	{
+		/// @brief Index of the entries of the system mod collection that mod management has work to do for, so the
+		/// mod management loop can pick the next mod without copying or sorting the collection on every tick.
+		///
+		/// The index is bucketed by state: entries pending uninstallation regardless of who subscribed to them, and
+		/// entries the current user is subscribed to that are pending installation or update. It is rebuilt only once
+		/// the collection, the subscription list or any entry has changed since it was last built, which the
+		/// revisions of those objects tell without looking at them, so a tick with nothing to do costs the same
+		/// however large the collection is. Whether an entry can be retried changes without a new revision, so that is
+		/// checked when an entry is picked, over the pending entries only. Like the rest of the session data, the index
+		/// is only used from the thread running the SDK's handlers.
+		class PendingModIndex
+		{
+		public:
+			/// @return The next entry pending uninstallation that can be retried, or null if there is none
+			MODIO_IMPL std::shared_ptr<Modio::ModCollectionEntry> GetNextPendingUninstall(
+				const Modio::ModCollection& SystemCollection, const Modio::UserSubscriptionList& UserSubscriptions);
+
+			/// @return The next entry the user is subscribed to that is pending installation or update and can be
+			/// retried, or null if there is none. Entries that have not failed yet this session come first
+			MODIO_IMPL std::shared_ptr<Modio::ModCollectionEntry> GetNextPendingInstallOrUpdate(
+				const Modio::ModCollection& SystemCollection, const Modio::UserSubscriptionList& UserSubscriptions);
+
+			/// @return The entry for the mod if the user is subscribed to it and it is pending installation or update,
+			/// whether or not it can be retried, or null otherwise
+			MODIO_IMPL std::shared_ptr<Modio::ModCollectionEntry> FindPendingInstallOrUpdate(
+				const Modio::ModCollection& SystemCollection, const Modio::UserSubscriptionList& UserSubscriptions,
+				Modio::ModID ModId);
+
+		private:
+			MODIO_IMPL void Refresh(const Modio::ModCollection& SystemCollection,
+									const Modio::UserSubscriptionList& UserSubscriptions);
+
+			std::uint64_t CollectionRevision = std::numeric_limits<std::uint64_t>::max();
+			std::uint64_t SubscriptionsRevision = std::numeric_limits<std::uint64_t>::max();
+			std::uint64_t EntriesRevision = std::numeric_limits<std::uint64_t>::max();
+
+			std::vector<std::shared_ptr<Modio::ModCollectionEntry>> PendingUninstalls {};
+			std::vector<std::shared_ptr<Modio::ModCollectionEntry>> PendingInstallsOrUpdates {};
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioPendingModIndex.ipp"
+#endif
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioPendingModIndex.h"
+#endif
+
+#include "modio/core/ModioModCollectionEntry.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/ModioProfiling.h"
+
+namespace Modio
+{
+	namespace Detail
+	{
+		std::shared_ptr<Modio::ModCollectionEntry> PendingModIndex::GetNextPendingUninstall(
+			const Modio::ModCollection& SystemCollection, const Modio::UserSubscriptionList& UserSubscriptions)
+		{
+			Refresh(SystemCollection, UserSubscriptions);
+
+			for (const std::shared_ptr<Modio::ModCollectionEntry>& Entry : PendingUninstalls)
+			{
+				if (Entry->ShouldRetry())
+				{
+					return Entry;
+				}
+			}
+			return nullptr;
+		}
+
+		std::shared_ptr<Modio::ModCollectionEntry> PendingModIndex::GetNextPendingInstallOrUpdate(
+			const Modio::ModCollection& SystemCollection, const Modio::UserSubscriptionList& UserSubscriptions)
+		{
+			Refresh(SystemCollection, UserSubscriptions);
+
+			std::shared_ptr<Modio::ModCollectionEntry> RetriedEntry = nullptr;
+			for (const std::shared_ptr<Modio::ModCollectionEntry>& Entry : PendingInstallsOrUpdates)
+			{
+				if (Entry->ShouldRetry())
+				{
+					if (Entry->GetRetriesRemaining() == Modio::Detail::Constants::Configuration::DefaultNumberOfRetries)
+					{
+						return Entry;
+					}
+					if (RetriedEntry == nullptr)
+					{
+						RetriedEntry = Entry;
+					}
+				}
+			}
+			return RetriedEntry;
+		}
+
+		std::shared_ptr<Modio::ModCollectionEntry> PendingModIndex::FindPendingInstallOrUpdate(
+			const Modio::ModCollection& SystemCollection, const Modio::UserSubscriptionList& UserSubscriptions,
+			Modio::ModID ModId)
+		{
+			Refresh(SystemCollection, UserSubscriptions);
+
+			for (const std::shared_ptr<Modio::ModCollectionEntry>& Entry : PendingInstallsOrUpdates)
+			{
+				if (Entry->GetID() == ModId)
+				{
+					return Entry;
+				}
+			}
+			return nullptr;
+		}
+
+		void PendingModIndex::Refresh(const Modio::ModCollection& SystemCollection,
+									  const Modio::UserSubscriptionList& UserSubscriptions)
+		{
+			// Read before the entries are, so a change made while the index is being built is picked up next time
+			std::uint64_t LatestEntryRevision = Modio::ModCollectionEntry::GetLatestRevision();
+			if (CollectionRevision == SystemCollection.GetRevision() &&
+				SubscriptionsRevision == UserSubscriptions.GetRevision() && EntriesRevision == LatestEntryRevision)
+			{
+				return;
+			}
+
+			MODIO_PROFILE_SCOPE(PendingModIndexRefresh);
+
+			// Cleared rather than replaced, so rebuilding reuses the memory of the previous build
+			PendingUninstalls.clear();
+			PendingInstallsOrUpdates.clear();
+			for (const auto& Mod : SystemCollection.Entries())
+			{
+				Modio::ModState State = Mod.second->GetModState();
+				if (State == Modio::ModState::UninstallPending)
+				{
+					PendingUninstalls.push_back(Mod.second);
+				}
+				else if ((State == Modio::ModState::InstallationPending || State == Modio::ModState::UpdatePending) &&
+						 UserSubscriptions.Get().count(Mod.first))
+				{
+					PendingInstallsOrUpdates.push_back(Mod.second);
+				}
+			}
+
+			CollectionRevision = SystemCollection.GetRevision();
+			SubscriptionsRevision = UserSubscriptions.GetRevision();
+			EntriesRevision = LatestEntryRevision;
+		}
+	} // namespace Detail
+} // namespace Modio
@@ -0,0 +1,485 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+// Built-in backend for the profiling hooks declared in modio/detail/ModioProfiling.h, built as the modioProfiler
+// object library. Its definitions replace the weak stubs the SDK is compiled with, so linking it into an application
+// is all that is needed to profile the SDK.
+//
+// Every thread records into a buffer of its own, so recording an event only takes a lock the first time a thread
+// records in a capture, when it clears its buffer. Events are kept until the next capture starts, and modio_profile_save writes them out in the Chrome trace event format, which can be opened in
+// chrome://tracing or https://ui.perfetto.dev.
+//
+// If the MODIO_PROFILE_OUTPUT environment variable is set when the application starts, a capture is started straight
+// away and saved to the path it names when the application exits, so headless applications can be profiled without
+// any code changes.
+//
+// This file deliberately does not include ModioProfiling.h, as the weak declarations in it would conflict with the
+// definitions here.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		namespace Profiler
+		{
+			enum class EventType : std::uint8_t
+			{
+				Begin,
+				End,
+				Counter,
+				Instant,
+				ThreadName
+			};
+
+			struct Event
+			{
+				/// @brief Name of the event. Always points to a string that outlives the capture
+				const char* Name;
+				/// @brief Nanoseconds since the capture started
+				std::uint64_t Timestamp;
+				/// @brief Value of a counter event
+				std::uint64_t Value;
+				EventType Type;
+			};
+
+			constexpr std::size_t EventsPerChunk = 4096;
+			// Caps each thread at 256 chunks, a little over a million events or 32MiB. Events recorded past that are
+			// counted as dropped
+			constexpr std::size_t MaxChunksPerThread = 256;
+
+			/// @brief Events recorded by a single thread. Only the thread that owns the buffer writes to it, and the
+			/// number of events is published with release semantics so that it can be read while the thread records
+			struct ThreadBuffer
+			{
+				std::uint32_t ThreadIndex = 0;
+				/// @brief Capture the events in the buffer belong to
+				std::atomic<std::uint64_t> Generation {0};
+				std::unique_ptr<Event[]> Chunks[MaxChunksPerThread] {};
+				std::atomic<std::size_t> NumEvents {0};
+				std::atomic<std::uint64_t> NumDropped {0};
+				/// @brief Held by the owning thread while it clears the buffer for a new capture, and by Save while it
+				/// reads the buffer, so events are not overwritten while they are being saved
+				std::mutex ResetMutex;
+				/// @brief Interned copies of the counter names this thread has recorded, keyed by the pointer it
+				/// passed in. Only used by the owning thread
+				std::unordered_map<const char*, const char*> CounterNames;
+
+				void Record(const char* Name, std::uint64_t Timestamp, std::uint64_t Value, EventType Type)
+				{
+					std::size_t Index = NumEvents.load(std::memory_order_relaxed);
+					std::size_t ChunkIndex = Index / EventsPerChunk;
+					if (ChunkIndex >= MaxChunksPerThread)
+					{
+						NumDropped.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+					if (!Chunks[ChunkIndex])
+					{
+						Chunks[ChunkIndex].reset(new Event[EventsPerChunk]);
+					}
+					Chunks[ChunkIndex][Index % EventsPerChunk] = Event {Name, Timestamp, Value, Type};
+					NumEvents.store(Index + 1, std::memory_order_release);
+				}
+
+				const Event& Get(std::size_t Index) const
+				{
+					return Chunks[Index / EventsPerChunk][Index % EventsPerChunk];
+				}
+			};
+
+			class ProfilerState
+			{
+			public:
+				static ProfilerState& Get()
+				{
+					static ProfilerState Instance;
+					return Instance;
+				}
+
+				bool IsCapturing() const
+				{
+					return bCapturing.load(std::memory_order_relaxed);
+				}
+
+				void Start()
+				{
+					StartTime.store(Now(), std::memory_order_relaxed);
+					// Buffers are cleared by the threads that own them the next time they record, so no thread has to
+					// wait for another
+					Generation.fetch_add(1, std::memory_order_acq_rel);
+					bCapturing.store(true, std::memory_order_release);
+				}
+
+				void Stop()
+				{
+					bCapturing.store(false, std::memory_order_release);
+				}
+
+				void Record(const char* Name, std::uint64_t Value, EventType Type)
+				{
+					if (!IsCapturing())
+					{
+						return;
+					}
+					ThreadBuffer& Buffer = GetThreadBuffer();
+					std::uint64_t CurrentGeneration = Generation.load(std::memory_order_acquire);
+					if (Buffer.Generation.load(std::memory_order_relaxed) != CurrentGeneration)
+					{
+						std::lock_guard<std::mutex> BufferLock(Buffer.ResetMutex);
+						Buffer.Generation.store(CurrentGeneration, std::memory_order_release);
+						Buffer.NumEvents.store(0, std::memory_order_release);
+						Buffer.NumDropped.store(0, std::memory_order_relaxed);
+					}
+					Buffer.Record(Name, Now() - StartTime.load(std::memory_order_relaxed), Value, Type);
+				}
+
+				void NameThread(const char* Name)
+				{
+					ThreadBuffer& Buffer = GetThreadBuffer();
+					std::lock_guard<std::mutex> Lock(Mutex);
+					if (ThreadNames.size() <= Buffer.ThreadIndex)
+					{
+						ThreadNames.resize(Buffer.ThreadIndex + 1);
+					}
+					ThreadNames[Buffer.ThreadIndex] = Intern(Name);
+				}
+
+				/// @brief Records a counter whose name may not be a string literal, copying the name so that it lives
+				/// as long as the profiler
+				void RecordCounter(const char* Name, std::uint64_t Value)
+				{
+					Record(InternCounterName(Name), Value, EventType::Counter);
+				}
+
+				/// @brief Writes every event recorded since the capture started to Path, in the Chrome trace event
+				/// format
+				bool Save(const std::string& Path)
+				{
+					std::FILE* File = std::fopen(Path.c_str(), "wb");
+					if (File == nullptr)
+					{
+						return false;
+					}
+
+					std::lock_guard<std::mutex> Lock(Mutex);
+					std::uint64_t CurrentGeneration = Generation.load(std::memory_order_acquire);
+					std::string Output = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+					bool bFirst = true;
+					std::uint64_t NumDropped = 0;
+
+					for (const std::unique_ptr<ThreadBuffer>& Buffer : Buffers)
+					{
+						std::lock_guard<std::mutex> BufferLock(Buffer->ResetMutex);
+						if (Buffer->ThreadIndex < ThreadNames.size() && ThreadNames[Buffer->ThreadIndex] != nullptr)
+						{
+							AppendEvent(Output, bFirst, ThreadNames[Buffer->ThreadIndex], 0, 0, EventType::ThreadName,
+										Buffer->ThreadIndex);
+						}
+						// A thread that has not recorded since the capture started still holds the previous capture
+						if (Buffer->Generation.load(std::memory_order_acquire) != CurrentGeneration)
+						{
+							continue;
+						}
+
+						std::size_t NumEvents = Buffer->NumEvents.load(std::memory_order_acquire);
+						for (std::size_t Index = 0; Index < NumEvents; ++Index)
+						{
+							const Event& Recorded = Buffer->Get(Index);
+							AppendEvent(Output, bFirst, Recorded.Name, Recorded.Timestamp, Recorded.Value,
+										Recorded.Type, Buffer->ThreadIndex);
+							if (Output.size() > (1 << 20))
+							{
+								std::fwrite(Output.data(), 1, Output.size(), File);
+								Output.clear();
+							}
+						}
+						NumDropped += Buffer->NumDropped.load(std::memory_order_relaxed);
+					}
+
+					Output += "\n],\"otherData\":{\"droppedEvents\":\"";
+					Output += std::to_string(NumDropped);
+					Output += "\"}}\n";
+					std::fwrite(Output.data(), 1, Output.size(), File);
+					return std::fclose(File) == 0;
+				}
+
+			private:
+				static std::uint64_t Now()
+				{
+					return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+														   std::chrono::steady_clock::now().time_since_epoch())
+														   .count());
+				}
+
+				ThreadBuffer& GetThreadBuffer()
+				{
+					// Buffers are owned by the profiler rather than the thread, so a thread that exits during a capture
+					// still has its events saved
+					static thread_local ThreadBuffer* CurrentThreadBuffer = nullptr;
+					if (CurrentThreadBuffer == nullptr)
+					{
+						std::lock_guard<std::mutex> Lock(Mutex);
+						Buffers.push_back(std::make_unique<ThreadBuffer>());
+						CurrentThreadBuffer = Buffers.back().get();
+						CurrentThreadBuffer->ThreadIndex = static_cast<std::uint32_t>(Buffers.size());
+						CurrentThreadBuffer->Generation.store(Generation.load(std::memory_order_acquire),
+															  std::memory_order_relaxed);
+					}
+					return *CurrentThreadBuffer;
+				}
+
+				/// @brief Looks Name up in the current thread's cache, so the shared table is only locked the first time
+				/// a thread sees a name
+				const char* InternCounterName(const char* Name)
+				{
+					if (Name == nullptr)
+					{
+						Name = "";
+					}
+					ThreadBuffer& Buffer = GetThreadBuffer();
+					const char*& Interned = Buffer.CounterNames[Name];
+					// Names built at runtime may be freed and their memory reused for a different name, so a cached
+					// copy is only used if it still matches
+					if (Interned == nullptr || std::strcmp(Interned, Name) != 0)
+					{
+						std::lock_guard<std::mutex> Lock(Mutex);
+						Interned = Intern(Name);
+					}
+					return Interned;
+				}
+
+				const char* Intern(const char* Name)
+				{
+					return InternedNames.insert(Name != nullptr ? Name : "").first->c_str();
+				}
+
+				static void AppendEscaped(std::string& Output, const char* Value)
+				{
+					for (const char* Character = Value; *Character != '\0'; ++Character)
+					{
+						unsigned char Byte = static_cast<unsigned char>(*Character);
+						if (Byte == '"' || Byte == '\\')
+						{
+							Output += '\\';
+							Output += *Character;
+						}
+						else if (Byte < 0x20)
+						{
+							char Escaped[8];
+							std::snprintf(Escaped, sizeof(Escaped), "\\u%04x", Byte);
+							Output += Escaped;
+						}
+						else
+						{
+							Output += *Character;
+						}
+					}
+				}
+
+				static void AppendEvent(std::string& Output, bool& bFirst, const char* Name, std::uint64_t Timestamp,
+										std::uint64_t Value, EventType Type, std::uint32_t ThreadIndex)
+				{
+					if (!bFirst)
+					{
+						Output += ",\n";
+					}
+					bFirst = false;
+
+					Output += "{\"pid\":1,\"tid\":";
+					Output += std::to_string(ThreadIndex);
+					if (Type == EventType::ThreadName)
+					{
+						Output += ",\"ph\":\"M\",\"name\":\"thread_name\",\"args\":{\"name\":\"";
+						AppendEscaped(Output, Name);
+						Output += "\"}}";
+						return;
+					}
+
+					// Timestamps are in microseconds, with the nanoseconds kept as the fraction
+					char TimestampString[32];
+					std::snprintf(TimestampString, sizeof(TimestampString), "%llu.%03llu",
+								  static_cast<unsigned long long>(Timestamp / 1000),
+								  static_cast<unsigned long long>(Timestamp % 1000));
+					Output += ",\"ts\":";
+					Output += TimestampString;
+					Output += ",\"name\":\"";
+					AppendEscaped(Output, Name);
+					Output += "\"";
+
+					switch (Type)
+					{
+						case EventType::Begin:
+							Output += ",\"ph\":\"B\"}";
+							break;
+						case EventType::End:
+							Output += ",\"ph\":\"E\"}";
+							break;
+						case EventType::Counter:
+							Output += ",\"ph\":\"C\",\"args\":{\"value\":";
+							Output += std::to_string(Value);
+							Output += "}}";
+							break;
+						case EventType::Instant:
+							Output += ",\"ph\":\"i\",\"s\":\"p\"}";
+							break;
+						case EventType::ThreadName:
+							break;
+					}
+				}
+
+				std::atomic<bool> bCapturing {false};
+				std::atomic<std::uint64_t> Generation {0};
+				std::atomic<std::uint64_t> StartTime {0};
+
+				/// @brief Guards registering threads, naming them, interning names and saving
+				std::mutex Mutex;
+				std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+				std::vector<const char*> ThreadNames;
+				std::unordered_set<std::string> InternedNames;
+			};
+
+			/// @brief Starts a capture when the application is loaded if MODIO_PROFILE_OUTPUT is set, and saves it
+			/// when the application exits
+			struct EnvironmentCapture
+			{
+				std::string OutputPath;
+
+				EnvironmentCapture()
+				{
+					const char* Path = std::getenv("MODIO_PROFILE_OUTPUT");
+					if (Path != nullptr && *Path != '\0')
+					{
+						OutputPath = Path;
+						ProfilerState::Get().Start();
+					}
+				}
+
+				~EnvironmentCapture()
+				{
+					if (!OutputPath.empty())
+					{
+						ProfilerState::Get().Stop();
+						ProfilerState::Get().Save(OutputPath);
+					}
+				}
+			};
+
+			// Constructed after ProfilerState::Get() has been first called, so it is destroyed before the state is
+			static EnvironmentCapture StartupCapture;
+		} // namespace Profiler
+	} // namespace Detail
+} // namespace Modio
+
+using Modio::Detail::Profiler::EventType;
+using Modio::Detail::Profiler::ProfilerState;
+
+extern "C"
+{
+	void modio_profile_start()
+	{
+		ProfilerState::Get().Start();
+	}
+
+	void modio_profile_stop()
+	{
+		ProfilerState::Get().Stop();
+	}
+
+	void modio_profile_save(const char* Name)
+	{
+		if (Name == nullptr)
+		{
+			return;
+		}
+		// MODIO_PROFILE_SAVE stringizes its argument, so a quoted name arrives with its quotes
+		std::string Path = Name;
+		if (Path.size() >= 2 && Path.front() == '"' && Path.back() == '"')
+		{
+			Path = Path.substr(1, Path.size() - 2);
+		}
+		if (Path.size() < 5 || Path.compare(Path.size() - 5, 5, ".json") != 0)
+		{
+			Path += ".json";
+		}
+		ProfilerState::Get().Save(Path);
+	}
+
+	void modio_profile_counter_increment(const char* Name, std::uint64_t* Data)
+	{
+		if (Data != nullptr && ProfilerState::Get().IsCapturing())
+		{
+			ProfilerState::Get().RecordCounter(Name, ++*Data);
+		}
+	}
+
+	void modio_profile_counter_decrement(const char* Name, std::uint64_t* Data)
+	{
+		if (Data != nullptr && ProfilerState::Get().IsCapturing())
+		{
+			ProfilerState::Get().RecordCounter(Name, --*Data);
+		}
+	}
+
+	void modio_profile_counter_set(const char* Name, std::uint64_t Data)
+	{
+		// Counter names may be built at runtime (such as the names of operation queues), so they are copied
+		if (ProfilerState::Get().IsCapturing())
+		{
+			ProfilerState::Get().RecordCounter(Name, Data);
+		}
+	}
+
+	void modio_profile_scope_start(const char* Scope, void** Data)
+	{
+		if (Data != nullptr)
+		{
+			*Data = nullptr;
+		}
+		ProfilerState::Get().Record(Scope, 0, EventType::Begin);
+	}
+
+	void modio_profile_scope_end(const char* Scope, void* /*Data*/)
+	{
+		ProfilerState::Get().Record(Scope, 0, EventType::End);
+	}
+
+	void modio_profile_push(const char* Name)
+	{
+		ProfilerState::Get().Record(Name, 0, EventType::Begin);
+	}
+
+	void modio_profile_pop()
+	{
+		ProfilerState::Get().Record("", 0, EventType::End);
+	}
+
+	void modio_profile_thread(const char* Scope)
+	{
+		ProfilerState::Get().NameThread(Scope);
+	}
+
+	void modio_profile_frame(const char* Scope)
+	{
+		ProfilerState::Get().Record(Scope, 0, EventType::Instant);
+	}
+}
@@ -0,0 +1,204 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioRuntimeStats.h"
+#include "modio/core/ModioSplitCompilation.h"
+#include "modio/detail/ModioConstants.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief Histogram of durations in the style of an HDR histogram. Durations are counted in microseconds into
+		/// buckets that are linear within each power of two, so every bucket is at most 1/8th as wide as the values
+		/// it holds and a percentile can be read back to that precision. Recording is a handful of relaxed atomic
+		/// operations, so any thread may record into it while another reads it
+		class DurationHistogram
+		{
+		public:
+			MODIO_IMPL void Record(std::chrono::steady_clock::duration Duration);
+
+			/// @return Count, mean, percentiles and maximum of the durations recorded so far
+			MODIO_IMPL Modio::DurationStats Summarize() const;
+
+		private:
+			static constexpr std::size_t SubBucketBits = 3;
+			static constexpr std::size_t SubBucketCount = std::size_t(1) << SubBucketBits;
+			// Values of 2^(MaxExponent + 1) microseconds (about 25 days) or more are counted in the last bucket
+			static constexpr std::size_t MaxExponent = 40;
+			static constexpr std::size_t NumBuckets =
+				SubBucketCount + (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+			MODIO_IMPL static std::size_t GetBucketIndex(std::uint64_t Value);
+
+			/// @return The largest value counted in the bucket at Index
+			MODIO_IMPL static std::uint64_t GetBucketUpperBound(std::size_t Index);
+
+			std::array<std::atomic<std::uint64_t>, NumBuckets> Buckets {};
+			std::atomic<std::uint64_t> Count {0};
+			std::atomic<std::uint64_t> Total {0};
+			std::atomic<std::uint64_t> Max {0};
+		};
+
+		/// @docinternal
+		/// @brief Running total of bytes processed, along with the bytes processed in each of the last few seconds so
+		/// a recent rate can be reported. A second's count may lose bytes recorded on another thread at the moment
+		/// the second rolls over, which is fine for a rate that is only reported
+		class ThroughputMeter
+		{
+		public:
+			MODIO_IMPL void Record(std::uint64_t Bytes);
+
+			MODIO_IMPL Modio::ThroughputStats Summarize() const;
+
+		private:
+			struct Interval
+			{
+				std::atomic<std::int64_t> Second {-1};
+				std::atomic<std::uint64_t> Bytes {0};
+			};
+
+			MODIO_IMPL static std::int64_t GetCurrentSecond();
+
+			// One more interval than is averaged over, so the one in progress never overwrites one being reported
+			std::array<Interval, Constants::Configuration::RuntimeStatsThroughputWindowSeconds + 1> Intervals {};
+			std::atomic<std::uint64_t> TotalBytes {0};
+		};
+
+		/// @docinternal
+		/// @brief Statistics kept for a single OperationQueue, owned by the queue and read by
+		/// RuntimeStatsCollector::Snapshot for as long as the queue exists
+		struct OperationQueueStatsRecord
+		{
+			std::string Name {};
+			std::atomic<std::uint32_t> Depth {0};
+			std::atomic<std::uint32_t> MaxDepth {0};
+			Modio::Detail::DurationHistogram Wait {};
+
+			explicit OperationQueueStatsRecord(std::string InName) : Name(std::move(InName)) {}
+
+			void SetDepth(std::uint32_t NewDepth)
+			{
+				Depth.store(NewDepth, std::memory_order_relaxed);
+				std::uint32_t PreviousMax = MaxDepth.load(std::memory_order_relaxed);
+				while (NewDepth > PreviousMax &&
+					   !MaxDepth.compare_exchange_weak(PreviousMax, NewDepth, std::memory_order_relaxed))
+				{}
+			}
+		};
+
+		/// @docinternal
+		/// @brief Kind of HTTP request, for the latency statistics kept per kind
+		enum class HttpEndpointClass : std::uint8_t
+		{
+			Query,
+			Mutation,
+			Upload,
+			Download,
+			Count
+		};
+
+		/// @docinternal
+		/// @brief Process-wide counters the SDK updates as it works, read by Modio::QueryRuntimeStats. The counters are
+		/// atomics updated with relaxed ordering so they can be updated from the worker and compute threads as well
+		/// as the game's thread, and are not reset when the SDK shuts down
+		class RuntimeStatsCollector
+		{
+		public:
+			MODIO_IMPL static RuntimeStatsCollector& Get();
+
+			/// @brief Creates the statistics for a new OperationQueue. The collector only holds a weak reference, so
+			/// the queue's statistics stop being reported when it is destroyed
+			MODIO_IMPL std::shared_ptr<Modio::Detail::OperationQueueStatsRecord> RegisterQueue(std::string Name);
+
+			MODIO_IMPL void RecordHttpLatency(Modio::Detail::HttpEndpointClass Class,
+											  std::chrono::steady_clock::duration Latency);
+
+			MODIO_IMPL void RecordRunPendingHandlers(std::chrono::steady_clock::duration Duration);
+
+			void RecordResponseCacheLookup(bool bHit)
+			{
+				(bHit ? ResponseCacheHits : ResponseCacheMisses).fetch_add(1, std::memory_order_relaxed);
+			}
+
+			void RecordModCacheLookup(bool bHit)
+			{
+				(bHit ? ModCacheHits : ModCacheMisses).fetch_add(1, std::memory_order_relaxed);
+			}
+
+			void RecordFileRead(std::uint64_t Bytes)
+			{
+				FileBytesRead.fetch_add(Bytes, std::memory_order_relaxed);
+			}
+
+			void RecordFileWrite(std::uint64_t Bytes)
+			{
+				FileBytesWritten.fetch_add(Bytes, std::memory_order_relaxed);
+			}
+
+			void RecordPoolAllocation(bool bReused)
+			{
+				(bReused ? PoolBlocksReused : PoolBlocksAllocated).fetch_add(1, std::memory_order_relaxed);
+			}
+
+			void RecordDownload(std::uint64_t Bytes)
+			{
+				Download.Record(Bytes);
+			}
+
+			void RecordExtract(std::uint64_t Bytes)
+			{
+				Extract.Record(Bytes);
+			}
+
+			/// @brief Populates a RuntimeStats from the current value of every counter
+			/// @param DroppedLogMessages Count of dropped log messages, which is kept by the LogService
+			MODIO_IMPL Modio::RuntimeStats Snapshot(std::uint64_t DroppedLogMessages);
+
+		private:
+			RuntimeStatsCollector() = default;
+
+			Modio::Detail::ThroughputMeter Download {};
+			Modio::Detail::ThroughputMeter Extract {};
+			std::atomic<std::uint64_t> ResponseCacheHits {0};
+			std::atomic<std::uint64_t> ResponseCacheMisses {0};
+			std::atomic<std::uint64_t> ModCacheHits {0};
+			std::atomic<std::uint64_t> ModCacheMisses {0};
+			std::atomic<std::uint64_t> FileBytesRead {0};
+			std::atomic<std::uint64_t> FileBytesWritten {0};
+			std::atomic<std::uint64_t> PoolBlocksAllocated {0};
+			std::atomic<std::uint64_t> PoolBlocksReused {0};
+
+			std::array<Modio::Detail::DurationHistogram, std::size_t(Modio::Detail::HttpEndpointClass::Count)>
+				HttpLatency {};
+			Modio::Detail::DurationHistogram RunPendingHandlersTime {};
+
+			std::mutex QueuesMutex {};
+			std::vector<std::weak_ptr<Modio::Detail::OperationQueueStatsRecord>> Queues {};
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioRuntimeStats.ipp"
+#endif
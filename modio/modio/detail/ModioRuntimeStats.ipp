@@ -0,0 +1,233 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioRuntimeStats.h"
+#endif
+
+#include <algorithm>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		void DurationHistogram::Record(std::chrono::steady_clock::duration Duration)
+		{
+			std::int64_t Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(Duration).count();
+			std::uint64_t Value = Microseconds > 0 ? std::uint64_t(Microseconds) : 0;
+
+			Buckets[GetBucketIndex(Value)].fetch_add(1, std::memory_order_relaxed);
+			Count.fetch_add(1, std::memory_order_relaxed);
+			Total.fetch_add(Value, std::memory_order_relaxed);
+			std::uint64_t PreviousMax = Max.load(std::memory_order_relaxed);
+			while (Value > PreviousMax && !Max.compare_exchange_weak(PreviousMax, Value, std::memory_order_relaxed))
+			{}
+		}
+
+		Modio::DurationStats DurationHistogram::Summarize() const
+		{
+			Modio::DurationStats Stats;
+
+			// Copied first so the percentiles are taken from one set of counts even if more are recorded meanwhile
+			std::array<std::uint64_t, NumBuckets> Counts {};
+			std::uint64_t NumRecorded = 0;
+			for (std::size_t Index = 0; Index < NumBuckets; ++Index)
+			{
+				Counts[Index] = Buckets[Index].load(std::memory_order_relaxed);
+				NumRecorded += Counts[Index];
+			}
+			if (NumRecorded == 0)
+			{
+				return Stats;
+			}
+
+			std::uint64_t MaxValue = Max.load(std::memory_order_relaxed);
+			auto GetPercentile = [&Counts, NumRecorded, MaxValue](std::uint64_t Percent) {
+				// Rank of the value at the percentile, counting from 1
+				std::uint64_t Rank = std::max<std::uint64_t>((NumRecorded * Percent + 99) / 100, 1);
+				std::uint64_t Seen = 0;
+				for (std::size_t Index = 0; Index < NumBuckets; ++Index)
+				{
+					Seen += Counts[Index];
+					if (Seen >= Rank)
+					{
+						return std::chrono::microseconds(std::min(GetBucketUpperBound(Index), MaxValue));
+					}
+				}
+				return std::chrono::microseconds(MaxValue);
+			};
+
+			Stats.Count = NumRecorded;
+			Stats.Mean = std::chrono::microseconds(Total.load(std::memory_order_relaxed) /
+												   std::max<std::uint64_t>(Count.load(std::memory_order_relaxed), 1));
+			Stats.P50 = GetPercentile(50);
+			Stats.P95 = GetPercentile(95);
+			Stats.P99 = GetPercentile(99);
+			Stats.Max = std::chrono::microseconds(MaxValue);
+			return Stats;
+		}
+
+		std::size_t DurationHistogram::GetBucketIndex(std::uint64_t Value)
+		{
+			if (Value < SubBucketCount)
+			{
+				return std::size_t(Value);
+			}
+
+			std::size_t Exponent = 0;
+			for (std::uint64_t Remaining = Value >> 1; Remaining != 0; Remaining >>= 1)
+			{
+				++Exponent;
+			}
+			if (Exponent > MaxExponent)
+			{
+				return NumBuckets - 1;
+			}
+
+			// The bits after the leading one select the linear sub-bucket within this power of two
+			std::size_t SubBucket = std::size_t(Value >> (Exponent - SubBucketBits)) & (SubBucketCount - 1);
+			return SubBucketCount + (Exponent - SubBucketBits) * SubBucketCount + SubBucket;
+		}
+
+		std::uint64_t DurationHistogram::GetBucketUpperBound(std::size_t Index)
+		{
+			if (Index < SubBucketCount)
+			{
+				return std::uint64_t(Index);
+			}
+
+			std::size_t Shift = (Index - SubBucketCount) / SubBucketCount;
+			std::uint64_t SubBucket = (Index - SubBucketCount) % SubBucketCount;
+			return ((SubBucketCount + SubBucket + 1) << Shift) - 1;
+		}
+
+		void ThroughputMeter::Record(std::uint64_t Bytes)
+		{
+			TotalBytes.fetch_add(Bytes, std::memory_order_relaxed);
+
+			std::int64_t CurrentSecond = GetCurrentSecond();
+			Interval& Current = Intervals[std::size_t(CurrentSecond) % Intervals.size()];
+			std::int64_t IntervalSecond = Current.Second.load(std::memory_order_relaxed);
+			if (IntervalSecond != CurrentSecond &&
+				Current.Second.compare_exchange_strong(IntervalSecond, CurrentSecond, std::memory_order_relaxed))
+			{
+				// This interval last counted a second that has fallen out of the window
+				Current.Bytes.store(Bytes, std::memory_order_relaxed);
+				return;
+			}
+			Current.Bytes.fetch_add(Bytes, std::memory_order_relaxed);
+		}
+
+		Modio::ThroughputStats ThroughputMeter::Summarize() const
+		{
+			constexpr std::int64_t WindowSeconds =
+				std::int64_t(Constants::Configuration::RuntimeStatsThroughputWindowSeconds);
+
+			Modio::ThroughputStats Stats;
+			Stats.TotalBytes = TotalBytes.load(std::memory_order_relaxed);
+
+			std::int64_t CurrentSecond = GetCurrentSecond();
+			std::uint64_t WindowBytes = 0;
+			for (const Interval& Entry : Intervals)
+			{
+				std::int64_t IntervalSecond = Entry.Second.load(std::memory_order_relaxed);
+				if (IntervalSecond < CurrentSecond && IntervalSecond >= CurrentSecond - WindowSeconds)
+				{
+					WindowBytes += Entry.Bytes.load(std::memory_order_relaxed);
+				}
+			}
+			Stats.RecentBytesPerSecond = double(WindowBytes) / double(WindowSeconds);
+			return Stats;
+		}
+
+		std::int64_t ThroughputMeter::GetCurrentSecond()
+		{
+			return std::chrono::duration_cast<std::chrono::seconds>(
+					   std::chrono::steady_clock::now().time_since_epoch())
+				.count();
+		}
+
+		RuntimeStatsCollector& RuntimeStatsCollector::Get()
+		{
+			static RuntimeStatsCollector Instance;
+			return Instance;
+		}
+
+		std::shared_ptr<Modio::Detail::OperationQueueStatsRecord> RuntimeStatsCollector::RegisterQueue(
+			std::string Name)
+		{
+			std::shared_ptr<Modio::Detail::OperationQueueStatsRecord> Record =
+				std::make_shared<Modio::Detail::OperationQueueStatsRecord>(std::move(Name));
+
+			std::lock_guard<std::mutex> Lock(QueuesMutex);
+			// Queues that have been destroyed are removed here rather than when they are destroyed, so the queues do
+			// not need to unregister
+			Queues.erase(std::remove_if(Queues.begin(), Queues.end(),
+										[](const std::weak_ptr<Modio::Detail::OperationQueueStatsRecord>& Queue) {
+											return Queue.expired();
+										}),
+						 Queues.end());
+			Queues.push_back(Record);
+			return Record;
+		}
+
+		void RuntimeStatsCollector::RecordHttpLatency(Modio::Detail::HttpEndpointClass Class,
+													  std::chrono::steady_clock::duration Latency)
+		{
+			HttpLatency[std::size_t(Class)].Record(Latency);
+		}
+
+		void RuntimeStatsCollector::RecordRunPendingHandlers(std::chrono::steady_clock::duration Duration)
+		{
+			RunPendingHandlersTime.Record(Duration);
+		}
+
+		Modio::RuntimeStats RuntimeStatsCollector::Snapshot(std::uint64_t DroppedLogMessages)
+		{
+			Modio::RuntimeStats Stats;
+
+			{
+				std::lock_guard<std::mutex> Lock(QueuesMutex);
+				for (const std::weak_ptr<Modio::Detail::OperationQueueStatsRecord>& WeakQueue : Queues)
+				{
+					if (std::shared_ptr<Modio::Detail::OperationQueueStatsRecord> Queue = WeakQueue.lock())
+					{
+						Modio::OperationQueueStats QueueStats;
+						QueueStats.Name = Queue->Name;
+						QueueStats.Depth = Queue->Depth.load(std::memory_order_relaxed);
+						QueueStats.MaxDepth = Queue->MaxDepth.load(std::memory_order_relaxed);
+						QueueStats.Wait = Queue->Wait.Summarize();
+						Stats.Queues.push_back(std::move(QueueStats));
+					}
+				}
+			}
+
+			Stats.HttpQueryLatency = HttpLatency[std::size_t(Modio::Detail::HttpEndpointClass::Query)].Summarize();
+			Stats.HttpMutationLatency =
+				HttpLatency[std::size_t(Modio::Detail::HttpEndpointClass::Mutation)].Summarize();
+			Stats.HttpUploadLatency = HttpLatency[std::size_t(Modio::Detail::HttpEndpointClass::Upload)].Summarize();
+			Stats.HttpDownloadLatency =
+				HttpLatency[std::size_t(Modio::Detail::HttpEndpointClass::Download)].Summarize();
+			Stats.Download = Download.Summarize();
+			Stats.Extract = Extract.Summarize();
+			Stats.ResponseCacheHits = ResponseCacheHits.load(std::memory_order_relaxed);
+			Stats.ResponseCacheMisses = ResponseCacheMisses.load(std::memory_order_relaxed);
+			Stats.ModCacheHits = ModCacheHits.load(std::memory_order_relaxed);
+			Stats.ModCacheMisses = ModCacheMisses.load(std::memory_order_relaxed);
+			Stats.FileBytesRead = FileBytesRead.load(std::memory_order_relaxed);
+			Stats.FileBytesWritten = FileBytesWritten.load(std::memory_order_relaxed);
+			Stats.PoolBlocksAllocated = PoolBlocksAllocated.load(std::memory_order_relaxed);
+			Stats.PoolBlocksReused = PoolBlocksReused.load(std::memory_order_relaxed);
+			Stats.RunPendingHandlersTime = RunPendingHandlersTime.Summarize();
+			Stats.DroppedLogMessages = DroppedLogMessages;
+			return Stats;
+		}
+	} // namespace Detail
+} // namespace Modio
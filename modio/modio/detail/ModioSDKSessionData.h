@@ -17,7 +17,11 @@
 #include "modio/detail/ConcurrentQueueWrapper.h"
 #include "modio/detail/FilesystemWrapper.h"
 #include "modio/detail/Function2Wrapper.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/ModioModCollectionJournal.h"
+#include "modio/detail/ModioPendingModIndex.h"
 #include "modio/detail/userdata/ModioUserDataContainer.h"
+#include <limits>
 #include <map>
 #include <queue>
 #include <shared_mutex>
@@ -56,10 +60,35 @@ namespace Modio
 			MODIO_IMPL static void MarkAsRateLimited(int SecondsDelay);
 			MODIO_IMPL static bool IsRateLimited();
 			MODIOSDK_API static Modio::ModCollection& GetSystemModCollection();
+			/// @brief Tracks which entries of the system mod collection have changed since they were last saved. Only
+			/// accessed by the operations that load and save the collection
+			MODIO_IMPL static Modio::Detail::ModCollectionJournal& GetModCollectionJournal();
 			MODIO_IMPL static Modio::ModCollection& GetTempModCollection();
 			MODIO_IMPL static std::shared_ptr<Modio::Detail::TemporaryModSet> GetTemporaryModSet();
 
 			MODIOSDK_API static Modio::ModCollection FilterSystemModCollectionByUserSubscriptions();
+
+			/// @brief Entry of the system mod collection that mod management should uninstall next, found without
+			/// copying the collection
+			/// @return The entry, or null if nothing is pending uninstallation
+			MODIO_IMPL static std::shared_ptr<Modio::ModCollectionEntry> GetNextPendingUninstall();
+
+			/// @brief Entry of the user's subscriptions that mod management should install or update next, found
+			/// without copying the collection
+			/// @return The entry, or null if nothing is pending installation or update
+			MODIO_IMPL static std::shared_ptr<Modio::ModCollectionEntry> GetNextPendingInstallOrUpdate();
+
+			/// @return The entry for the mod if the user is subscribed to it and it is pending installation or update
+			MODIO_IMPL static std::shared_ptr<Modio::ModCollectionEntry> FindPendingInstallOrUpdate(
+				Modio::ModID ModId);
+
+			/// @brief Total size on disk of the installed entries of the system mod collection. Only summed again once
+			/// an entry has been added, removed or changed since the last call
+			MODIO_IMPL static Modio::FileSize GetInstalledModsSizeOnDisk();
+
+			/// @brief Changes whenever the system or temporary mod collections, their entries or the user's
+			/// subscriptions may have changed, so callers can tell that what they last queried is still current
+			MODIO_IMPL static std::uint64_t GetModCollectionQueryRevision();
 			MODIO_IMPL static void InitializeForUser(Modio::User User, Modio::OAuthToken AuthToken);
 			MODIO_IMPL static void UpdateTokenForExistingUser(Modio::OAuthToken AuthToken);
 			MODIO_IMPL static const Modio::Optional<Modio::OAuthToken> GetAuthenticationToken();
@@ -68,8 +97,13 @@ namespace Modio
 
 			MODIO_IMPL static std::map<Modio::ModID, Modio::ModInfo>& GetModPurchases();
 
+			/// @brief Encodes the user data as a binary snapshot
 			MODIO_IMPL static Modio::Detail::Buffer SerializeUserData();
 
+			/// @brief Encodes the user data as JSON, which is kept alongside the binary snapshot in case it is damaged
+			MODIO_IMPL static Modio::Detail::Buffer ExportUserData();
+
+			/// @brief Loads user data from a binary snapshot, or from the JSON written by earlier versions of the SDK
 			MODIO_IMPL static bool DeserializeUserDataFromBuffer(Modio::Detail::Buffer UserDataBuffer);
 
 			MODIO_IMPL static void ClearUserData();
@@ -123,6 +157,10 @@ namespace Modio
 
 			MODIO_IMPL static bool CloseTempModSet();
 
+			/// @brief Called with the write lock held whenever the mods in the temp mod set change, so that
+			/// GetModCollectionQueryRevision changes too
+			MODIO_IMPL static void MarkTempModSetModified();
+
 			/// @brief Initializes a ModProgressInfo for the specified mod, storing it in the global state. This method
 			/// is only intended for use by InstallOrUpdateModOp
 			/// @param ID Mod ID for the mod to begin reporting progress on
@@ -165,6 +203,11 @@ namespace Modio
 			MODIO_IMPL static Modio::FileSize GetTotalImageCacheSize();
 			MODIO_IMPL static Modio::ErrorCode AddToImageCacheData(Modio::filesystem::path NewImagePath);
 
+			MODIO_IMPL static void SetMultipartUploadConcurrency(std::uint32_t Concurrency);
+			MODIO_IMPL static std::uint32_t GetMultipartUploadConcurrency();
+			MODIO_IMPL static void SetPipelinedModfileUpload(bool bEnabled);
+			MODIO_IMPL static bool IsPipelinedModfileUploadEnabled();
+
 			MODIO_IMPL static void SetLocalLanguage(Modio::Language Local);
 			MODIO_IMPL static Modio::Language GetLocalLanguage();
 
@@ -196,6 +239,16 @@ namespace Modio
 			MODIO_IMPL static bool IsFetchExternalUpdatesRunning();
 			MODIO_IMPL static void SetFetchExternalUpdatesRunning(bool IsRunning);
 
+			/// @brief Starts a new generation of mod list prefetching, which stops the prefetching of earlier
+			/// generations before their next page
+			/// @param QueryKey FilterParams::ToQueryKey of the query being prefetched
+			/// @return The generation the new prefetch belongs to
+			MODIO_IMPL static std::uint64_t BeginModListPrefetch(std::map<std::string, std::string> QueryKey);
+			/// @brief Stops the current mod list prefetch before its next page if it is for a different query, so a
+			/// request for another page of the same query leaves it running
+			MODIO_IMPL static void SupersedeModListPrefetch(const std::map<std::string, std::string>& QueryKey);
+			MODIO_IMPL static bool IsModListPrefetchCurrent(std::uint64_t Generation);
+
 			MODIO_IMPL static void EnqueueTask(fu2::unique_function<void()> Task);
 			MODIO_IMPL static void PushQueuedTasksToGlobalContext();
 
@@ -225,6 +278,9 @@ namespace Modio
 			// This may not need to be public, can probably just expose static accessors that call it
 			MODIO_IMPL static SDKSessionData& Get();
 
+			/// @brief Brings ModCollectionQueryCache up to date. Called with the cache mutex held
+			MODIO_IMPL static void RefreshModCollectionQueryCache();
+
 			Modio::GameID GameID {};
 			Modio::ApiKey APIKey {};
 			Modio::Environment Environment = Modio::Environment::Live;
@@ -234,6 +290,9 @@ namespace Modio
 			Modio::Optional<Modio::PlatformStatus> PlatformStatusFilter {};
 			Modio::Optional<Modio::FileSize> ModStorageQuota {};
 			Modio::Optional<Modio::FileSize> CacheStorageQuota {};
+			std::uint32_t MultipartUploadConcurrency =
+				Modio::Detail::Constants::Configuration::DefaultMultipartUploadConcurrency;
+			bool bPipelinedModfileUpload = false;
 			Modio::Portal PortalInUse = Modio::Portal::None;
 			Modio::Language LocalLanguage = Modio::Language::English;
 			InitializationState CurrentInitializationState = InitializationState::NotInitialized;
@@ -245,9 +304,26 @@ namespace Modio
 			std::shared_ptr<Modio::ModProgressInfo> CurrentModInProgress {};
 			std::function<void(Modio::ModManagementEvent)> ModManagementEventCallback {};
 			Modio::ModCollection SystemModCollection {};
+			Modio::Detail::ModCollectionJournal SystemModCollectionJournal {};
+			Modio::Detail::PendingModIndex SystemModCollectionPendingIndex {};
+			/// @brief What GetInstalledModsSizeOnDisk and GetModCollectionQueryRevision return, and the revisions
+			/// they were worked out for
+			struct ModCollectionQueryCacheData
+			{
+				std::uint64_t SystemCollectionRevision = std::numeric_limits<std::uint64_t>::max();
+				std::uint64_t TempCollectionRevision = std::numeric_limits<std::uint64_t>::max();
+				std::uint64_t TempModSetRevision = std::numeric_limits<std::uint64_t>::max();
+				std::uint64_t SubscriptionsRevision = std::numeric_limits<std::uint64_t>::max();
+				std::uint64_t EntriesRevision = std::numeric_limits<std::uint64_t>::max();
+				Modio::FileSize InstalledModsSize = Modio::FileSize(0);
+				std::uint64_t QueryRevision = 0;
+			};
+			ModCollectionQueryCacheData ModCollectionQueryCache {};
 			Modio::ModCollection TempModCollection {};
 			// Could be a vector if we need multiple TempModSet
 			std::shared_ptr<Modio::Detail::TemporaryModSet> TempModSet {};
+			/// @brief Changes whenever the temp mod set is opened, closed, or has mods added or removed
+			std::uint64_t TempModSetRevision = 0;
 			Modio::Detail::UserDataContainer UserData {};
 			// We may need to make this a shared pointer and give a reference to operations so if we shut down they
 			// write into the stale log instead
@@ -270,6 +346,8 @@ namespace Modio
 			Modio::FileSize TotalImageCacheSize {};
 			bool FetchExternalUpdatesRunning = false;
 			std::unordered_map<std::int64_t, bool> CollectionCacheInvalidMap;
+			std::uint64_t ModListPrefetchGeneration = 0;
+			std::map<std::string, std::string> ModListPrefetchQuery {};
 		};
 	} // namespace Detail
 } // namespace Modio
@@ -19,10 +19,14 @@
 #include "modio/core/ModioInitializeOptions.h"
 #include "modio/core/ModioLogger.h"
 #include "modio/core/ModioTemporaryModSet.h"
+#include "modio/detail/ModioBinarySnapshot.h"
 #include "modio/detail/ModioJsonHelpers.h"
 #include "modio/detail/ModioProfiling.h"
+#include "modio/detail/ModioWorkerThread.h"
 #include "modio/detail/serialization/ModioUserDataContainerSerialization.h"
 #include "modio/file/ModioFileService.h"
+#include <algorithm>
+#include <mutex>
 
 MODIO_DIAGNOSTIC_PUSH
 MODIO_ALLOW_DEPRECATED_SYMBOLS
@@ -147,6 +151,11 @@ namespace Modio
 			return Get().SystemModCollection;
 		}
 
+		Modio::Detail::ModCollectionJournal& SDKSessionData::GetModCollectionJournal()
+		{
+			return Get().SystemModCollectionJournal;
+		}
+
 		Modio::ModCollection& SDKSessionData::GetTempModCollection()
 		{
 			return Get().TempModCollection;
@@ -163,6 +172,85 @@ namespace Modio
 			return Get().SystemModCollection.FilterByUserSubscriptions(Get().UserData.UserSubscriptions);
 		}
 
+		std::shared_ptr<Modio::ModCollectionEntry> SDKSessionData::GetNextPendingUninstall()
+		{
+			return Get().SystemModCollectionPendingIndex.GetNextPendingUninstall(Get().SystemModCollection,
+																				   Get().UserData.UserSubscriptions);
+		}
+
+		std::shared_ptr<Modio::ModCollectionEntry> SDKSessionData::GetNextPendingInstallOrUpdate()
+		{
+			return Get().SystemModCollectionPendingIndex.GetNextPendingInstallOrUpdate(
+				Get().SystemModCollection, Get().UserData.UserSubscriptions);
+		}
+
+		std::shared_ptr<Modio::ModCollectionEntry> SDKSessionData::FindPendingInstallOrUpdate(Modio::ModID ModId)
+		{
+			return Get().SystemModCollectionPendingIndex.FindPendingInstallOrUpdate(
+				Get().SystemModCollection, Get().UserData.UserSubscriptions, ModId);
+		}
+
+		/// @brief Guards ModCollectionQueryCache, which is updated by queries holding only the read lock
+		inline std::mutex& GetModCollectionQueryCacheMutex()
+		{
+			static std::mutex QueryCacheMutex;
+			return QueryCacheMutex;
+		}
+
+		void SDKSessionData::RefreshModCollectionQueryCache()
+		{
+			auto& Cache = Get().ModCollectionQueryCache;
+			const Modio::ModCollection& SystemCollection = Get().SystemModCollection;
+
+			// Read before the entries are, so a change made while summing is picked up by the next call
+			std::uint64_t LatestEntryRevision = Modio::ModCollectionEntry::GetLatestRevision();
+			bool bSystemCollectionChanged = Cache.SystemCollectionRevision != SystemCollection.GetRevision() ||
+											Cache.EntriesRevision != LatestEntryRevision;
+			bool bOtherDataChanged =
+				Cache.TempCollectionRevision != Get().TempModCollection.GetRevision() ||
+				Cache.TempModSetRevision != Get().TempModSetRevision ||
+				Cache.SubscriptionsRevision != Get().UserData.UserSubscriptions.GetRevision();
+			if (!bSystemCollectionChanged && !bOtherDataChanged)
+			{
+				return;
+			}
+
+			if (bSystemCollectionChanged)
+			{
+				MODIO_PROFILE_SCOPE(SumInstalledModsSize);
+				Modio::FileSize InstalledModsSize = Modio::FileSize(0);
+				for (const auto& ModEntry : SystemCollection.Entries())
+				{
+					if (Modio::Optional<Modio::FileSize> SizeOnDisk = ModEntry.second->GetSizeOnDisk())
+					{
+						InstalledModsSize += SizeOnDisk.value();
+					}
+				}
+				Cache.InstalledModsSize = InstalledModsSize;
+			}
+
+			Cache.SystemCollectionRevision = SystemCollection.GetRevision();
+			Cache.TempCollectionRevision = Get().TempModCollection.GetRevision();
+			Cache.TempModSetRevision = Get().TempModSetRevision;
+			Cache.SubscriptionsRevision = Get().UserData.UserSubscriptions.GetRevision();
+			Cache.EntriesRevision = LatestEntryRevision;
+			Cache.QueryRevision++;
+		}
+
+		Modio::FileSize SDKSessionData::GetInstalledModsSizeOnDisk()
+		{
+			std::lock_guard<std::mutex> CacheLock(GetModCollectionQueryCacheMutex());
+			RefreshModCollectionQueryCache();
+			return Get().ModCollectionQueryCache.InstalledModsSize;
+		}
+
+		std::uint64_t SDKSessionData::GetModCollectionQueryRevision()
+		{
+			std::lock_guard<std::mutex> CacheLock(GetModCollectionQueryCacheMutex());
+			RefreshModCollectionQueryCache();
+			return Get().ModCollectionQueryCache.QueryRevision;
+		}
+
 		void SDKSessionData::InitializeForUser(Modio::User AuthenticatedUser, Modio::OAuthToken AuthToken)
 		{
 			auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
@@ -195,17 +283,33 @@ namespace Modio
 			MODIO_PROFILE_SCOPE(SerializeUserData);
 			nlohmann::json Data(Get().UserData);
 			Data["version"] = 1;
-			std::string UserData = Data.dump();
-			Modio::Detail::Buffer DataBuffer(UserData.size());
-			std::copy(UserData.begin(), UserData.end(), reinterpret_cast<char*>(DataBuffer.begin()));
-			return DataBuffer;
+			return Modio::Detail::EncodeJsonSnapshot(Modio::Detail::BinarySnapshotType::UserData, Data);
+		}
+
+		Modio::Detail::Buffer SDKSessionData::ExportUserData()
+		{
+			MODIO_PROFILE_SCOPE(ExportUserData);
+			nlohmann::json Data(Get().UserData);
+			Data["version"] = 1;
+			std::string UserDataString = Data.dump();
+			Modio::Detail::Buffer UserDataBuffer(UserDataString.size());
+			std::copy(UserDataString.begin(), UserDataString.end(), UserDataBuffer.begin());
+			return UserDataBuffer;
 		}
 
 		bool SDKSessionData::DeserializeUserDataFromBuffer(Modio::Detail::Buffer UserDataBuffer)
 		{
 			auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
 			MODIO_PROFILE_SCOPE(DeserializeUserData);
-			nlohmann::json UserDataJson = Modio::Detail::ToJson(std::move(UserDataBuffer));
+			// User data saved by earlier versions of the SDK is plain JSON
+			nlohmann::json UserDataJson =
+				Modio::Detail::IsBinarySnapshot(UserDataBuffer)
+					? Modio::Detail::DecodeJsonSnapshot(Modio::Detail::BinarySnapshotType::UserData, UserDataBuffer)
+					: Modio::Detail::ToJson(std::move(UserDataBuffer));
+			if (UserDataJson.is_discarded())
+			{
+				return false;
+			}
 			from_json(UserDataJson, Get().UserData);
 			return Get().UserData.IsValid();
 		}
@@ -426,19 +530,13 @@ namespace Modio
 		bool SDKSessionData::PrioritizeModfileDownload(Modio::ModID IdToPrioritize)
 		{
 			// needs to check if the mod exists in the collection and if it requires an update or installation
-			if (Modio::Optional<Modio::ModCollectionEntry&> CollectionEntry =
-					FilterSystemModCollectionByUserSubscriptions().GetByModID(IdToPrioritize))
+			if (FindPendingInstallOrUpdate(IdToPrioritize))
 			{
-				Modio::ModState CurrentState = (*CollectionEntry).GetModState();
-				if (CurrentState == Modio::ModState::InstallationPending ||
-					CurrentState == Modio::ModState::UpdatePending)
-				{
-					Modio::Detail::Logger().Log(LogLevel::Info, LogCategory::ModManagement,
-												"Prioritizing mod {}, currently pending install or update",
-												IdToPrioritize);
-					Get().ModIDToPrioritize = IdToPrioritize;
-					return true;
-				}
+				Modio::Detail::Logger().Log(LogLevel::Info, LogCategory::ModManagement,
+											"Prioritizing mod {}, currently pending install or update",
+											IdToPrioritize);
+				Get().ModIDToPrioritize = IdToPrioritize;
+				return true;
 			}
 			return false;
 		}
@@ -449,6 +547,7 @@ namespace Modio
 			if (Get().TempModSet == nullptr)
 			{
 				Get().TempModSet = std::make_shared<Modio::Detail::TemporaryModSet>(ModIds);
+				MarkTempModSetModified();
 				return Get().TempModSet;
 			}
 			else
@@ -463,11 +562,17 @@ namespace Modio
 			if (Get().TempModSet != nullptr)
 			{
 				Get().TempModSet.reset();
+				MarkTempModSetModified();
 				return true;
 			}
 			return false;
 		}
 
+		void SDKSessionData::MarkTempModSetModified()
+		{
+			Get().TempModSetRevision++;
+		}
+
 		std::weak_ptr<Modio::ModProgressInfo> SDKSessionData::StartModDownloadOrUpdate(Modio::ModID ID)
 		{
 			auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
@@ -701,9 +806,8 @@ namespace Modio
 				{
 					break;
 				}
-				Modio::Detail::Logger().Log(LogLevel::Trace, LogCategory::File,
-											"Deleted image {} from the cache to free {} bytes of space",
-											ImagePath.string(), ImageSize);
+				MODIO_LOG(LogLevel::Trace, LogCategory::File,
+							"Deleted image {} from the cache to free {} bytes of space", ImagePath.string(), ImageSize);
 				Get().TotalImageCacheSize -= ImageSize;
 				Get().CacheImagePaths.pop();
 			}
@@ -713,8 +817,8 @@ namespace Modio
 											"Error reducing image cache size below specified cache storage quota");
 				return Modio::ErrorCode(Modio::make_error_code(Modio::FilesystemError::ReadError));
 			}
-			Modio::Detail::Logger().Log(LogLevel::Detailed, LogCategory::File,
-										"Image cache total size reduced to {} bytes", Get().TotalImageCacheSize);
+			MODIO_LOG(LogLevel::Detailed, LogCategory::File, "Image cache total size reduced to {} bytes",
+						Get().TotalImageCacheSize);
 			return {};
 		}
 
@@ -740,6 +844,28 @@ namespace Modio
 			return Get().TotalImageCacheSize;
 		}
 
+		void SDKSessionData::SetMultipartUploadConcurrency(std::uint32_t Concurrency)
+		{
+			Get().MultipartUploadConcurrency = Concurrency;
+			Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::Http,
+										"Multipart upload concurrency set to {} parts", Concurrency);
+		}
+
+		std::uint32_t SDKSessionData::GetMultipartUploadConcurrency()
+		{
+			return Get().MultipartUploadConcurrency;
+		}
+
+		void SDKSessionData::SetPipelinedModfileUpload(bool bEnabled)
+		{
+			Get().bPipelinedModfileUpload = bEnabled;
+		}
+
+		bool SDKSessionData::IsPipelinedModfileUploadEnabled()
+		{
+			return Get().bPipelinedModfileUpload;
+		}
+
 		void SDKSessionData::SetLocalLanguage(Modio::Language Local)
 		{
 			Get().LocalLanguage = Local;
@@ -905,9 +1031,30 @@ namespace Modio
 			Get().FetchExternalUpdatesRunning = IsRunning;
 		}
 
+		std::uint64_t SDKSessionData::BeginModListPrefetch(std::map<std::string, std::string> QueryKey)
+		{
+			Get().ModListPrefetchQuery = std::move(QueryKey);
+			return ++Get().ModListPrefetchGeneration;
+		}
+
+		void SDKSessionData::SupersedeModListPrefetch(const std::map<std::string, std::string>& QueryKey)
+		{
+			if (Get().ModListPrefetchQuery != QueryKey)
+			{
+				Get().ModListPrefetchQuery.clear();
+				++Get().ModListPrefetchGeneration;
+			}
+		}
+
+		bool SDKSessionData::IsModListPrefetchCurrent(std::uint64_t Generation)
+		{
+			return Get().ModListPrefetchGeneration == Generation;
+		}
+
 		void SDKSessionData::EnqueueTask(fu2::unique_function<void()> Task)
 		{
 			Get().IncomingTaskQueue.enqueue(std::move(Task));
+			Modio::Detail::WorkerThread::NotifyTaskQueued();
 		}
 
 		void SDKSessionData::PushQueuedTasksToGlobalContext()
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioStdTypes.h"
+#include "modio/detail/ConcurrentQueueWrapper.h"
+#include "modio/detail/Function2Wrapper.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @docinternal
+		/// @brief What the SDK's worker thread does once it has run every handler that was ready
+		enum class WorkerIdleStrategy : std::uint8_t
+		{
+			/// @brief Block until a handler is ready or a task is queued, waking at least once per idle interval
+			Park,
+			/// @brief Give up the rest of the thread's time slice before checking again
+			Yield,
+			/// @brief Check again straight away. Lowest latency, but keeps a core busy
+			Spin
+		};
+
+		/// @docinternal
+		/// @brief Thread the SDK runs its own handlers on when it is initialized with the WorkerThread extended
+		/// parameter, in place of the game calling Modio::RunPendingHandlers.
+		///
+		/// Callbacks the SDK would invoke on the worker are queued instead (see Modio::Detail::MarshalCallback) and run
+		/// by Modio::DispatchCallbacks on the game's thread, so the game never has to synchronize with the worker. Start,
+		/// DispatchCallbacks and SetShutdownPending are only called from the game's thread.
+		class WorkerThread
+		{
+		public:
+			/// @brief Starts the worker if it is not already running
+			/// @return true if this call started the worker
+			MODIO_IMPL static bool Start(Modio::Detail::WorkerIdleStrategy Strategy,
+										 std::chrono::microseconds IdleInterval);
+
+			/// @brief Stops the worker once it has finished running the current handler. It is joined by the next call
+			/// to DispatchCallbacks, before the callbacks it queued are run
+			MODIO_IMPL static void RequestStop();
+
+			/// @return true if the worker has been started and not yet joined
+			MODIO_IMPL static bool IsRunning();
+
+			/// @return true if called from the worker
+			MODIO_IMPL static bool IsCurrentThread();
+
+			/// @brief Wakes the worker if it is parked, so a newly queued task starts without waiting for the idle
+			/// interval
+			MODIO_IMPL static void NotifyTaskQueued();
+
+			/// @brief While set, the worker stops trying to take the shutdown lock so the game's thread is not starved
+			/// of it while Modio::ShutdownAsync waits for it
+			MODIO_IMPL static void SetShutdownPending(bool bPending);
+
+			/// @brief Queues a callback to be run by the next call to DispatchCallbacks
+			MODIO_IMPL static void EnqueueCallback(fu2::unique_function<void()> Callback);
+
+			/// @brief Runs the callbacks the worker has queued, on the calling thread
+			MODIO_IMPL static void DispatchCallbacks();
+
+			/// @brief Parses a WorkerIdleStrategy from the value of the WorkerIdleStrategy extended parameter
+			MODIO_IMPL static Modio::Optional<Modio::Detail::WorkerIdleStrategy> ParseIdleStrategy(
+				const std::string& Value);
+
+			MODIO_IMPL ~WorkerThread();
+
+		private:
+			WorkerThread() = default;
+
+			MODIO_IMPL static WorkerThread& Get();
+
+			/// @brief Set on the worker for as long as it runs
+			MODIO_IMPL static bool& IsWorkerThreadFlag();
+
+			/// @brief Body of the worker: runs the handlers of the global io_context until asked to stop
+			MODIO_IMPL void Run();
+
+			/// @brief Waits for a task to be queued, for at most the idle interval
+			MODIO_IMPL void Park();
+
+			std::thread Thread {};
+			std::atomic<bool> bRunning {false};
+			std::atomic<bool> bStopRequested {false};
+			std::atomic<bool> bShutdownPending {false};
+
+			Modio::Detail::WorkerIdleStrategy Strategy = Modio::Detail::WorkerIdleStrategy::Park;
+			std::chrono::microseconds IdleInterval {};
+
+			std::mutex ParkMutex {};
+			std::condition_variable ParkCondition {};
+			bool bTaskQueued = false;
+
+			moodycamel::ConcurrentQueue<fu2::unique_function<void()>> CallbackQueue {};
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ModioWorkerThread.ipp"
+#endif
@@ -0,0 +1,220 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/ModioWorkerThread.h"
+#endif
+
+#include "modio/core/ModioLogService.h"
+#include "modio/core/ModioServices.h"
+#include "modio/detail/ModioProfiling.h"
+#include "modio/detail/ModioSDKSessionData.h"
+
+namespace Modio
+{
+	namespace Detail
+	{
+		WorkerThread& WorkerThread::Get()
+		{
+			static WorkerThread Instance;
+			return Instance;
+		}
+
+		bool& WorkerThread::IsWorkerThreadFlag()
+		{
+			static thread_local bool bIsWorkerThread = false;
+			return bIsWorkerThread;
+		}
+
+		WorkerThread::~WorkerThread()
+		{
+			if (Thread.joinable())
+			{
+				bStopRequested = true;
+				ParkCondition.notify_all();
+				Thread.join();
+			}
+		}
+
+		bool WorkerThread::Start(Modio::Detail::WorkerIdleStrategy Strategy, std::chrono::microseconds IdleInterval)
+		{
+			WorkerThread& Worker = Get();
+			if (Worker.bRunning)
+			{
+				return false;
+			}
+
+			Worker.Strategy = Strategy;
+			Worker.IdleInterval = IdleInterval;
+			Worker.bStopRequested = false;
+			Worker.bShutdownPending = false;
+			Worker.bTaskQueued = false;
+			Worker.bRunning = true;
+			Worker.Thread = std::thread([&Worker]() { Worker.Run(); });
+			return true;
+		}
+
+		void WorkerThread::RequestStop()
+		{
+			WorkerThread& Worker = Get();
+			if (Worker.bRunning)
+			{
+				{
+					std::lock_guard<std::mutex> Lock(Worker.ParkMutex);
+					Worker.bStopRequested = true;
+				}
+				Worker.ParkCondition.notify_one();
+			}
+		}
+
+		bool WorkerThread::IsRunning()
+		{
+			return Get().bRunning;
+		}
+
+		bool WorkerThread::IsCurrentThread()
+		{
+			return IsWorkerThreadFlag();
+		}
+
+		void WorkerThread::NotifyTaskQueued()
+		{
+			WorkerThread& Worker = Get();
+			if (Worker.bRunning)
+			{
+				{
+					std::lock_guard<std::mutex> Lock(Worker.ParkMutex);
+					Worker.bTaskQueued = true;
+				}
+				Worker.ParkCondition.notify_one();
+			}
+		}
+
+		void WorkerThread::SetShutdownPending(bool bPending)
+		{
+			Get().bShutdownPending = bPending;
+		}
+
+		void WorkerThread::EnqueueCallback(fu2::unique_function<void()> Callback)
+		{
+			Get().CallbackQueue.enqueue(std::move(Callback));
+		}
+
+		void WorkerThread::DispatchCallbacks()
+		{
+			MODIO_PROFILE_SCOPE(DispatchCallbacks);
+
+			WorkerThread& Worker = Get();
+			// Joined before the queue is drained, so the worker has exited by the time the callback that stopped it
+			// (such as the one passed to ShutdownAsync) is run
+			if (Worker.bStopRequested && Worker.Thread.joinable() && !IsCurrentThread())
+			{
+				Worker.Thread.join();
+				Worker.bRunning = false;
+			}
+
+			fu2::unique_function<void()> Callback;
+			while (Worker.CallbackQueue.try_dequeue(Callback))
+			{
+				Callback();
+			}
+		}
+
+		Modio::Optional<Modio::Detail::WorkerIdleStrategy> WorkerThread::ParseIdleStrategy(const std::string& Value)
+		{
+			if (Value == "Park")
+			{
+				return Modio::Detail::WorkerIdleStrategy::Park;
+			}
+			if (Value == "Yield")
+			{
+				return Modio::Detail::WorkerIdleStrategy::Yield;
+			}
+			if (Value == "Spin")
+			{
+				return Modio::Detail::WorkerIdleStrategy::Spin;
+			}
+			return {};
+		}
+
+		void WorkerThread::Run()
+		{
+			IsWorkerThreadFlag() = true;
+
+			while (!bStopRequested)
+			{
+				// Taking the shutdown lock in a tight loop can starve ShutdownAsync of it on some platforms
+				if (bShutdownPending)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				bool bRanHandlers = false;
+				bool bOutOfWork = false;
+				{
+					auto ShutdownLock = Modio::Detail::SDKSessionData::TryGetShutdownLock();
+					if (ShutdownLock.owns_lock())
+					{
+						MODIO_PROFILE_SCOPE(WorkerThreadRun);
+
+						ModioAsio::io_context& Context = Modio::Detail::Services::GetGlobalContext();
+						if (Context.stopped())
+						{
+							Context.restart();
+						}
+						Modio::Detail::SDKSessionData::PushQueuedTasksToGlobalContext();
+						bRanHandlers = Context.poll() > 0;
+						if (!bRanHandlers && Strategy == Modio::Detail::WorkerIdleStrategy::Park)
+						{
+							// Waits in the io_context's reactor rather than sleeping, so an I/O completion wakes the
+							// worker straight away. Returns at once if the io_context has no outstanding work
+							bRanHandlers = Context.run_one_for(IdleInterval) > 0;
+						}
+						bOutOfWork = Context.stopped();
+
+						Modio::Detail::SDKSessionData::FlushModManagementLog();
+						Modio::Detail::Services::GetGlobalService<Modio::Detail::LogService>().FlushLogBuffer();
+					}
+				}
+
+				if (bRanHandlers)
+				{
+					continue;
+				}
+
+				switch (Strategy)
+				{
+					case Modio::Detail::WorkerIdleStrategy::Park:
+						// With outstanding work the worker has already parked in the io_context
+						if (bOutOfWork)
+						{
+							Park();
+						}
+						break;
+					case Modio::Detail::WorkerIdleStrategy::Yield:
+						std::this_thread::yield();
+						break;
+					case Modio::Detail::WorkerIdleStrategy::Spin:
+						break;
+				}
+			}
+
+			IsWorkerThreadFlag() = false;
+		}
+
+		void WorkerThread::Park()
+		{
+			std::unique_lock<std::mutex> Lock(ParkMutex);
+			ParkCondition.wait_for(Lock, IdleInterval, [this]() { return bTaskQueued || bStopRequested; });
+			bTaskQueued = false;
+		}
+	} // namespace Detail
+} // namespace Modio
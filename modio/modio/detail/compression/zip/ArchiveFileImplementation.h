@@ -12,11 +12,15 @@
 
 #include "modio/core/ModioCoreTypes.h"
 #include "modio/detail/FilesystemWrapper.h"
+#include "modio/detail/ModioMD5.h"
+#include <memory>
 
 namespace Modio
 {
 	namespace Detail
 	{
+		class ArchivePartSpool;
+
 		class ArchiveFileImplementation
 		{
 		public:
@@ -26,6 +30,16 @@ namespace Modio
 				Deflate = 8
 			};
 
+			/// @brief Controls how AddFileEntryOp selects the compression method for each file entry
+			enum class EntryCompressionMode : std::uint8_t
+			{
+				/// @brief Every file entry is compressed with Deflate
+				AlwaysDeflate,
+				/// @brief Files that are already compressed (determined by extension, or by deflating a sample of the
+				/// first block) are written with Store instead
+				Automatic
+			};
+
 			struct ArchiveEntry
 			{
 				CompressionMethod Compression = CompressionMethod::Deflate;
@@ -35,6 +49,8 @@ namespace Modio
 				std::uintmax_t UncompressedSize = 0;
 				std::uint32_t CRCValue = 0;
 				bool bIsDirectory = false;
+				/// @brief The CRC and sizes of this entry follow its data rather than being in its local header
+				bool bHasDataDescriptor = false;
 			};
 
 		private:
@@ -42,7 +58,8 @@ namespace Modio
 
 		public:
 			MODIO_IMPL void AddEntry(std::string FileName, std::uintmax_t FileOffset, std::uintmax_t CompressedSize, std::uintmax_t UncompressedSize,
-						  CompressionMethod Compression, std::uint32_t CRCValue, bool bIsDirectory = false);
+						  CompressionMethod Compression, std::uint32_t CRCValue, bool bIsDirectory = false,
+						  bool bHasDataDescriptor = false);
 			MODIO_IMPL void AddEntry(ArchiveEntry Entry);
 
 			/// @brief Path to the underlying archive file
@@ -54,6 +71,17 @@ namespace Modio
 			std::uint64_t CentralDirectoryOffset = 0;
 			Modio::FileSize TotalExtractedSize {};
             bool bIsZip64 = false;
+
+			/// @brief Compression method selection used when adding file entries to this archive
+			EntryCompressionMode EntryCompression = EntryCompressionMode::Automatic;
+
+			/// @brief When set, the archive is written to this spool instead of FilePath
+			std::shared_ptr<ArchivePartSpool> OutputSpool {};
+
+			/// @brief Digest of every byte written to the archive so far. Archives are written strictly in order (each
+			/// local header precedes its data, and the CRC and sizes follow the data in a data descriptor), so once the
+			/// archive is finalized this is the MD5 of the complete file
+			Modio::Detail::MD5 ArchiveDigest {};
             
 			MODIO_IMPL std::uintmax_t GetNumberOfEntries();
 
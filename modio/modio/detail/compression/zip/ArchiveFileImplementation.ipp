@@ -23,10 +23,11 @@ namespace Modio
 
 		void ArchiveFileImplementation::AddEntry(std::string FileName, std::uintmax_t FileOffset,
 												 std::uintmax_t CompressedSize, std::uintmax_t UncompressedSize,
-												 CompressionMethod Compression, std::uint32_t CRCValue, bool bIsDirectory)
+												 CompressionMethod Compression, std::uint32_t CRCValue, bool bIsDirectory,
+												 bool bHasDataDescriptor)
 		{
-			ArchiveEntries.push_back(
-				ArchiveEntry {Compression, FileName, FileOffset, CompressedSize, UncompressedSize, CRCValue, bIsDirectory});
+			ArchiveEntries.push_back(ArchiveEntry {Compression, FileName, FileOffset, CompressedSize, UncompressedSize,
+												   CRCValue, bIsDirectory, bHasDataDescriptor});
 		}
 
 		std::uintmax_t ArchiveFileImplementation::GetNumberOfEntries()
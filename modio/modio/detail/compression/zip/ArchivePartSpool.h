@@ -0,0 +1,148 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioErrorCode.h"
+#include "modio/core/ModioStdTypes.h"
+#include "modio/detail/FilesystemWrapper.h"
+#include "modio/detail/Function2Wrapper.h"
+#include "modio/file/ModioFile.h"
+#include <deque>
+#include <memory>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @brief Splits the byte stream of an archive that is being written into fixed-size part files, so the parts
+		/// can be uploaded while the rest of the archive is still being produced. At most MaxPartsOnDisk part files
+		/// exist at any time: the writer is suspended until the reader releases a part once it is done with it.
+		class ArchivePartSpool
+		{
+		public:
+			struct SpooledPart
+			{
+				/// @brief Zero-based index of the part
+				std::int32_t Index = 0;
+				Modio::filesystem::path FilePath {};
+				/// @brief Location of the first byte of the part in the complete archive
+				std::uint64_t ArchiveOffset = 0;
+				std::uint64_t Size = 0;
+			};
+
+			/// @param PartPathPrefix Path that the index of each part is appended to, to name its file
+			/// @param PartSize Size of every part but the last one
+			/// @param MaxPartsOnDisk Number of part files, including the one being written, that may exist at once
+			MODIO_IMPL ArchivePartSpool(Modio::filesystem::path PartPathPrefix, std::uint64_t PartSize,
+										std::uint32_t MaxPartsOnDisk);
+
+			// Writer side
+
+			/// @brief Number of archive bytes written to the spool so far, which is also the archive offset of the next
+			/// byte written
+			MODIO_IMPL std::uint64_t GetBytesWritten() const;
+
+			/// @brief true if a part file is open for writing
+			MODIO_IMPL bool HasOpenPart() const;
+
+			/// @brief Hands the last filled part to the reader. Called by the writer once it knows more bytes follow
+			MODIO_IMPL void HandOverFullPart();
+
+			/// @brief true if a new part file can be created without exceeding MaxPartsOnDisk
+			MODIO_IMPL bool CanOpenPart() const;
+
+			/// @brief Creates the file for the next part
+			MODIO_IMPL Modio::ErrorCode OpenPart();
+
+			/// @brief Number of bytes that still fit in the open part
+			MODIO_IMPL std::uint64_t GetOpenPartCapacity() const;
+
+			MODIO_IMPL Modio::Detail::File& GetOpenPartFile();
+
+			/// @brief Records that Size bytes were written to the open part, closing the part when it is full
+			MODIO_IMPL void CommitBytes(std::uint64_t Size);
+
+			/// @brief Suspends the writer until the reader releases a part or the spool fails
+			template<typename OperationType>
+			void WaitForPartReleaseAsync(OperationType&& Operation)
+			{
+				WriterWaiter = std::forward<OperationType>(Operation);
+			}
+
+			/// @brief Hands the remaining bytes to the reader as the last part. Once closed, the archive size is known.
+			/// @param ec Error that stopped the writer, if any. The spool fails with it instead of closing, and the
+			/// part being written is deleted
+			MODIO_IMPL void Close(Modio::ErrorCode ec = {});
+
+			// Reader side
+
+			/// @brief Sets a callback invoked whenever a part becomes ready, the spool closes, or it fails
+			MODIO_IMPL void SetReaderNotifier(fu2::unique_function<void()> Notifier);
+
+			/// @brief true if a part is waiting to be taken by the reader
+			MODIO_IMPL bool HasReadyParts() const;
+
+			/// @brief Takes the next part that is ready to be read, if any
+			MODIO_IMPL Modio::Optional<SpooledPart> TakeReadyPart();
+
+			/// @brief Deletes the file of a part the reader is done with, which lets the writer continue
+			MODIO_IMPL void ReleasePart(const SpooledPart& Part);
+
+			/// @brief true once every part has been handed to the reader
+			MODIO_IMPL bool IsClosed() const;
+
+			/// @brief true once the writer has called Close, whether or not the spool failed. Until then the writer
+			/// may still be using the spool and the archive it produces
+			MODIO_IMPL bool IsWriterFinished() const;
+
+			/// @brief Size of the complete archive, only available once the spool is closed
+			MODIO_IMPL Modio::Optional<std::uint64_t> GetTotalSize() const;
+
+			/// @brief Number of bytes in the parts released so far
+			MODIO_IMPL std::uint64_t GetBytesReleased() const;
+
+			// Both sides
+
+			/// @brief Stops the spool with an error, deleting the ready part files nobody is reading yet. Both the
+			/// writer and the reader are woken up so they can observe the error
+			MODIO_IMPL void Fail(Modio::ErrorCode ec);
+
+			MODIO_IMPL Modio::ErrorCode GetError() const;
+
+		private:
+			MODIO_IMPL Modio::filesystem::path MakePartPath(std::int32_t Index) const;
+			MODIO_IMPL void DiscardOpenPart();
+			MODIO_IMPL void NotifyReader();
+			MODIO_IMPL void NotifyWriter();
+
+			Modio::filesystem::path PartPathPrefix {};
+			std::uint64_t PartSize = 0;
+			std::uint32_t MaxPartsOnDisk = 1;
+			std::uint32_t NumPartsOnDisk = 0;
+			std::int32_t NextPartIndex = 0;
+			std::uint64_t BytesWritten = 0;
+			std::uint64_t BytesReleased = 0;
+			std::unique_ptr<Modio::Detail::File> OpenPartFile {};
+			SpooledPart OpenPartInfo {};
+			std::deque<SpooledPart> ReadyParts {};
+			bool bHoldingFullPart = false;
+			bool bClosed = false;
+			bool bWriterFinished = false;
+			Modio::ErrorCode Error {};
+			fu2::unique_function<void()> WriterWaiter {};
+			fu2::unique_function<void()> ReaderNotifier {};
+		};
+	} // namespace Detail
+} // namespace Modio
+
+#ifndef MODIO_SEPARATE_COMPILATION
+	#include "ArchivePartSpool.ipp"
+#endif
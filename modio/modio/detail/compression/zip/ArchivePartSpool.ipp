@@ -0,0 +1,257 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#ifdef MODIO_SEPARATE_COMPILATION
+	#include "modio/detail/compression/zip/ArchivePartSpool.h"
+#endif
+
+#include "modio/core/ModioLogger.h"
+#include "modio/core/ModioServices.h"
+#include "modio/file/ModioFileService.h"
+#include <algorithm>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		ArchivePartSpool::ArchivePartSpool(Modio::filesystem::path PartPathPrefix, std::uint64_t PartSize,
+										   std::uint32_t MaxPartsOnDisk)
+			: PartPathPrefix(PartPathPrefix),
+			  PartSize(PartSize),
+			  MaxPartsOnDisk(std::max<std::uint32_t>(1, MaxPartsOnDisk))
+		{}
+
+		std::uint64_t ArchivePartSpool::GetBytesWritten() const
+		{
+			return BytesWritten;
+		}
+
+		bool ArchivePartSpool::HasOpenPart() const
+		{
+			return OpenPartFile != nullptr;
+		}
+
+		bool ArchivePartSpool::CanOpenPart() const
+		{
+			return NumPartsOnDisk < MaxPartsOnDisk;
+		}
+
+		Modio::ErrorCode ArchivePartSpool::OpenPart()
+		{
+			HandOverFullPart();
+			OpenPartInfo = SpooledPart {NextPartIndex, MakePartPath(NextPartIndex), BytesWritten, 0};
+			NextPartIndex++;
+			NumPartsOnDisk++;
+			OpenPartFile =
+				std::make_unique<Modio::Detail::File>(OpenPartInfo.FilePath, Modio::Detail::FileMode::ReadWrite, true);
+			if (!Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(
+					OpenPartInfo.FilePath))
+			{
+				OpenPartFile.reset();
+				NumPartsOnDisk--;
+				return Modio::make_error_code(Modio::FilesystemError::NoPermission);
+			}
+			return {};
+		}
+
+		std::uint64_t ArchivePartSpool::GetOpenPartCapacity() const
+		{
+			return PartSize - OpenPartInfo.Size;
+		}
+
+		Modio::Detail::File& ArchivePartSpool::GetOpenPartFile()
+		{
+			return *OpenPartFile;
+		}
+
+		void ArchivePartSpool::CommitBytes(std::uint64_t Size)
+		{
+			OpenPartInfo.Size += Size;
+			BytesWritten += Size;
+			if (OpenPartInfo.Size == PartSize)
+			{
+				// Closing the handle flushes the part, but it is only handed over once more bytes follow it. That way
+				// the last part is always handed over by Close, when the size of the archive is known
+				OpenPartFile.reset();
+				bHoldingFullPart = true;
+			}
+		}
+
+		void ArchivePartSpool::HandOverFullPart()
+		{
+			if (bHoldingFullPart)
+			{
+				bHoldingFullPart = false;
+				ReadyParts.push_back(OpenPartInfo);
+				NotifyReader();
+			}
+		}
+
+		void ArchivePartSpool::Close(Modio::ErrorCode ec)
+		{
+			if (bClosed)
+			{
+				return;
+			}
+			bWriterFinished = true;
+
+			if (ec || Error)
+			{
+				Fail(ec);
+				DiscardOpenPart();
+				// Fail does nothing if the reader stopped the spool first, and the reader may be waiting for the
+				// writer to finish
+				NotifyReader();
+				return;
+			}
+
+			// Mark the spool as closed first, so the reader sees the total size when it takes the last part
+			bClosed = true;
+
+			// The last part holds whatever did not fill a whole part
+			if (bHoldingFullPart)
+			{
+				HandOverFullPart();
+			}
+			else if (OpenPartFile != nullptr && OpenPartInfo.Size > 0)
+			{
+				// Closing the handle flushes the part so the reader sees all of its bytes
+				OpenPartFile.reset();
+				ReadyParts.push_back(OpenPartInfo);
+			}
+			else
+			{
+				DiscardOpenPart();
+			}
+
+			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Compression,
+										"Archive spool closed after {} parts, {} bytes", NextPartIndex, BytesWritten);
+			NotifyReader();
+		}
+
+		void ArchivePartSpool::SetReaderNotifier(fu2::unique_function<void()> Notifier)
+		{
+			ReaderNotifier = std::move(Notifier);
+		}
+
+		bool ArchivePartSpool::HasReadyParts() const
+		{
+			return !Error && !ReadyParts.empty();
+		}
+
+		Modio::Optional<ArchivePartSpool::SpooledPart> ArchivePartSpool::TakeReadyPart()
+		{
+			if (Error || ReadyParts.empty())
+			{
+				return {};
+			}
+			SpooledPart Part = ReadyParts.front();
+			ReadyParts.pop_front();
+			return Part;
+		}
+
+		void ArchivePartSpool::ReleasePart(const SpooledPart& Part)
+		{
+			Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(Part.FilePath);
+			NumPartsOnDisk--;
+			BytesReleased += Part.Size;
+			NotifyWriter();
+		}
+
+		bool ArchivePartSpool::IsClosed() const
+		{
+			return bClosed;
+		}
+
+		bool ArchivePartSpool::IsWriterFinished() const
+		{
+			return bWriterFinished;
+		}
+
+		Modio::Optional<std::uint64_t> ArchivePartSpool::GetTotalSize() const
+		{
+			if (bClosed)
+			{
+				return BytesWritten;
+			}
+			return {};
+		}
+
+		std::uint64_t ArchivePartSpool::GetBytesReleased() const
+		{
+			return BytesReleased;
+		}
+
+		void ArchivePartSpool::Fail(Modio::ErrorCode ec)
+		{
+			if (Error)
+			{
+				return;
+			}
+
+			Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Compression,
+										"Archive spool failed after {} bytes: {}", BytesWritten, ec.message());
+			Error = ec;
+
+			// Parts that are being read are deleted when the reader releases them, and the part being written is
+			// deleted when the writer closes the spool
+			for (const SpooledPart& Part : ReadyParts)
+			{
+				Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(Part.FilePath);
+				NumPartsOnDisk--;
+			}
+			ReadyParts.clear();
+
+			NotifyWriter();
+			NotifyReader();
+		}
+
+		Modio::ErrorCode ArchivePartSpool::GetError() const
+		{
+			return Error;
+		}
+
+		Modio::filesystem::path ArchivePartSpool::MakePartPath(std::int32_t Index) const
+		{
+			Modio::filesystem::path PartPath = PartPathPrefix;
+			PartPath += fmt::format(".part{}", Index);
+			return PartPath;
+		}
+
+		void ArchivePartSpool::DiscardOpenPart()
+		{
+			if (OpenPartFile != nullptr || bHoldingFullPart)
+			{
+				OpenPartFile.reset();
+				bHoldingFullPart = false;
+				Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+					OpenPartInfo.FilePath);
+				NumPartsOnDisk--;
+			}
+		}
+
+		void ArchivePartSpool::NotifyReader()
+		{
+			if (ReaderNotifier)
+			{
+				ReaderNotifier();
+			}
+		}
+
+		void ArchivePartSpool::NotifyWriter()
+		{
+			if (WriterWaiter)
+			{
+				ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(WriterWaiter));
+				WriterWaiter = nullptr;
+			}
+		}
+	} // namespace Detail
+} // namespace Modio
@@ -75,6 +75,8 @@ namespace Modio
 				constexpr static uint16_t ZipVersion = 20;
 				// Min version required for Zip64 decompression
 				constexpr static uint16_t Zip64Version = 45;
+				// General purpose bit-flag set when the CRC-32 and sizes follow the file data in a data descriptor
+				constexpr static uint16_t DataDescriptorFlag = 0x0008;
 
 			} // namespace ZipTag
 		} // namespace Constants
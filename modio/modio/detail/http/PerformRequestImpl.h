@@ -14,6 +14,7 @@
 #include "modio/detail/ModioOperationQueue.h"
 #include "modio/file/ModioFile.h"
 #include "modio/http/ModioHttpParams.h"
+#include <chrono>
 
 namespace Modio
 {
@@ -28,6 +29,8 @@ namespace Modio
 			Modio::Optional<std::pair<std::string, Modio::Detail::PayloadContent>> PayloadElement {};
 			std::unique_ptr<Modio::Detail::Buffer> HeaderBuf {};
 			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo {};
+			// When the request was sent, for the latency reported by Modio::QueryRuntimeStats
+			std::chrono::steady_clock::time_point SendTime {};
 
 		public:
 			PerformRequestImpl(Modio::Detail::OperationQueue::Ticket RequestTicket)
@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioErrorCode.h"
+#include "modio/core/ModioServices.h"
+#include "modio/detail/AsioWrapper.h"
+#include "modio/detail/FilesystemWrapper.h"
+#include "modio/detail/ModioMD5.h"
+#include "modio/detail/ops/RunOnComputePoolOp.h"
+#include "modio/file/ModioFile.h"
+#include <algorithm>
+#include <memory>
+
+MODIO_DIAGNOSTIC_PUSH
+MODIO_ALLOW_DEPRECATED_SYMBOLS
+
+#include <asio/yield.hpp>
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @brief Reads a file from start to end to calculate its MD5
+		class ComputeFileMD5Op
+		{
+			ModioAsio::coroutine CoroutineState {};
+			Modio::filesystem::path FilePath {};
+			std::shared_ptr<std::string> MD5 {};
+			std::unique_ptr<Modio::Detail::File> InputFile {};
+			Modio::Detail::DynamicBuffer ReadBuffer {};
+			// Shared with the hashing work, which runs on the compute pool
+			std::shared_ptr<Modio::Detail::MD5> Digest = std::make_shared<Modio::Detail::MD5>();
+			std::uint64_t FileSize = 0;
+
+		public:
+			ComputeFileMD5Op(Modio::filesystem::path FilePath, std::shared_ptr<std::string> MD5)
+				: FilePath(FilePath),
+				  MD5(MD5)
+			{}
+
+			template<typename CoroType>
+			void operator()(CoroType& Self, Modio::ErrorCode ec = {})
+			{
+				constexpr std::uint64_t ChunkOfBytes = 1024 * 1024;
+
+				reenter(CoroutineState)
+				{
+					InputFile = std::make_unique<Modio::Detail::File>(FilePath, Modio::Detail::FileMode::ReadOnly);
+					FileSize = InputFile->GetFileSize();
+
+					while (Digest->GetBytesHashed() < FileSize)
+					{
+						yield InputFile->ReadAsync(std::min(ChunkOfBytes, FileSize - Digest->GetBytesHashed()),
+												   ReadBuffer, std::move(Self));
+						if (ec)
+						{
+							Self.complete(ec);
+							return;
+						}
+
+						if (ReadBuffer.size() == 0)
+						{
+							// The file is shorter than it claimed to be
+							Self.complete(Modio::make_error_code(Modio::FilesystemError::ReadError));
+							return;
+						}
+
+						// ReadBuffer is a handle to the buffers that were read, so the work can share it
+						yield Modio::Detail::RunOnComputePoolAsync(
+							[HashState = Digest, ReadChunks = ReadBuffer]() {
+								for (const Modio::Detail::Buffer& ReadChunk : ReadChunks)
+								{
+									HashState->Update(ReadChunk);
+								}
+							},
+							std::move(Self));
+						ReadBuffer.Clear();
+					}
+
+					InputFile.reset();
+					*MD5 = Digest->GetHexDigest();
+					Self.complete({});
+					return;
+				}
+			}
+		};
+
+		/// @brief Calculates the MD5 of a file
+		/// @param MD5 Receives the digest as lowercase hexadecimal once the operation completes successfully
+		template<typename CompletionTokenType>
+		auto ComputeFileMD5Async(Modio::filesystem::path FilePath, std::shared_ptr<std::string> MD5,
+								 CompletionTokenType&& Token)
+		{
+			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
+				ComputeFileMD5Op(FilePath, MD5), Token, Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
+	} // namespace Detail
+} // namespace Modio
+#include <asio/unyield.hpp>
+
+MODIO_DIAGNOSTIC_POP
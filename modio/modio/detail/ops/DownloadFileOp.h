@@ -11,9 +11,15 @@
 #pragma once
 
 #include "modio/core/ModioBuffer.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/ModioMD5.h"
 #include "modio/detail/ModioObjectTrack.h"
+#include "modio/detail/ModioRuntimeStats.h"
+#include "modio/detail/ModioStringHelpers.h"
 #include "modio/file/ModioFile.h"
+#include "modio/file/ModioFileService.h"
 #include "modio/http/ModioHttpRequest.h"
+#include <algorithm>
 
 MODIO_DIAGNOSTIC_PUSH
 MODIO_ALLOW_DEPRECATED_SYMBOLS
@@ -23,7 +29,9 @@ namespace Modio
 {
 	namespace Detail
 	{
-		/// @brief Operation which downloads an arbitrary file to an arbitrary filesystem path
+		/// @brief Operation which downloads an arbitrary file to an arbitrary filesystem path. If the MD5 of the file is
+		/// known, the bytes are hashed as they are written and the file is only kept if it matches. The hash state is
+		/// saved alongside the partial file so an interrupted download resumes hashing without reading it again
 		class DownloadFileOp : public Modio::Detail::BaseOperation<DownloadFileOp>
 		{
 			Modio::StableStorage<Modio::Detail::HttpRequest> Request {};
@@ -31,19 +39,28 @@ namespace Modio
 			Modio::Detail::DynamicBuffer ResponseBodyBuffer {};
 			Modio::StableStorage<Modio::Detail::File> File {};
 
-			Modio::StableStorage<std::uintmax_t> CurrentFilePosition {};
-			Modio::StableStorage<bool> EndOfFileReached {};
 			Modio::Optional<std::weak_ptr<Modio::ModProgressInfo>> ProgressInfo {};
 
 			Modio::Optional<std::uint64_t> ExpectedFilesize {};
+			Modio::Optional<std::string> ExpectedMD5 {};
 			Modio::filesystem::path DestinationPath;
 
 			struct DownloadFileImpl
 			{
 				Modio::Detail::DynamicBuffer WriteBuffers;
 				Modio::Detail::OperationQueue::Ticket DownloadTicket;
+				std::uintmax_t CurrentFilePosition = 0;
 				std::uint8_t RedirectLimit = 8;
 				bool bRequiresRedirect = false;
+				bool bEndOfFileReached = false;
+				// MD5 of the bytes written to the file so far, only used when ExpectedMD5 is set
+				Modio::Detail::MD5 Digest;
+				// Holds the expected MD5 followed by the saved state of Digest
+				std::unique_ptr<Modio::Detail::File> CheckpointFile;
+				Modio::Detail::DynamicBuffer CheckpointBuffer;
+				std::uintmax_t LastCheckpointPosition = 0;
+				// When the first request was sent, for the latency reported by Modio::QueryRuntimeStats
+				std::chrono::steady_clock::time_point SendTime {};
 
 			public:
 				DownloadFileImpl(Modio::Detail::OperationQueue::Ticket DownloadTicket)
@@ -57,17 +74,18 @@ namespace Modio
 						   Modio::filesystem::path DestinationPath,
 						   Modio::Detail::OperationQueue::Ticket DownloadTicket,
 						   Modio::Optional<std::weak_ptr<Modio::ModProgressInfo>> ProgressInfo,
-							Modio::Optional<std::uint64_t> Filesize)
+							Modio::Optional<std::uint64_t> Filesize, Modio::Optional<std::string> MD5 = {})
 				: ProgressInfo(ProgressInfo),
 				  DestinationPath(DestinationPath)
 			{
 				ExpectedFilesize = Filesize;
-				// Initialize CurrentFilePosition to 0 - we'll set the actual value after truncate
-				CurrentFilePosition = std::make_shared<std::uintmax_t>(0ULL);
+				if (MD5.has_value() && !MD5->empty())
+				{
+					ExpectedMD5 = Modio::Detail::String::ToLowercase(*MD5);
+				}
 				// Initialize the request without range header - we'll update it after setting the position
-				Request = std::make_shared<Modio::Detail::HttpRequest>(RequestParams);
-				EndOfFileReached = std::make_shared<bool>(false);
-				Impl = std::make_shared<DownloadFileImpl>(std::move(DownloadTicket));
+				Request = Modio::Detail::MakePooled<Modio::Detail::HttpRequest>(RequestParams);
+				Impl = Modio::Detail::MakePooled<DownloadFileImpl>(std::move(DownloadTicket));
 			}
 
 			template<typename CoroType>
@@ -109,23 +127,51 @@ namespace Modio
 
 				reenter(Coroutine)
 				{
-					File = std::make_shared<Modio::Detail::File>(DestinationPath += Modio::filesystem::path(".download"),
-															  Modio::Detail::FileMode::ReadWrite, false);
+					File = Modio::Detail::MakePooled<Modio::Detail::File>(
+						DestinationPath += Modio::filesystem::path(".download"), Modio::Detail::FileMode::ReadWrite,
+						false);
 
-					// Initialize file position and perform truncate/seek operations
-					*CurrentFilePosition = File->GetFileSize() - (File->GetFileSize() % (static_cast<std::int64_t>(1024) * 1024));
+					if (ExpectedMD5.has_value())
+					{
+						// Only the part of the file covered by the saved hash state can be kept, everything after it
+						// is downloaded again
+						Impl->CheckpointFile = std::make_unique<Modio::Detail::File>(
+							GetCheckpointPath(), Modio::Detail::FileMode::ReadWrite, false);
+						if (Impl->CheckpointFile->GetFileSize() > 0)
+						{
+							yield Impl->CheckpointFile->ReadSomeAtAsync(0, Impl->CheckpointFile->GetFileSize(),
+																		Impl->CheckpointBuffer, std::move(Self));
+							if (ec || !RestoreCheckpoint())
+							{
+								Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::File,
+															"Discarding unusable hash state for partial download {}",
+															Modio::ToModioString(File->GetPath().u8string()));
+								Impl->Digest = Modio::Detail::MD5();
+								ec = {};
+							}
+							Impl->CheckpointBuffer.Clear();
+						}
+						Impl->CurrentFilePosition = Impl->Digest.GetBytesHashed();
+						Impl->LastCheckpointPosition = Impl->CurrentFilePosition;
+					}
+					else
+					{
+						// Initialize file position and perform truncate/seek operations
+						Impl->CurrentFilePosition =
+							File->GetFileSize() - (File->GetFileSize() % (static_cast<std::int64_t>(1024) * 1024));
+					}
 
-					ec = File->Truncate(Modio::FileOffset(*CurrentFilePosition));
+					ec = File->Truncate(Modio::FileOffset(Impl->CurrentFilePosition));
 					if (ec)
 					{
 						Self.complete(ec);
 						return;
 					}
 
-					File->Seek(Modio::FileOffset(*CurrentFilePosition));
+					File->Seek(Modio::FileOffset(Impl->CurrentFilePosition));
 
 					// Update request with range header now that we have the correct position
-					Request->Parameters().SetRange(Modio::FileOffset(*CurrentFilePosition), {});
+					Request->Parameters().SetRange(Modio::FileOffset(Impl->CurrentFilePosition), {});
 
 					yield Impl->DownloadTicket.WaitForTurnAsync(std::move(Self));
 
@@ -137,6 +183,7 @@ namespace Modio
 
 					Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::Http,
 												"Beginning download of file {}", Modio::ToModioString(File->GetPath().u8string()));
+					Impl->SendTime = std::chrono::steady_clock::now();
 					do
 					{
 						yield Request->SendAsync(std::move(Self));
@@ -190,7 +237,8 @@ namespace Modio
 									return;
 								}
 								// Swap out the request for a new one for the redirect
-								Request = std::make_shared<Modio::Detail::HttpRequest>(RedirectedParams.value());
+								Request =
+									Modio::Detail::MakePooled<Modio::Detail::HttpRequest>(RedirectedParams.value());
 							}
 							else
 							{
@@ -212,10 +260,30 @@ namespace Modio
 						else
 						{
 							Impl->bRequiresRedirect = false;
+
+							if (Request->GetResponseCode() == 200 && Impl->CurrentFilePosition > 0)
+							{
+								// The server ignored the range and is sending the whole file, so start over
+								Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::Http,
+															"Server does not support resuming {}, restarting download",
+															Modio::ToModioString(File->GetPath().u8string()));
+								Impl->CurrentFilePosition = 0;
+								Impl->Digest = Modio::Detail::MD5();
+								Impl->LastCheckpointPosition = 0;
+								ec = File->Truncate(Modio::FileOffset(0));
+								if (ec)
+								{
+									Self.complete(ec);
+									return;
+								}
+							}
 						}
 
 					} while (Impl->bRequiresRedirect && Impl->RedirectLimit);
 
+					Modio::Detail::RuntimeStatsCollector::Get().RecordHttpLatency(
+						Modio::Detail::HttpEndpointClass::Download, std::chrono::steady_clock::now() - Impl->SendTime);
+
 
 					while (!ec)
 					{
@@ -230,8 +298,9 @@ namespace Modio
 						else if (ec == Modio::make_error_code(Modio::GenericError::EndOfFile))
 						{
 							// Cache the EOF state, because ec gets mutated by the calls to async_WriteSomeAt below
-							*EndOfFileReached = true;
+							Impl->bEndOfFileReached = true;
 						}
+						Modio::Detail::RuntimeStatsCollector::Get().RecordDownload(ResponseBodyBuffer.size());
 
 						// Some implementations of ReadSomeFromResponseBodyAsync may store multiple buffers in a single
 						// call so make sure we steal all of them
@@ -246,14 +315,14 @@ namespace Modio
 								TotalSize = Modio::Detail::BufferCopy(Combined, Impl->WriteBuffers);
 								Impl->WriteBuffers.Clear();
 
-								*CurrentFilePosition += TotalSize;
+								Impl->CurrentFilePosition += TotalSize;
 
 								if (ProgressInfo.has_value())
 								{
 									if (!ProgressInfo->expired())
 									{
 										auto Progress = ProgressInfo->lock();
-										SetCurrentProgress(*Progress.get(), Modio::FileSize(*CurrentFilePosition));
+										SetCurrentProgress(*Progress.get(), Modio::FileSize(Impl->CurrentFilePosition));
 									}
 									else
 									{
@@ -263,13 +332,43 @@ namespace Modio
 									}
 								}
 
-								yield File->WriteSomeAtAsync(*CurrentFilePosition - TotalSize,
+								if (ExpectedMD5.has_value())
+								{
+									Impl->Digest.Update(Combined);
+								}
+
+								yield File->WriteSomeAtAsync(Impl->CurrentFilePosition - TotalSize,
 															 std::move(Combined), std::move(Self));
+
+								if (!ec && ExpectedMD5.has_value() &&
+									Impl->CurrentFilePosition - Impl->LastCheckpointPosition >=
+										Modio::Detail::Constants::Configuration::DownloadHashCheckpointInterval)
+								{
+									// The hash state is saved after the bytes it covers are written, so it never claims
+									// more of the file than is on disk
+									Impl->LastCheckpointPosition = Impl->CurrentFilePosition;
+									ec = Impl->CheckpointFile->Truncate(Modio::FileOffset(0));
+									if (!ec)
+									{
+										yield Impl->CheckpointFile->WriteSomeAtAsync(0, MakeCheckpoint(),
+																					  std::move(Self));
+									}
+									if (ec)
+									{
+										// Not fatal, an interrupted download will just resume from an earlier point
+										Modio::Detail::Logger().Log(Modio::LogLevel::Warning,
+																	Modio::LogCategory::File,
+																	"Could not save hash state for {}: {}",
+																	Modio::ToModioString(File->GetPath().u8string()),
+																	ec.message());
+										ec = {};
+									}
+								}
 							}
 						}
 
 						// Did we receive the entire response body?
-						if (*EndOfFileReached)
+						if (Impl->bEndOfFileReached)
 						{
 							// ensure that we write out any remaining blocks
 							if (Impl->WriteBuffers.end() != Impl->WriteBuffers.begin())
@@ -278,14 +377,14 @@ namespace Modio
 								TotalSize = Modio::Detail::BufferCopy(Combined, Impl->WriteBuffers);
 								Impl->WriteBuffers.Clear();
 
-								*CurrentFilePosition += TotalSize;
+								Impl->CurrentFilePosition += TotalSize;
 
 								if (ProgressInfo.has_value())
 								{
 									if (!ProgressInfo->expired())
 									{
 										auto Progress = ProgressInfo->lock();
-										SetCurrentProgress(*Progress.get(), Modio::FileSize(*CurrentFilePosition));
+										SetCurrentProgress(*Progress.get(), Modio::FileSize(Impl->CurrentFilePosition));
 									}
 									else
 									{
@@ -295,43 +394,72 @@ namespace Modio
 									}
 								}
 
-								yield File->WriteSomeAtAsync(*CurrentFilePosition - TotalSize,
+								if (ExpectedMD5.has_value())
+								{
+									Impl->Digest.Update(Combined);
+								}
+
+								yield File->WriteSomeAtAsync(Impl->CurrentFilePosition - TotalSize,
 															 std::move(Combined), std::move(Self));
 							}
 
-							Modio::filesystem::path Destination = File->GetPath().replace_extension();
-							if (Modio::ErrorCode RenameResult = File->Rename(Destination))
+							if (ExpectedMD5.has_value())
 							{
-								Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::File,
-															"Could not rename downloaded file to {}",
-															Modio::ToModioString(Destination.u8string()));
-								File.reset();
+								// The saved hash state is not needed any more: the file is either complete, or it is
+								// downloaded again from the start
+								Impl->CheckpointFile.reset();
+								Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+									GetCheckpointPath());
+							}
 
-								Self.complete(RenameResult);
+							// Both checks are made before the file is renamed, so a file that fails them never reaches
+							// the destination, where it would be taken for a leftover download
+							if (ExpectedFilesize.has_value() && (File->GetFileSize() != ExpectedFilesize))
+							{
+								Modio::Detail::Logger().Log(
+									Modio::LogLevel::Error, Modio::LogCategory::Http,
+									"Downloaded file {} has size {}, expected {}; discarding it",
+									Modio::ToModioString(File->GetPath().u8string()), File->GetFileSize(),
+									ExpectedFilesize.value());
+								DiscardDownload();
+								Self.complete(Modio::make_error_code(FilesystemError::FileVerificationFailed));
 								return;
 							}
-							else
+
+							if (ExpectedMD5.has_value() && Impl->Digest.GetHexDigest() != ExpectedMD5.value())
 							{
-								Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::Http,
-															"Download of {} completed with size: {}; expected filesize was {}",
-															Modio::ToModioString(File->GetPath().u8string()), File->GetFileSize(), ExpectedFilesize.has_value() ? ExpectedFilesize.value() : 0);
+								Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Http,
+															"Downloaded file {} has MD5 {}, expected {}; discarding it",
+															Modio::ToModioString(File->GetPath().u8string()),
+															Impl->Digest.GetHexDigest(), ExpectedMD5.value());
+								DiscardDownload();
+								Self.complete(Modio::make_error_code(FilesystemError::FileVerificationFailed));
+								return;
+							}
 
-								if (ExpectedFilesize.has_value() && (File->GetFileSize() != ExpectedFilesize))
+							{
+								Modio::filesystem::path Destination = File->GetPath().replace_extension();
+								if (Modio::ErrorCode RenameResult = File->Rename(Destination))
 								{
-									Modio::Detail::Logger().Log(
-										Modio::LogLevel::Error, Modio::LogCategory::Http,
-										"Downloaded file was not the expected size; returning");
-
-									Self.complete(Modio::make_error_code(FilesystemError::WriteError));
+									Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::File,
+																"Could not rename downloaded file to {}",
+																Modio::ToModioString(Destination.u8string()));
 									File.reset();
+
+									Self.complete(RenameResult);
 									return;
 								}
-
-								// Clean up
-								File.reset();
-								Self.complete(Modio::ErrorCode {});
-								return;
 							}
+
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::Http,
+														"Download of {} completed with size: {}",
+														Modio::ToModioString(File->GetPath().u8string()),
+														File->GetFileSize());
+
+							// Clean up
+							File.reset();
+							Self.complete(Modio::ErrorCode {});
+							return;
 						}
 					}
 
@@ -348,20 +476,68 @@ namespace Modio
 					}
 				}
 			}
+
+		private:
+			/// @brief Closes and deletes the downloaded file, so the next attempt starts over
+			void DiscardDownload()
+			{
+				Modio::filesystem::path DownloadPath = File->GetPath();
+				File.reset();
+				Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(DownloadPath);
+			}
+
+			Modio::filesystem::path GetCheckpointPath()
+			{
+				Modio::filesystem::path CheckpointPath = File->GetPath();
+				CheckpointPath += ".md5";
+				return CheckpointPath;
+			}
+
+			Modio::Detail::Buffer MakeCheckpoint()
+			{
+				Modio::Detail::Buffer State = Impl->Digest.SaveState();
+				Modio::Detail::Buffer Checkpoint(ExpectedMD5->size() + State.GetSize());
+				std::copy(ExpectedMD5->begin(), ExpectedMD5->end(), Checkpoint.Data());
+				std::copy(State.begin(), State.end(), Checkpoint.Data() + ExpectedMD5->size());
+				return Checkpoint;
+			}
+
+			/// @brief Restores Digest from the checkpoint that was read into CheckpointBuffer
+			/// @return false if the checkpoint belongs to a different file or covers more bytes than are on disk
+			bool RestoreCheckpoint()
+			{
+				Modio::Detail::Buffer Checkpoint(Impl->CheckpointBuffer.size());
+				Modio::Detail::BufferCopy(Checkpoint, Impl->CheckpointBuffer);
+				if (Checkpoint.GetSize() < ExpectedMD5->size() ||
+					!std::equal(ExpectedMD5->begin(), ExpectedMD5->end(), Checkpoint.begin()))
+				{
+					return false;
+				}
+
+				Modio::Detail::MD5 SavedDigest;
+				if (!SavedDigest.LoadState(Checkpoint.CopyRange(ExpectedMD5->size(), Checkpoint.GetSize())) ||
+					SavedDigest.GetBytesHashed() > File->GetFileSize())
+				{
+					return false;
+				}
+
+				Impl->Digest = SavedDigest;
+				return true;
+			}
 		};
 
 		template<typename CompletionTokenType>
 		auto DownloadFileAsync(Modio::Detail::HttpRequestParams DownloadParameters,
 							   Modio::filesystem::path DestinationPath,
 							   Modio::Optional<std::weak_ptr<Modio::ModProgressInfo>> ModProgress,
-							   Modio::Optional<std::uint64_t> Filesize,
+							   Modio::Optional<std::uint64_t> Filesize, Modio::Optional<std::string> MD5,
 							   CompletionTokenType&& Token)
 		{
 			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
 				DownloadFileOp(
 					DownloadParameters, DestinationPath,
 					Modio::Detail::Services::GetGlobalService<Modio::Detail::HttpService>().GetFileDownloadTicket(),
-					ModProgress, Filesize),
+					ModProgress, Filesize, MD5),
 				Token, Modio::Detail::Services::GetGlobalContext().get_executor());
 		}
 
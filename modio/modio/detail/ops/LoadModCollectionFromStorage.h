@@ -11,9 +11,12 @@
 #pragma once
 
 #include "modio/core/ModioBuffer.h"
+#include "modio/detail/ModioBinarySnapshot.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioModCollectionJournal.h"
 #include "modio/detail/ModioSDKSessionData.h"
 #include "modio/file/ModioFile.h"
+#include "modio/file/ModioFileService.h"
 #include "modio/detail/serialization/ModioModCollectionSerialization.h"
 
 #include <asio/yield.hpp>
@@ -21,6 +24,10 @@ namespace Modio
 {
 	namespace Detail
 	{
+		/// @brief Loads the system mod collection from the state.bin snapshot, then replays the changes recorded in
+		/// state.journal since the snapshot was last written. If the snapshot is missing or damaged, the collection is
+		/// loaded from the state.json export instead. The journal is replayed onto the export if both belong to the
+		/// same generation, and discarded if the export predates generations
 		class LoadModCollectionFromStorageOp
 		{
 		public:
@@ -34,42 +41,164 @@ namespace Modio
 
 					DestinationFile = std::make_unique<Modio::Detail::File>(
 						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().LocalMetadataFolder() /
-							"state.json",
+							"state.bin",
 						Modio::Detail::FileMode::ReadOnly, false);
-					if (DestinationFile->GetFileSize() == std::numeric_limits<std::uint64_t>::max())
+					if (DestinationFile->GetFileSize() != std::numeric_limits<std::uint64_t>::max())
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
-													"Could not find state.json at path: {}", DestinationFile->GetPath().string());
-						Self.complete(ec);
-						return;
-					}
-					yield DestinationFile->ReadAsync(DestinationFile->GetFileSize(), DataBuffer, std::move(Self));
-					if (ec)
-					{
-						Self.complete(ec);
-						return;
+						yield DestinationFile->ReadAsync(DestinationFile->GetFileSize(), DataBuffer, std::move(Self));
+						if (!ec && DataBuffer.size() > 0)
+						{
+							MODIO_PROFILE_SCOPE(ModCollectionDeserialize);
+							Modio::Detail::Buffer LinearSnapshot(DataBuffer.size());
+							Modio::Detail::BufferCopy(LinearSnapshot, DataBuffer);
+
+							auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
+							bLoadedSnapshot = Modio::Detail::DecodeModCollectionSnapshot(
+								LinearSnapshot, Modio::Detail::SDKSessionData::GetSystemModCollection(),
+								SnapshotGeneration);
+						}
+						if (!bLoadedSnapshot)
+						{
+							Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::ModManagement,
+														"Could not load state.bin, falling back to state.json");
+						}
+						DataBuffer.Clear();
 					}
-					else
+
+					if (!bLoadedSnapshot)
 					{
+						DestinationFile = std::make_unique<Modio::Detail::File>(
+							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
+									.LocalMetadataFolder() /
+								"state.json",
+							Modio::Detail::FileMode::ReadOnly, false);
+						if (DestinationFile->GetFileSize() == std::numeric_limits<std::uint64_t>::max())
+						{
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+														"Could not find a saved mod collection in {}",
+														DestinationFile->GetPath().parent_path().string());
+							DiscardJournal();
+							Self.complete({});
+							return;
+						}
+						yield DestinationFile->ReadAsync(DestinationFile->GetFileSize(), DataBuffer, std::move(Self));
+						if (ec)
+						{
+							Self.complete(ec);
+							return;
+						}
+
 						if (DataBuffer.size() > 0)
 						{
 							MODIO_PROFILE_SCOPE(ModCollectionDeserialize);
 							auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
 							nlohmann::json StateJson = Modio::Detail::ToJson(DataBuffer);
 							from_json(StateJson, Modio::Detail::SDKSessionData::GetSystemModCollection());
+							bExportHasGeneration = Modio::Detail::ParseSafe(
+								StateJson, SnapshotGeneration,
+								Modio::Detail::Constants::JSONKeys::ModCollectionGeneration);
 						}
+						DataBuffer.Clear();
+
+						if (!bExportHasGeneration)
+						{
+							DestinationFile.reset();
+							DiscardJournal();
+							Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::ModManagement,
+														"Mod collection loaded");
+							Self.complete({});
+							return;
+						}
+					}
+					DestinationFile.reset();
+
+					JournalFilePath =
+						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().LocalMetadataFolder() /
+						"state.journal";
+					if (!Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(
+							JournalFilePath))
+					{
+						ResetJournal();
 						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::ModManagement,
 													"Mod collection loaded");
+						Self.complete({});
+						return;
+					}
 
+					JournalFile = std::make_unique<Modio::Detail::File>(JournalFilePath,
+																		Modio::Detail::FileMode::ReadWrite, false);
+					yield JournalFile->ReadAsync(JournalFile->GetFileSize(), JournalBuffer, std::move(Self));
+					if (ec)
+					{
+						// The snapshot on its own is still a consistent, if older, collection
+						Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::ModManagement,
+													"Could not read the mod collection journal: {}", ec.message());
+						ResetJournal();
 						Self.complete({});
+						return;
 					}
+
+					{
+						MODIO_PROFILE_SCOPE(ModCollectionJournalReplay);
+						Modio::Detail::Buffer LinearJournal(JournalBuffer.size());
+						Modio::Detail::BufferCopy(LinearJournal, JournalBuffer);
+
+						auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
+						Modio::Detail::SDKSessionData::GetModCollectionJournal().Replay(
+							LinearJournal, SnapshotGeneration, Modio::Detail::SDKSessionData::GetSystemModCollection());
+					}
+
+					// Drop the torn tail of an interrupted append, so new records do not end up in front of leftover
+					// bytes
+					if (!Modio::Detail::SDKSessionData::GetModCollectionJournal().NeedsCompaction() &&
+						JournalFile->GetFileSize() > Modio::Detail::SDKSessionData::GetModCollectionJournal().GetSize())
+					{
+						if (JournalFile->Truncate(Modio::FileOffset(
+								Modio::Detail::SDKSessionData::GetModCollectionJournal().GetSize())))
+						{
+							Modio::Detail::SDKSessionData::GetModCollectionJournal().MarkCompactionRequired();
+						}
+					}
+					JournalFile.reset();
+
+					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::ModManagement,
+												"Mod collection loaded");
+
+					Self.complete({});
 				}
 			}
 
 		private:
+			void ResetJournal()
+			{
+				auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
+				Modio::Detail::SDKSessionData::GetModCollectionJournal().Reset(
+					SnapshotGeneration, Modio::Detail::SDKSessionData::GetSystemModCollection());
+			}
+
+			/// @brief Restarts the journal when there is no collection with a generation to replay it onto. The file is
+			/// removed so that its records can never be matched to a snapshot written later with the same generation
+			void DiscardJournal()
+			{
+				Modio::filesystem::path JournalPath =
+					Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().LocalMetadataFolder() /
+					"state.journal";
+				if (Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(JournalPath))
+				{
+					Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(JournalPath);
+				}
+				ResetJournal();
+			}
+
 			ModioAsio::coroutine CoroutineState {};
 			std::unique_ptr<Modio::Detail::File> DestinationFile {};
 			Modio::Detail::DynamicBuffer DataBuffer {};
+			std::uint64_t SnapshotGeneration = 0;
+			bool bLoadedSnapshot = false;
+			bool bExportHasGeneration = false;
+			Modio::filesystem::path JournalFilePath {};
+			std::unique_ptr<Modio::Detail::File> JournalFile {};
+			Modio::Detail::DynamicBuffer JournalBuffer {};
 		};
 
 		template<typename LoadModCollectionCallback>
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioErrorCode.h"
+#include "modio/core/ModioServices.h"
+#include "modio/detail/AsioWrapper.h"
+#include "modio/detail/Function2Wrapper.h"
+#include "modio/detail/ModioComputePool.h"
+#include "modio/detail/ModioProfiling.h"
+
+#include <asio/yield.hpp>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @brief Runs a piece of CPU-bound work on the compute pool and resumes the caller on the global io_context
+		/// once it is done. Without a compute pool the work is run inline, but the caller is still resumed through the
+		/// io_context
+		class RunOnComputePoolOp
+		{
+			fu2::unique_function<void()> Work;
+			ModioAsio::thread_pool* Pool = nullptr;
+			// Captured up front, so the caller resumes on the io_context it was started on even if ShutdownAsync has
+			// replaced the global one in the meantime
+			ModioAsio::io_context::executor_type CallerExecutor;
+
+			ModioAsio::coroutine CoroutineState {};
+
+		public:
+			RunOnComputePoolOp(fu2::unique_function<void()> Work)
+				: Work(std::move(Work)),
+				  Pool(Modio::Detail::ComputePool::Get()),
+				  CallerExecutor(Modio::Detail::Services::GetGlobalContext().get_executor())
+			{}
+
+			template<typename CoroType>
+			void operator()(CoroType& Self, Modio::ErrorCode MODIO_UNUSED_ARGUMENT(ec) = {})
+			{
+				reenter(CoroutineState)
+				{
+					if (Pool != nullptr)
+					{
+						// Bound as well as posted to the pool, as the op is otherwise dispatched back to the caller's
+						// executor once the pool runs it, and the work would run on the io_context after all
+						yield ModioAsio::post(Pool->get_executor(),
+											  ModioAsio::bind_executor(Pool->get_executor(), std::move(Self)));
+					}
+
+					{
+						MODIO_PROFILE_SCOPE(ComputePoolWork);
+						Work();
+					}
+
+					// Posted even when the work ran inline, so the caller is never resumed from within its own call to
+					// RunOnComputePoolAsync. Callers looping over chunks would otherwise recurse once per chunk
+					yield ModioAsio::post(CallerExecutor, std::move(Self));
+
+					Self.complete({});
+					return;
+				}
+			}
+		};
+
+		/// @brief Runs Work on the compute pool. Work must only touch the data it owns or shares with the caller, and
+		/// the caller must not touch that data until the operation completes
+		template<typename CompletionTokenType>
+		auto RunOnComputePoolAsync(fu2::unique_function<void()> Work, CompletionTokenType&& Token)
+		{
+			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
+				RunOnComputePoolOp(std::move(Work)), Token, Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
+	} // namespace Detail
+} // namespace Modio
+
+#include <asio/unyield.hpp>
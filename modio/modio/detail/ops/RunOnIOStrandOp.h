@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioErrorCode.h"
+#include "modio/core/ModioServices.h"
+#include "modio/detail/AsioWrapper.h"
+#include "modio/detail/Function2Wrapper.h"
+#include "modio/detail/ModioIOThreadPool.h"
+#include <tuple>
+
+#include <asio/yield.hpp>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @brief Starts a platform operation of an HTTP request or file on that object's strand of the I/O thread
+		/// pool, and resumes the caller on the io_context it was started on with the platform operation's results
+		template<typename... ResultTypes>
+		class RunOnIOStrandOp
+		{
+		public:
+			/// @brief Handler the platform operation is started with. Bound to the strand, so the operation's
+			/// intermediate steps are run there as well
+			using HandlerType =
+				ModioAsio::executor_binder<fu2::unique_function<void(Modio::ErrorCode, ResultTypes...)>, IOStrand>;
+			using InitiationType = fu2::unique_function<void(HandlerType)>;
+
+		private:
+			InitiationType Initiation;
+			IOStrand Strand;
+			// Captured up front, so the caller resumes on the io_context it was started on even if ShutdownAsync has
+			// replaced the global one in the meantime
+			ModioAsio::io_context::executor_type CallerExecutor;
+			std::tuple<Modio::ErrorCode, ResultTypes...> Results {};
+
+			ModioAsio::coroutine CoroutineState {};
+
+		public:
+			RunOnIOStrandOp(IOStrand Strand, InitiationType Initiation)
+				: Initiation(std::move(Initiation)),
+				  Strand(std::move(Strand)),
+				  CallerExecutor(Modio::Detail::Services::GetGlobalContext().get_executor())
+			{
+				Modio::Detail::IOThreadPool::BeginOperation();
+			}
+
+			RunOnIOStrandOp(RunOnIOStrandOp&& Other) = default;
+
+			template<typename CoroType>
+			void operator()(CoroType& Self, Modio::ErrorCode ec, ResultTypes... InResults)
+			{
+				Results = std::make_tuple(ec, std::move(InResults)...);
+				(*this)(Self);
+			}
+
+			template<typename CoroType>
+			void operator()(CoroType& Self)
+			{
+				reenter(CoroutineState)
+				{
+					// Bound as well as posted to the strand, as the op is otherwise dispatched back to the caller's
+					// executor once the strand runs it. The strand and initiation are copied or moved out first, as
+					// moving Self into the handler takes this op along with it
+					yield
+					{
+						IOStrand OperationStrand = Strand;
+						ModioAsio::post(OperationStrand, ModioAsio::bind_executor(OperationStrand, std::move(Self)));
+					}
+
+					yield
+					{
+						InitiationType StartOperation = std::move(Initiation);
+						IOStrand OperationStrand = Strand;
+						StartOperation(ModioAsio::bind_executor(
+							OperationStrand,
+							fu2::unique_function<void(Modio::ErrorCode, ResultTypes...)>(std::move(Self))));
+					}
+
+					yield ModioAsio::post(CallerExecutor, std::move(Self));
+
+					Modio::Detail::IOThreadPool::EndOperation();
+					std::apply([&Self](auto&&... Args) { Self.complete(std::move(Args)...); }, std::move(Results));
+					return;
+				}
+			}
+		};
+
+		/// @brief Calls Initiation on Strand with a handler bound to it. Initiation starts a platform operation of the
+		/// HTTP request or file that owns Strand, and must only capture that object's service and implementation
+		/// (never the object itself, which may be moved while the operation is in flight). Specify the results the
+		/// platform operation completes with after its error code as ResultTypes
+		template<typename... ResultTypes, typename CompletionTokenType>
+		auto RunOnIOStrandAsync(IOStrand Strand, typename RunOnIOStrandOp<ResultTypes...>::InitiationType Initiation,
+								CompletionTokenType&& Token)
+		{
+			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode, ResultTypes...)>(
+				RunOnIOStrandOp<ResultTypes...>(std::move(Strand), std::move(Initiation)), Token,
+				Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
+	} // namespace Detail
+} // namespace Modio
+
+#include <asio/unyield.hpp>
@@ -13,6 +13,8 @@
 #include "modio/detail/ModioObjectTrack.h"
 #include "modio/file/ModioFile.h"
 #include "modio/file/ModioFileService.h"
+#include "modio/detail/ModioBinarySnapshot.h"
+#include "modio/detail/ModioModCollectionJournal.h"
 #include "modio/detail/ModioSDKSessionData.h"
 #include "modio/detail/serialization/ModioModCollectionSerialization.h"
 
@@ -21,39 +23,139 @@ namespace Modio
 {
 	namespace Detail
 	{
+		/// @brief Saves the changes made to the system mod collection. Normally only the entries that changed since
+		/// the last save are appended to state.journal; once the journal is due for compaction, the whole collection
+		/// is written to the state.bin snapshot instead and the journal is restarted. Every
+		/// ModCollectionExportInterval compactions the collection is also exported to state.json, which is only read
+		/// if state.bin is damaged
 		class SaveModCollectionToStorage : public Modio::Detail::BaseOperation<SaveModCollectionToStorage>
 		{
 		public:
+			SaveModCollectionToStorage()
+				: WriteTicket(
+					  Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().GetMetadataWriteTicket())
+			{}
+
 			template<typename CoroType>
 			void operator()(CoroType& Self, Modio::ErrorCode ec = {})
 			{
 				reenter(CoroutineState)
 				{
+					// Saves run one at a time, so a compaction never overwrites the journal while records are being
+					// appended to it
+					yield WriteTicket.WaitForTurnAsync(std::move(Self));
+					if (ec || WriteTicket.WasCancelled())
+					{
+						Self.complete(ec ? ec : Modio::make_error_code(Modio::GenericError::OperationCanceled));
+						return;
+					}
+
+					JournalFilePath =
+						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().LocalMetadataFolder() /
+						"state.journal";
+					ExportFilePath =
+						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().LocalMetadataFolder() /
+						"state.json";
+					bExportMissing =
+						!Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(
+							ExportFilePath);
+
 					{
 						MODIO_PROFILE_SCOPE(SerializeModCollection);
-						nlohmann::json ModCollectionData = []() {
-							auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
-							return nlohmann::json::object({Modio::Detail::SDKSessionData::GetSystemModCollection()});
-						}();
+						// Capturing the changes considers the entries saved, so nothing else may touch them meanwhile
+						auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
+						Modio::Detail::ModCollectionJournal& Journal =
+							Modio::Detail::SDKSessionData::GetModCollectionJournal();
+						const Modio::ModCollection& Collection =
+							Modio::Detail::SDKSessionData::GetSystemModCollection();
 
-						ModCollectionData["version"] = 1;
-						auto teststring = ModCollectionData.dump();
+						bCompacting = Journal.NeedsCompaction();
+						if (bCompacting)
+						{
+							std::uint64_t Generation = Journal.BeginCompaction(Collection);
+							if (bExportMissing ||
+								Generation % Modio::Detail::Constants::Configuration::ModCollectionExportInterval == 0)
+							{
+								// state.json records the generation too, so the journal can still be replayed onto it
+								// if state.bin is damaged before the next compaction
+								nlohmann::json StateJson = nlohmann::json::object({Collection});
+								StateJson[Modio::Detail::Constants::JSONKeys::ModCollectionGeneration] = Generation;
+								std::string StateString = StateJson.dump();
+								ExportBuffer = std::make_unique<Modio::Detail::Buffer>(StateString.size(), 1024 * 4);
+								std::copy(StateString.begin(), StateString.end(), ExportBuffer->begin());
+							}
 
-						DestinationFilePath = Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
-												  .LocalMetadataFolder() /
-											  "state.json";
+							DataBuffer = std::make_unique<Modio::Detail::Buffer>(
+								Modio::Detail::EncodeModCollectionSnapshot(Collection, Generation));
+						}
+						else
+						{
+							JournalOffset = Journal.GetSize();
+							DataBuffer = std::make_unique<Modio::Detail::Buffer>(Journal.CaptureChanges(Collection));
+						}
+					}
+
+					if (!bCompacting)
+					{
+						if (DataBuffer->GetSize() == 0)
+						{
+							Self.complete({});
+							return;
+						}
+
+						JournalFile = std::make_unique<Modio::Detail::File>(JournalFilePath,
+																			Modio::Detail::FileMode::ReadWrite, false);
+						yield JournalFile->WriteSomeAtAsync(JournalOffset, std::move(*DataBuffer), std::move(Self));
+						if (ec)
+						{
+							// The records that were captured may be partially on disk, so start from a full snapshot
+							// next time
+							Modio::Detail::SDKSessionData::GetModCollectionJournal().MarkCompactionRequired();
+							Self.complete(ec);
+							return;
+						}
+
+						Self.complete({});
+						return;
+					}
 
-						// Make temporary file with new state data
+					if (ExportBuffer)
+					{
 						TempFilePath = Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
 										   .LocalMetadataFolder() /
 									   "state.json.tmp";
 						TempFile = std::make_unique<Modio::Detail::File>(TempFilePath,
 																		 Modio::Detail::FileMode::ReadWrite, true);
-						DataBuffer = std::make_unique<Modio::Detail::Buffer>(teststring.size(), 1024 * 4);
-						std::copy(teststring.begin(), teststring.end(), DataBuffer->begin());
+
+						// Write the exported collection to state.json.tmp
+						yield TempFile->WriteAsync(std::move(*ExportBuffer), std::move(Self));
+						if (ec)
+						{
+							Self.complete(ec);
+							return;
+						}
+						TempFile.reset();
+
+						if (!Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
+								 .MoveAndOverwriteFile(TempFilePath, ExportFilePath))
+						{
+							Self.complete(Modio::make_error_code(Modio::FilesystemError::WriteError));
+							return;
+						}
 					}
 
-					// Write new state data to state.json.tmp
+					DestinationFilePath = Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
+											  .LocalMetadataFolder() /
+										  "state.bin";
+
+					// Make temporary file with new state data
+					TempFilePath = Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>()
+									   .LocalMetadataFolder() /
+								   "state.bin.tmp";
+					TempFile =
+						std::make_unique<Modio::Detail::File>(TempFilePath, Modio::Detail::FileMode::ReadWrite, true);
+
+					// Write new state data to state.bin.tmp
 					yield TempFile->WriteAsync(std::move(*DataBuffer), std::move(Self));
 					if (ec)
 					{
@@ -64,27 +166,48 @@ namespace Modio
 					// Close file to perform MoveAndOverwriteFile()
 					TempFile.reset();
 
-					// Updates state.json with the contents of state.json.tmp, and deletes state.json.tmp
-					if (Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().MoveAndOverwriteFile(
+					// Updates state.bin with the contents of state.bin.tmp, and deletes state.bin.tmp
+					if (!Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().MoveAndOverwriteFile(
 							TempFilePath, DestinationFilePath))
 					{
-						Self.complete({});
+						Self.complete(Modio::make_error_code(Modio::FilesystemError::WriteError));
 						return;
 					}
-					else
+
+					// Any journal left on disk belongs to the previous generation, so it is ignored from here on even
+					// if restarting it fails
+					JournalFile =
+						std::make_unique<Modio::Detail::File>(JournalFilePath, Modio::Detail::FileMode::ReadWrite, true);
+					yield JournalFile->WriteAsync(Modio::Detail::SDKSessionData::GetModCollectionJournal().MakeHeader(),
+												  std::move(Self));
+					if (ec)
 					{
-						Self.complete(Modio::make_error_code(Modio::FilesystemError::WriteError));
+						Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::ModManagement,
+													"Could not restart the mod collection journal: {}", ec.message());
+						Self.complete({});
 						return;
 					}
+
+					Modio::Detail::SDKSessionData::GetModCollectionJournal().CompleteCompaction();
+					Self.complete({});
+					return;
 				}
 			}
 
 		private:
 			ModioAsio::coroutine CoroutineState {};
+			Modio::Detail::OperationQueue::Ticket WriteTicket;
+			bool bCompacting = false;
+			bool bExportMissing = false;
+			std::uint64_t JournalOffset = 0;
 			Modio::filesystem::path DestinationFilePath {};
 			Modio::filesystem::path TempFilePath {};
+			Modio::filesystem::path JournalFilePath {};
+			Modio::filesystem::path ExportFilePath {};
 			std::unique_ptr<Modio::Detail::File> TempFile {};
+			std::unique_ptr<Modio::Detail::File> JournalFile {};
 			std::unique_ptr<Modio::Detail::Buffer> DataBuffer {};
+			std::unique_ptr<Modio::Detail::Buffer> ExportBuffer {};
 		};
 
 		template<typename SaveModCollectionCallback>
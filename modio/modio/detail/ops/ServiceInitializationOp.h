@@ -30,6 +30,10 @@
 #endif
 
 #include "modio/core/ModioMetricsService.h"
+#include "modio/detail/ModioComputePool.h"
+#include "modio/detail/ModioIOThreadPool.h"
+
+#include <algorithm>
 
 #include <asio/yield.hpp>
 
@@ -71,6 +75,12 @@ public:
 		Modio::Optional<std::string> MetricsSecretKey = GetExtendedParameterValue(InitParams, "MetricsSecretKey");
 		Modio::Optional<std::string> ModStorageQuotaMB = GetExtendedParameterValue(InitParams, "ModStorageQuotaMB");
 		Modio::Optional<std::string> CacheStorageQuotaMB = GetExtendedParameterValue(InitParams, "CacheStorageQuotaMB");
+		Modio::Optional<std::string> MultipartUploadConcurrency =
+			GetExtendedParameterValue(InitParams, "MultipartUploadConcurrency");
+		Modio::Optional<std::string> PipelinedModfileUpload =
+			GetExtendedParameterValue(InitParams, "PipelinedModfileUpload");
+		Modio::Optional<std::string> ComputeThreads = GetExtendedParameterValue(InitParams, "ComputeThreads");
+		Modio::Optional<std::string> IOThreads = GetExtendedParameterValue(InitParams, "IOThreads");
 
 		reenter(CoroutineState)
 		{
@@ -103,6 +113,75 @@ public:
 				Modio::Detail::SDKSessionData::SetPlatformStatusFilter(*PendingOnlyResults);
 			}
 
+			if (MultipartUploadConcurrency.has_value())
+			{
+				// ensure numeric input
+				bool bIsNumeric = !MultipartUploadConcurrency->empty() &&
+								  std::all_of(MultipartUploadConcurrency->begin(), MultipartUploadConcurrency->end(),
+											  [](char c) { return std::isdigit(c); });
+				std::uint32_t Concurrency =
+					bIsNumeric && MultipartUploadConcurrency->size() < 3
+						? static_cast<std::uint32_t>(std::stoul(MultipartUploadConcurrency.value()))
+						: 0;
+				if (Concurrency < 1 ||
+					Concurrency > Modio::Detail::Constants::Configuration::MaxMultipartUploadConcurrency)
+				{
+					Modio::Detail::SDKSessionData::Deinitialize();
+					Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Core,
+												"Extended parameter MultipartUploadConcurrency must be an integer "
+												"between 1 and {}",
+												Modio::Detail::Constants::Configuration::MaxMultipartUploadConcurrency);
+					Self.complete(Modio::make_error_code(Modio::GenericError::BadParameter));
+					return;
+				}
+				Modio::Detail::SDKSessionData::SetMultipartUploadConcurrency(Concurrency);
+			}
+
+			if (PipelinedModfileUpload.has_value())
+			{
+				Modio::Detail::SDKSessionData::SetPipelinedModfileUpload(*PipelinedModfileUpload == "true");
+			}
+
+			if (ComputeThreads.has_value())
+			{
+				// ensure numeric input
+				bool bIsNumeric = !ComputeThreads->empty() &&
+								  std::all_of(ComputeThreads->begin(), ComputeThreads->end(),
+											  [](char c) { return std::isdigit(c); });
+				if (!bIsNumeric || ComputeThreads->size() > 2 ||
+					std::stoul(ComputeThreads.value()) > Modio::Detail::Constants::Configuration::MaxComputeThreads)
+				{
+					Modio::Detail::SDKSessionData::Deinitialize();
+					Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Core,
+												"Extended parameter ComputeThreads must be an integer between 0 and {}",
+												Modio::Detail::Constants::Configuration::MaxComputeThreads);
+					Self.complete(Modio::make_error_code(Modio::GenericError::BadParameter));
+					return;
+				}
+			}
+
+			if (IOThreads.has_value())
+			{
+				// ensure numeric input
+				bool bIsNumeric = !IOThreads->empty() &&
+								  std::all_of(IOThreads->begin(), IOThreads->end(),
+											  [](char c) { return std::isdigit(c); });
+				if (!bIsNumeric || IOThreads->size() > 2 ||
+					std::stoul(IOThreads.value()) > Modio::Detail::Constants::Configuration::MaxIOThreads)
+				{
+					Modio::Detail::SDKSessionData::Deinitialize();
+					Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Core,
+												"Extended parameter IOThreads must be an integer between 0 and {}",
+												Modio::Detail::Constants::Configuration::MaxIOThreads);
+					Self.complete(Modio::make_error_code(Modio::GenericError::BadParameter));
+					return;
+				}
+#ifndef MODIO_PLATFORM_IO_THREADS
+				Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::Core,
+											"Extended parameter IOThreads is not supported on this platform");
+#endif
+			}
+
 			Modio::Detail::ExtendedInitParamHandler::PostSessionDataInit(InitParams);
 
 			Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::Core,
@@ -284,6 +363,12 @@ public:
 			// just to be on the safe side
 			yield Modio::Detail::LoadModCollectionFromStorageAsync(std::move(Self));
 
+			// Started once nothing past this point can fail, so a failed initialization does not leave it running
+			Modio::Detail::ComputePool::Start(
+				ComputeThreads.has_value() ? static_cast<std::uint32_t>(std::stoul(ComputeThreads.value())) : 0);
+			Modio::Detail::IOThreadPool::Start(
+				IOThreads.has_value() ? static_cast<std::uint32_t>(std::stoul(IOThreads.value())) : 0);
+
 			// Validates all user's mods marked as ModState::Installed.  Any mods that fail validation will have
 			// ModState set to InstallationPending.  Will NOT return an error code even on validation failure to prevent
 			// killing initialization.
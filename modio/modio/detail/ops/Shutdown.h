@@ -12,6 +12,7 @@
 
 #include "modio/detail/AsioWrapper.h"
 #include "modio/core/ModioStdTypes.h"
+#include "modio/detail/ModioIOThreadPool.h"
 
 #include <asio/yield.hpp>
 namespace Modio
@@ -57,12 +58,15 @@ namespace Modio
 			{
 				reenter(CoroutineState)
 				{
-					while (ContextToFlush->poll_one())
+					// Operations still running on the I/O thread pool hand their results back to this context, so keep
+					// polling until they have, even if it has nothing ready to run in the meantime
+					while (ContextToFlush->poll_one() || Modio::Detail::IOThreadPool::HasPendingOperations())
 					{
 						yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
 						// If we use the op, then we get stack overflow if the shutdown takes a long time
 						// yield ShutdownRunOneAsync(ContextToFlush, std::move(Self));
 					}
+					Modio::Detail::IOThreadPool::Stop();
 					Self.complete(Modio::ErrorCode {});
 				}
 			}
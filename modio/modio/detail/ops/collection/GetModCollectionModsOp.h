@@ -50,7 +50,7 @@ namespace Modio
 					{
 						// Got the response OK, try to marshal to the expected type
 						Modio::Optional<Modio::ModInfoList> List =
-							TryMarshalResponse<Modio::ModInfoList>(ResponseBodyBuffer);
+							TryMarshalListResponse<Modio::ModInfoList>(ResponseBodyBuffer);
 						// Marshalled OK
 						if (List.has_value())
 						{
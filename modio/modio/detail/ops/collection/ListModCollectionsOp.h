@@ -56,7 +56,7 @@ namespace Modio
 					{
 						// Got the response OK, try to marshal to the expected type
 						Modio::Optional<Modio::ModCollectionInfoList> List =
-							TryMarshalResponse<Modio::ModCollectionInfoList>(ResponseBodyBuffer);
+							TryMarshalListResponse<Modio::ModCollectionInfoList>(ResponseBodyBuffer);
 						// Marshalled OK
 						if (List.has_value())
 						{
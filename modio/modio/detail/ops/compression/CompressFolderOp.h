@@ -11,6 +11,7 @@
 #pragma once
 
 #include "modio/compression/ModioArchiveWriter.h"
+#include "modio/detail/compression/zip/ArchivePartSpool.h"
 #include "modio/core/ModioErrorCode.h"
 #include "modio/core/ModioModCollectionEntry.h"
 #include "modio/core/ModioServices.h"
@@ -19,7 +20,6 @@
 #include "modio/detail/HedleyWrapper.h"
 #include "modio/file/ModioFile.h"
 #include "modio/file/ModioFileService.h"
-#include "modio/detail/ModioStringHash.h"
 #include "modio/detail/ModioSDKSessionData.h"
 
 MODIO_DIAGNOSTIC_PUSH
@@ -35,8 +35,9 @@ namespace Modio
 		{
 		public:
 			CompressFolderOp(Modio::filesystem::path SourceDirectoryRootPath,
-							 Modio::filesystem::path DestinationArchivePath, std::shared_ptr<uint64_t> FileHash,
-							 std::weak_ptr<Modio::ModProgressInfo> ProgressInfo)
+							 Modio::filesystem::path DestinationArchivePath, std::shared_ptr<std::string> FileHash,
+							 std::weak_ptr<Modio::ModProgressInfo> ProgressInfo,
+							 std::shared_ptr<Modio::Detail::ArchivePartSpool> OutputSpool = nullptr)
 				: SourceDirectoryRootPath(SourceDirectoryRootPath),
 				  ProgressInfo(ProgressInfo)
 			{
@@ -49,9 +50,13 @@ namespace Modio
 				}
 
 				DestinationArchive = std::make_unique<Modio::Detail::ArchiveWriter>(DestinationArchivePath);
+				if (OutputSpool)
+				{
+					DestinationArchive->SetOutputSpool(OutputSpool);
+				}
 
-				// A variable that stores a file hash and is accesible by callers of this operation
-				RollingFileHash = FileHash;
+				// Receives the MD5 of the finished archive, so it is accessible by callers of this operation
+				ArchiveHash = FileHash;
 			}
 
 			template<typename CoroType>
@@ -131,9 +136,8 @@ namespace Modio
 
 						if (Modio::filesystem::is_regular_file(CurrentEntry->path(), ec))
 						{
-							yield DestinationArchive->AddFileEntryToArchiveAsync(CurrentEntry->path(),
-																				 CurrentRelativePath, RollingFileHash,
-																				 ProgressInfo, std::move(Self));
+							yield DestinationArchive->AddFileEntryToArchiveAsync(
+								CurrentEntry->path(), CurrentRelativePath, ProgressInfo, std::move(Self));
 
 							if (ec)
 							{
@@ -148,9 +152,6 @@ namespace Modio
 						{
 							yield DestinationArchive->AddDirectoryEntryToArchiveAsync(CurrentRelativePath / "",
 																					  std::move(Self));
-							// Directories only consider the name in the file hash
-							*RollingFileHash = *RollingFileHash ^
-											   Modio::Detail::hash_64_fnv1a_const(CurrentRelativePath.string().c_str());
 
 							if (ec)
 							{
@@ -168,6 +169,11 @@ namespace Modio
 
 					yield DestinationArchive->FinalizeArchiveAsync(std::move(Self));
 
+					if (!ec && ArchiveHash)
+					{
+						*ArchiveHash = DestinationArchive->GetArchiveMD5();
+					}
+
 					CompleteProgressState(*PinnedProgressInfo.get(),
 										  Modio::ModProgressInfo::EModProgressState::Compressing);
 					Self.complete(ec);
@@ -184,19 +190,33 @@ namespace Modio
 			Modio::filesystem::path CurrentRelativePath {};
 			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo {};
 			Modio::FileSize CurrentTotalFileSize {};
-			std::shared_ptr<uint64_t> RollingFileHash {};
+			std::shared_ptr<std::string> ArchiveHash {};
 		};
 #include <asio/unyield.hpp>
 
 		template<typename CompletionHandlerType>
 		auto CompressFolderAsync(Modio::filesystem::path FolderToCompress, Modio::filesystem::path PathToOutputArchive,
-								 std::shared_ptr<uint64_t> FileHash, std::weak_ptr<Modio::ModProgressInfo> ProgressInfo,
-								 CompletionHandlerType&& Handler)
+								 std::shared_ptr<std::string> FileHash,
+								 std::weak_ptr<Modio::ModProgressInfo> ProgressInfo, CompletionHandlerType&& Handler)
 		{
 			return ModioAsio::async_compose<CompletionHandlerType, void(Modio::ErrorCode)>(
 				CompressFolderOp(FolderToCompress, PathToOutputArchive, FileHash, ProgressInfo), Handler,
 				Modio::Detail::Services::GetGlobalContext().get_executor());
 		}
+
+		/// @brief Compresses a folder into a spool of fixed-size part files rather than a single archive file, so the
+		/// parts can be consumed while later files are still being compressed
+		template<typename CompletionHandlerType>
+		auto CompressFolderToSpoolAsync(Modio::filesystem::path FolderToCompress,
+										std::shared_ptr<Modio::Detail::ArchivePartSpool> OutputSpool,
+										std::shared_ptr<std::string> FileHash,
+										std::weak_ptr<Modio::ModProgressInfo> ProgressInfo,
+										CompletionHandlerType&& Handler)
+		{
+			return ModioAsio::async_compose<CompletionHandlerType, void(Modio::ErrorCode)>(
+				CompressFolderOp(FolderToCompress, Modio::filesystem::path(), FileHash, ProgressInfo, OutputSpool),
+				Handler, Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
 	} // namespace Detail
 } // namespace Modio
 
@@ -15,6 +15,7 @@
 #include "modio/core/ModioServices.h"
 #include "modio/detail/AsioWrapper.h"
 #include "modio/detail/HedleyWrapper.h"
+#include "modio/detail/ModioBufferPool.h"
 #include "modio/detail/ModioProfiling.h"
 #include "modio/file/ModioFileService.h"
 #include "file/ArchiveUtilities.h"
@@ -62,12 +63,8 @@ namespace Modio
 								 Modio::Optional<Modio::ModID> ModId,
 								 Modio::Optional<std::weak_ptr<Modio::ModProgressInfo>> ProgressInfo)
 			{
-				Impl = std::make_shared<ExtractAllImpl>(ExtractAllImpl ({},
-																		ArchivePath,
-																		RootOutputPath,
-																		Modio::Detail::ArchiveReader(ArchivePath), 
-																	    ModId,
-																		ProgressInfo));
+				Impl = Modio::Detail::MakePooled<ExtractAllImpl>(ExtractAllImpl(
+					{}, ArchivePath, RootOutputPath, Modio::Detail::ArchiveReader(ArchivePath), ModId, ProgressInfo));
 			}
 
 			template<typename CoroType>
@@ -17,9 +17,11 @@
 #include "modio/detail/HedleyWrapper.h"
 #include "modio/detail/ModioObjectTrack.h"
 #include "modio/detail/ModioProfiling.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/compression/zip/ArchiveFileImplementation.h"
 #include "modio/detail/compression/zlib/inflate_stream.hpp"
 #include "modio/detail/compression/zlib/zlib.hpp"
+#include "modio/detail/ops/RunOnComputePoolOp.h"
 #include "modio/file/ModioFile.h"
 
 #include <asio/yield.hpp>
@@ -60,7 +62,7 @@ namespace Modio
 								  Modio::filesystem::path RootDirectoryToExtractTo,
 								  Modio::Optional<std::weak_ptr<Modio::ModProgressInfo>> ProgressInfo)
 			{
-				Impl = std::make_shared<ExtractEntryImpl>(ExtractEntryImpl {
+				Impl = Modio::Detail::MakePooled<ExtractEntryImpl>(ExtractEntryImpl {
 					Modio::Detail::File(ArchiveFileImpl->FilePath, Modio::Detail::FileMode::ReadOnly, false),
 					ArchiveFileImpl, EntryToExtract, RootDirectoryToExtractTo, Modio::Detail::DynamicBuffer {}, 0u,
 					Modio::Detail::File(RootDirectoryToExtractTo / EntryToExtract.FilePath,
@@ -83,14 +85,13 @@ namespace Modio
 
 				reenter(CoroutineState)
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Detailed, Modio::LogCategory::Compression,
-												"Extracting file {}",
-												Modio::ToModioString(Impl->EntryToExtract.FilePath.u8string()));
+					MODIO_LOG(Modio::LogLevel::Detailed, Modio::LogCategory::Compression, "Extracting file {}",
+								Modio::ToModioString(Impl->EntryToExtract.FilePath.u8string()));
 
 					if (Impl->EntryToExtract.UncompressedSize == 0)
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Compression,
-													"Zero length file in archive extracted successfully");
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Compression,
+									"Zero length file in archive extracted successfully");
 
 						// Close File Handle
 						Impl.reset();
@@ -142,12 +143,19 @@ namespace Modio
 							Impl->ZState.avail_out = Impl->DecompressedData->GetSize();
 							Impl->ZState.total_out = 0;
 
-							Impl->ZStream.write(Impl->ZState, Modio::Detail::Zlib::Flush::none, Impl->DeflateStatus);
+							// Inflating is the expensive part of extraction, so it is done on the compute pool
+							yield Modio::Detail::RunOnComputePoolAsync(
+								[State = Impl]() {
+									State->ZStream.write(State->ZState, Modio::Detail::Zlib::Flush::none,
+														 State->DeflateStatus);
+								},
+								std::move(Self));
 							if (!Impl->DeflateStatus || Impl->DeflateStatus == Modio::ZlibError::EndOfStream)
 							{
 								// Copy the required range out of the pre-allocated buffer
 								yield Impl->DestinationFile.WriteAsync(
 									Impl->DecompressedData->CopyRange(0, Impl->ZState.total_out), std::move(Self));
+								Modio::Detail::RuntimeStatsCollector::Get().RecordExtract(Impl->ZState.total_out);
 
 								// Update progress on how much data we have written to disc
 								if (Impl->ProgressInfo.has_value())
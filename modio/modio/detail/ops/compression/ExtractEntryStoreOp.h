@@ -16,6 +16,7 @@
 #include "modio/detail/AsioWrapper.h"
 #include "modio/detail/HedleyWrapper.h"
 #include "modio/detail/ModioObjectTrack.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/compression/zip/ArchiveFileImplementation.h"
 #include "modio/detail/compression/zlib/inflate_stream.hpp"
 #include "modio/detail/compression/zlib/zlib.hpp"
@@ -55,7 +56,7 @@ namespace Modio
 								Modio::filesystem::path RootDirectoryToExtractTo,
 								Modio::Optional<std::weak_ptr<Modio::ModProgressInfo>> ProgressInfo)
 			{
-				Impl = std::make_shared<ExtractEntryImpl>(ExtractEntryImpl {
+				Impl = Modio::Detail::MakePooled<ExtractEntryImpl>(ExtractEntryImpl {
 					Modio::Detail::File(ArchiveFileImpl->FilePath, Modio::Detail::FileMode::ReadOnly, false),
 					ArchiveFileImpl, EntryToExtract, RootDirectoryToExtractTo, Modio::Detail::DynamicBuffer {}, 0u,
 					Modio::Detail::File(RootDirectoryToExtractTo / EntryToExtract.FilePath,
@@ -124,6 +125,7 @@ namespace Modio
 								return;
 							}
 						}
+						Modio::Detail::RuntimeStatsCollector::Get().RecordExtract(Impl->CurrentBufferSize);
 
 						// Update progress on how much data we have written to disc
 						if (Impl->ProgressInfo.has_value())
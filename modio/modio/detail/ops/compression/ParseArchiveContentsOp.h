@@ -12,6 +12,7 @@
 
 #include "modio/core/ModioCoreTypes.h"
 #include "modio/core/ModioStdTypes.h"
+#include "modio/detail/ModioBufferPool.h"
 #include "modio/detail/ModioProfiling.h"
 #include "modio/detail/compression/zip/ArchiveFileImplementation.h"
 #include "modio/detail/compression/zip/ZipStructures.h"
@@ -50,7 +51,7 @@ namespace Modio
 				reenter(CoroutineState)
 				{
 					{
-						ArchiveFileOnDisk = std::make_shared<Modio::Detail::File>(
+						ArchiveFileOnDisk = Modio::Detail::MakePooled<Modio::Detail::File>(
 							ArchiveState->FilePath, Modio::Detail::FileMode::ReadOnly, false);
 						FileSize = ArchiveFileOnDisk->GetFileSize();
 						CurrentSearchOffset = FileSize - std::min(FileSize, ChunkOfBytes);
@@ -17,6 +17,7 @@
 #include "modio/detail/FilesystemWrapper.h"
 #include "modio/detail/compression/zip/ArchiveFileImplementation.h"
 #include "modio/detail/compression/zip/ZipStructures.h"
+#include "modio/detail/ops/compression/zip/WriteToArchivePartSpoolOp.h"
 #include "modio/file/ModioFile.h"
 #include <algorithm>
 #include <memory>
@@ -38,8 +39,11 @@ namespace Modio
 				  LocalFileHeaderBuffer(Constants::ZipTag::LocalFileHeaderSize +
 										DirectoryPath.generic_u8string().size())
 			{
-				OutputFile = std::make_unique<Modio::Detail::File>(ArchiveFile->FilePath,
-																   Modio::Detail::FileMode::ReadWrite, false);
+				if (!ArchiveFile->OutputSpool)
+				{
+					OutputFile = std::make_unique<Modio::Detail::File>(ArchiveFile->FilePath,
+																	   Modio::Detail::FileMode::ReadWrite, false);
+				}
 				FileName = Modio::ToModioString(DirectoryPath.generic_u8string());
 			}
 
@@ -50,8 +54,15 @@ namespace Modio
 				{
 					// Determine the offset for this new entry
 					// The central directory requires this value to locate this entry
-					OutputFile->Seek(Modio::FileOffset(OutputFile->GetFileSize()));
-					LocalHeaderOffset = OutputFile->Tell();
+					if (ArchiveFile->OutputSpool)
+					{
+						LocalHeaderOffset = Modio::FileOffset(ArchiveFile->OutputSpool->GetBytesWritten());
+					}
+					else
+					{
+						OutputFile->Seek(Modio::FileOffset(OutputFile->GetFileSize()));
+						LocalHeaderOffset = OutputFile->Tell();
+					}
 
 					// Marshal fields of fixed sizes into our local file header's data buffer
 					// Header signature
@@ -83,7 +94,8 @@ namespace Modio
 							  LocalFileHeaderBuffer.Data() + Constants::ZipTag::LocalFileHeaderSize);
 
 					// Write out this local file header
-					yield OutputFile->WriteAsync(std::move(LocalFileHeaderBuffer), std::move(Self));
+					yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(),
+															  std::move(LocalFileHeaderBuffer), std::move(Self));
 					if (ec)
 					{
 						Self.complete(ec);
@@ -18,11 +18,15 @@
 #include "modio/detail/FilesystemWrapper.h"
 #include "modio/detail/HedleyWrapper.h"
 #include "modio/detail/ModioCRC.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/ModioStringHelpers.h"
 #include "modio/detail/compression/zip/ArchiveFileImplementation.h"
 #include "modio/detail/compression/zip/ZipStructures.h"
 #include "modio/detail/compression/zlib/deflate_stream.hpp"
+#include "modio/detail/ops/compression/zip/WriteToArchivePartSpoolOp.h"
 #include "modio/file/ModioFile.h"
 #include <algorithm>
+#include <array>
 #include <memory>
 
 MODIO_DIAGNOSTIC_PUSH
@@ -41,7 +45,7 @@ namespace Modio
 		public:
 			AddFileEntryOp(std::shared_ptr<Modio::Detail::ArchiveFileImplementation> ArchiveFile,
 						   Modio::filesystem::path SourceFilePath, Modio::filesystem::path PathInsideArchive,
-						   std::shared_ptr<uint64_t> FileHash, std::weak_ptr<Modio::ModProgressInfo> ProgressInfo)
+						   std::weak_ptr<Modio::ModProgressInfo> ProgressInfo)
 				: ArchiveFile(ArchiveFile),
 				  PathInsideArchive(PathInsideArchive),
 				  CompressedOutputBuffer(1),
@@ -49,13 +53,15 @@ namespace Modio
 			{
 				InputFile =
 					std::make_unique<Modio::Detail::File>(SourceFilePath, Modio::Detail::FileMode::ReadOnly, false);
-				OutputFile = std::make_unique<Modio::Detail::File>(ArchiveFile->FilePath,
-																   Modio::Detail::FileMode::ReadWrite, false);
+				if (!ArchiveFile->OutputSpool)
+				{
+					OutputFile = std::make_unique<Modio::Detail::File>(ArchiveFile->FilePath,
+																	   Modio::Detail::FileMode::ReadWrite, false);
+				}
 				CompressionStream = std::make_unique<Modio::Detail::Zlib::deflate_stream>();
 				FileName = Modio::ToModioString(PathInsideArchive.generic_u8string());
 				InputFileSize = InputFile->GetFileSize();
 				IsZip64 = InputFileSize >= (UINT32_MAX - 1);
-				RollingFileHash = FileHash;
 			}
 
 			template<typename CoroType>
@@ -75,9 +81,10 @@ namespace Modio
 					if (InputFile->GetPath().native().length() >=
 						Modio::Detail::Constants::Configuration::UniversalMaxPath)
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::File,
-							"File path `{}` contains more than {} characters, which is not supported",
-							InputFile->GetPath().string(), Modio::Detail::Constants::Configuration::UniversalMaxPath);
+						MODIO_LOG(Modio::LogLevel::Warning, Modio::LogCategory::File,
+								  "File path `{}` contains more than {} characters, which is not supported",
+								  InputFile->GetPath().string(),
+								  Modio::Detail::Constants::Configuration::UniversalMaxPath);
 						Self.complete(Modio::make_error_code(Modio::FilesystemError::PathTooLong));
 						return;
 					}
@@ -85,17 +92,24 @@ namespace Modio
 					// If a file name uses a double dot the operation will fail
 					if (InputFile->GetPath().filename().string().find("..") != std::string::npos)
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::File,
-													"File `{}` uses more than one dot in its name, which is forbidden",
-													InputFile->GetPath().filename().string());
+						MODIO_LOG(Modio::LogLevel::Warning, Modio::LogCategory::File,
+								  "File `{}` uses more than one dot in its name, which is forbidden",
+								  InputFile->GetPath().filename().string());
 						Self.complete(Modio::make_error_code(Modio::FilesystemError::ReadError));
 						return;
 					}
 
 					// Determine the start of this local file entry in the archive
 					// This value will be used to locate this entry as needed
-					OutputFile->Seek(Modio::FileOffset(OutputFile->GetFileSize()));
-					LocalHeaderOffset = OutputFile->Tell();
+					if (ArchiveFile->OutputSpool)
+					{
+						LocalHeaderOffset = Modio::FileOffset(ArchiveFile->OutputSpool->GetBytesWritten());
+					}
+					else
+					{
+						OutputFile->Seek(Modio::FileOffset(OutputFile->GetFileSize()));
+						LocalHeaderOffset = OutputFile->Tell();
+					}
 
 					if (IsZip64)
 					{
@@ -110,201 +124,231 @@ namespace Modio
 						LocalHeaderSize = Constants::ZipTag::LocalFileHeaderSize + FileName.size();
 					}
 
-					// Determine the offset for the file data, located immediately after the header
-					OutputFile->Seek(Modio::FileOffset(LocalHeaderSize), SeekDirection::Forward);
-					FileDataOffset = OutputFile->Tell();
-
-					// Process and compress the file data
-					while (BytesProcessed < InputFileSize)
+					// In Automatic mode, decide whether deflating this entry is worthwhile before processing the file
+					// data. Files that are already compressed are written with Store, which avoids spending CPU on
+					// output that would be as large as (or larger than) the input
+					if (ArchiveFile->EntryCompression ==
+							ArchiveFileImplementation::EntryCompressionMode::Automatic &&
+						InputFileSize > 0)
 					{
-						// Set a property to the maximum bytes to read. If the file is smaller than "ChunkOfBytes",
-						// it is better to just read FileSize. It also applies to the last part of the file.
-						MaxBytesToRead = (BytesProcessed + ChunkOfBytes) < InputFileSize
-											 ? ChunkOfBytes
-											 : InputFileSize - BytesProcessed;
-						// Read in a chunk from the file we're compressing
-						yield InputFile->ReadAsync(MaxBytesToRead, InputFileBuffer, std::move(Self));
-						if (ec)
+						if (HasIncompressibleExtension(PathInsideArchive))
 						{
-							Self.complete(ec);
-							return;
+							EntryCompression = ArchiveFileImplementation::CompressionMethod::Store;
 						}
-
-						// Doing this in a loop in case ReadAsync stored multiple sub-buffers
-						while ((NextBuf = InputFileBuffer.TakeInternalBuffer()))
+						else
 						{
-							// Compress the current sub-buffer
-							CompressionState.avail_in = NextBuf->GetSize();
-							CompressionState.next_in = NextBuf->Data();
-							// A slightly larger CompressedOutputBuffer helps to avoid a case where avail_in
-							// does not process all input into the avail_out
-							CompressedOutputBuffer = Modio::Detail::Buffer(MaxBytesToRead + 100);
-							CompressionState.avail_out = CompressedOutputBuffer.GetSize();
-							CompressionState.next_out = CompressedOutputBuffer.Data();
-							CompressionStream->write(CompressionState, Modio::Detail::Zlib::Flush::none, ec);
-							if (ec && ec != Modio::ZlibError::EndOfStream)
+							// Sample the first block of the file
+							MaxBytesToRead = ChunkOfBytes < InputFileSize ? ChunkOfBytes : InputFileSize;
+							yield InputFile->ReadAsync(MaxBytesToRead, InputFileBuffer, std::move(Self));
+							if (ec)
 							{
 								Self.complete(ec);
 								return;
 							}
 
-							// As long as the no more "CompressionState.avail_in" bytes remain, calculate the rolling
-							// CRC
-							if (CompressionState.avail_in == 0)
+							if (!IsSampleCompressible(InputFileBuffer))
 							{
-								// Calculate rolling CRC for this sub-buffer
-								InputCRC = Modio::Detail::CRC32(NextBuf.value(), InputCRC);
+								EntryCompression = ArchiveFileImplementation::CompressionMethod::Store;
 							}
-							else
+
+							// Rewind so the selected method processes the file from the start
+							InputFileBuffer.Clear();
+							InputFile->Seek(Modio::FileOffset(0));
+						}
+
+						if (EntryCompression == ArchiveFileImplementation::CompressionMethod::Store)
+						{
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+									  "File {} is already compressed, adding it to the archive with Store", FileName);
+						}
+					}
+
+					// The archive is written in order, so the header precedes the data even though the CRC and sizes of
+					// the entry are not known yet
+					yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(), MakeLocalFileHeader(),
+															  std::move(Self));
+					if (ec)
+					{
+						Self.complete(ec);
+						return;
+					}
+
+					if (EntryCompression == ArchiveFileImplementation::CompressionMethod::Store)
+					{
+						// Copy the file data verbatim, calculating the CRC as it is read
+						while (BytesProcessed < InputFileSize)
+						{
+							MaxBytesToRead = (BytesProcessed + ChunkOfBytes) < InputFileSize
+												 ? ChunkOfBytes
+												 : InputFileSize - BytesProcessed;
+							yield InputFile->ReadAsync(MaxBytesToRead, InputFileBuffer, std::move(Self));
+							if (ec)
 							{
-								// In a very edge scenarios, CompressionState could have some "avail_in" bytes
-								// remaining, (despite a larger CompressedOutputBuffer). To make sure those bytes are
-								// compressed, a simple solution is outlined below:
-								// - Calculate the CRC of the bytes that were passed along
-								// - Move the "Seek" pointer of InputFile to the last successful bytes read
-								// - Clear the buffer to avoid any data mismatch
-
-								// In case of mismatch between BytesProcessed & total_in, only calculate
-								// the portion of NextBuf processed by the CompressionStream
-								InputCRC = Modio::Detail::CRC32(NextBuf.value(), InputCRC, CompressionState.avail_in);
-
-								// Then move the offset in the file to the last bytes read + 1, which is the section
-								InputFile->Seek(Modio::FileOffset(CompressionState.total_in));
-
-								// Make sure the InputFileBuffer is cleared so it does not try to "Take" a buffer
-								// in the next iteration
-								InputFileBuffer.Clear();
-
-								// Continue execution as normal, given that possibly avail_out could have something to
-								// process
+								Self.complete(ec);
+								return;
 							}
 
-							// Check if we've generated any output yet, ie we've consumed some of the output buffer
-							// so avail_out (free space in the output buffer) is now less than it was before
-							// This way we're only trying to write compressed data to our output file if there's some
-							// data to actually write
-							if (CompressionState.avail_out != CompressedOutputBuffer.GetSize())
+							while ((NextBuf = InputFileBuffer.TakeInternalBuffer()))
 							{
-								yield OutputFile->WriteAsync(
-									CompressedOutputBuffer.CopyRange(CompressedOutputBuffer.begin(),
-																	 CompressedOutputBuffer.begin() +
-																		 CompressedOutputBuffer.GetSize() -
-																		 CompressionState.avail_out),
-									std::move(Self));
+								InputCRC = Modio::Detail::CRC32(NextBuf.value(), InputCRC);
+								BytesProcessed += Modio::FileSize(NextBuf->GetSize());
 
+								yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(),
+																		  std::move(NextBuf.value()), std::move(Self));
 								if (ec)
 								{
 									Self.complete(ec);
 									return;
 								}
 							}
+
+							IncrementCurrentProgress(*PinnedProgressInfo.get(), Modio::FileSize(MaxBytesToRead));
 						}
 
-						// BytesProcessed is correctly assessed after CompressionStream has written
-						// all the bytes to the CompressionStream
-						BytesProcessed = Modio::FileSize(CompressionState.total_in);
-						// Update The ProgressInfo with MaxBytesToRead
-						IncrementCurrentProgress(*PinnedProgressInfo.get(), Modio::FileSize(MaxBytesToRead));
+						CompressedSize = BytesProcessed;
+						UncompressedSize = BytesProcessed;
 					}
-
-					// Finish the zlib stream for the current file
-					// Only with a File that has bytes in it
-					if (InputFileSize > 0)
+					else
 					{
-						// In case the CompressionState still has data available from the last iteration
-						// keep the last pointer alive. If not, then apply nullptr
-						if (CompressionState.avail_in == 0)
+						// Process and compress the file data
+						while (BytesProcessed < InputFileSize)
 						{
-							CompressionState.next_in = nullptr;
-						}
+							// Set a property to the maximum bytes to read. If the file is smaller than "ChunkOfBytes",
+							// it is better to just read FileSize. It also applies to the last part of the file.
+							MaxBytesToRead = (BytesProcessed + ChunkOfBytes) < InputFileSize
+												 ? ChunkOfBytes
+												 : InputFileSize - BytesProcessed;
+							// Read in a chunk from the file we're compressing
+							yield InputFile->ReadAsync(MaxBytesToRead, InputFileBuffer, std::move(Self));
+							if (ec)
+							{
+								Self.complete(ec);
+								return;
+							}
 
-						CompressedOutputBuffer = Modio::Detail::Buffer(ChunkOfBytes);
-						CompressionState.avail_out = CompressedOutputBuffer.GetSize();
-						CompressionState.next_out = CompressedOutputBuffer.Data();
-						CompressionStream->write(CompressionState, Modio::Detail::Zlib::Flush::finish, ec);
-						if (ec && ec != Modio::ZlibError::EndOfStream)
-						{
-							Self.complete(ec);
-							return;
+							// Doing this in a loop in case ReadAsync stored multiple sub-buffers
+							while ((NextBuf = InputFileBuffer.TakeInternalBuffer()))
+							{
+								// Compress the current sub-buffer
+								CompressionState.avail_in = NextBuf->GetSize();
+								CompressionState.next_in = NextBuf->Data();
+								// A slightly larger CompressedOutputBuffer helps to avoid a case where avail_in
+								// does not process all input into the avail_out
+								CompressedOutputBuffer = Modio::Detail::Buffer(MaxBytesToRead + 100);
+								CompressionState.avail_out = CompressedOutputBuffer.GetSize();
+								CompressionState.next_out = CompressedOutputBuffer.Data();
+								CompressionStream->write(CompressionState, Modio::Detail::Zlib::Flush::none, ec);
+								if (ec && ec != Modio::ZlibError::EndOfStream)
+								{
+									Self.complete(ec);
+									return;
+								}
+
+								// As long as the no more "CompressionState.avail_in" bytes remain, calculate the rolling
+								// CRC
+								if (CompressionState.avail_in == 0)
+								{
+									// Calculate rolling CRC for this sub-buffer
+									InputCRC = Modio::Detail::CRC32(NextBuf.value(), InputCRC);
+								}
+								else
+								{
+									// In a very edge scenarios, CompressionState could have some "avail_in" bytes
+									// remaining, (despite a larger CompressedOutputBuffer). To make sure those bytes are
+									// compressed, a simple solution is outlined below:
+									// - Calculate the CRC of the bytes that were passed along
+									// - Move the "Seek" pointer of InputFile to the last successful bytes read
+									// - Clear the buffer to avoid any data mismatch
+
+									// In case of mismatch between BytesProcessed & total_in, only calculate
+									// the portion of NextBuf processed by the CompressionStream
+									InputCRC = Modio::Detail::CRC32(NextBuf.value(), InputCRC, CompressionState.avail_in);
+
+									// Then move the offset in the file to the last bytes read + 1, which is the section
+									InputFile->Seek(Modio::FileOffset(CompressionState.total_in));
+
+									// Make sure the InputFileBuffer is cleared so it does not try to "Take" a buffer
+									// in the next iteration
+									InputFileBuffer.Clear();
+
+									// Continue execution as normal, given that possibly avail_out could have something to
+									// process
+								}
+
+								// Check if we've generated any output yet, ie we've consumed some of the output buffer
+								// so avail_out (free space in the output buffer) is now less than it was before
+								// This way we're only trying to write compressed data to our output file if there's some
+								// data to actually write
+								if (CompressionState.avail_out != CompressedOutputBuffer.GetSize())
+								{
+									yield Modio::Detail::AppendToArchiveAsync(
+										*ArchiveFile, OutputFile.get(),
+										CompressedOutputBuffer.CopyRange(CompressedOutputBuffer.begin(),
+																		 CompressedOutputBuffer.begin() +
+																			 CompressedOutputBuffer.GetSize() -
+																			 CompressionState.avail_out),
+										std::move(Self));
+
+									if (ec)
+									{
+										Self.complete(ec);
+										return;
+									}
+								}
+							}
+
+							// BytesProcessed is correctly assessed after CompressionStream has written
+							// all the bytes to the CompressionStream
+							BytesProcessed = Modio::FileSize(CompressionState.total_in);
+							// Update The ProgressInfo with MaxBytesToRead
+							IncrementCurrentProgress(*PinnedProgressInfo.get(), Modio::FileSize(MaxBytesToRead));
 						}
-						// Again, check that the last call to the zlib stream actually produced some data for us
-						if (CompressionState.avail_out != CompressedOutputBuffer.GetSize())
+
+						// Finish the zlib stream for the current file
+						// Only with a File that has bytes in it
+						if (InputFileSize > 0)
 						{
-							yield OutputFile->WriteAsync(
-								CompressedOutputBuffer.CopyRange(CompressedOutputBuffer.begin(),
-																 CompressedOutputBuffer.begin() +
-																	 CompressedOutputBuffer.GetSize() -
-																	 CompressionState.avail_out),
-								std::move(Self));
-							if (ec)
+							// In case the CompressionState still has data available from the last iteration
+							// keep the last pointer alive. If not, then apply nullptr
+							if (CompressionState.avail_in == 0)
+							{
+								CompressionState.next_in = nullptr;
+							}
+
+							CompressedOutputBuffer = Modio::Detail::Buffer(ChunkOfBytes);
+							CompressionState.avail_out = CompressedOutputBuffer.GetSize();
+							CompressionState.next_out = CompressedOutputBuffer.Data();
+							CompressionStream->write(CompressionState, Modio::Detail::Zlib::Flush::finish, ec);
+							if (ec && ec != Modio::ZlibError::EndOfStream)
 							{
 								Self.complete(ec);
 								return;
 							}
+							// Again, check that the last call to the zlib stream actually produced some data for us
+							if (CompressionState.avail_out != CompressedOutputBuffer.GetSize())
+							{
+								yield Modio::Detail::AppendToArchiveAsync(
+									*ArchiveFile, OutputFile.get(),
+									CompressedOutputBuffer.CopyRange(CompressedOutputBuffer.begin(),
+																	 CompressedOutputBuffer.begin() +
+																		 CompressedOutputBuffer.GetSize() -
+																		 CompressionState.avail_out),
+									std::move(Self));
+								if (ec)
+								{
+									Self.complete(ec);
+									return;
+								}
+							}
 						}
-					}
 
-					// Determine the end of this local file entry in the archive
-					EndOffset = OutputFile->Tell();
-
-					// Marshal fields of fixed sizes into our local file header's data buffer
-					LocalFileHeaderBuffer = std::make_unique<Modio::Detail::Buffer>(LocalHeaderSize);
-					// Header signature
-					Modio::Detail::TypedBufferWrite(Constants::ZipTag::LocalFileHeaderSignature, *LocalFileHeaderBuffer,
-													0)
-						// Minimum version to extract
-						.FollowedBy<uint16_t>(IsZip64 ? Constants::ZipTag::Zip64Version : Constants::ZipTag::ZipVersion)
-						// General Purpose bit-flag
-						.FollowedBy<uint16_t>(0)
-						// Compression Method
-						.FollowedBy<uint16_t>(Constants::ZipTag::Deflate)
-						// Last modified time
-						.FollowedBy<uint16_t>(0)
-						// Last modified date
-						.FollowedBy<uint16_t>(0)
-						// CRC-32 of uncompressed data
-						.FollowedBy<uint32_t>(InputCRC)
-						// Compressed size. Must be set to MAX32 if actual value is included in Zip64 Extended
-						// Information
-						.FollowedBy<uint32_t>(IsZip64 ? Constants::ZipTag::MAX32
-													  : std::uint32_t(CompressionState.total_out))
-						// Uncompressed size. Must be set to MAX32 if actual value is included in Zip64 Extended
-						// Information
-						.FollowedBy<uint32_t>(IsZip64 ? Constants::ZipTag::MAX32
-													  : std::uint32_t(CompressionState.total_in))
-						// File name length
-						.FollowedBy<uint16_t>(std::uint16_t(FileName.size()))
-						// Extra field length
-						.FollowedBy<uint16_t>(IsZip64 ? Constants::ZipTag::Zip64LocalFileExtraFieldSize : 0);
-
-					// Manually write (variable sized) file name
-					std::copy(FileName.begin(), FileName.end(),
-							  LocalFileHeaderBuffer->Data() + Constants::ZipTag::LocalFileHeaderSize);
-
-					// Include Zip64 Extended Information Extra Field if file size exceeds Zip32 limit
-					if (IsZip64)
-					{
-						Modio::Detail::Logger().Log(
-							Modio::LogLevel::Trace, Modio::LogCategory::File,
-							"Including Zip64 Extended Information Extra Field in the local directory for file {}",
-							FileName);
-
-						// Zip64 Extra Field Signature
-						Modio::Detail::TypedBufferWrite(Constants::ZipTag::Zip64ExtraFieldSignature,
-														*LocalFileHeaderBuffer,
-														Constants::ZipTag::LocalFileHeaderSize + FileName.size())
-							// Size of this extra block, excluding leading 4 bytes (signature and size fields)
-							.FollowedBy<uint16_t>(Constants::ZipTag::Zip64LocalFileExtraFieldSize - 4)
-							// Uncompressed size
-							.FollowedBy<uint64_t>(CompressionState.total_in)
-							// Compressed size
-							.FollowedBy<uint64_t>(CompressionState.total_out);
+						CompressedSize = CompressionState.total_out;
+						UncompressedSize = CompressionState.total_in;
 					}
 
-					// Write the local file header immediately before the compressed data
-					yield OutputFile->WriteSomeAtAsync(LocalHeaderOffset, std::move(*LocalFileHeaderBuffer),
-													   std::move(Self));
-
+					// The CRC and sizes are only known now, so they follow the data in a data descriptor
+					yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(), MakeDataDescriptor(),
+															  std::move(Self));
 					if (ec)
 					{
 						Self.complete(ec);
@@ -313,11 +357,8 @@ namespace Modio
 
 					// Add this entry to the archive file object
 					// These details will be written to the central directory
-					ArchiveFile->AddEntry(FileName, LocalHeaderOffset, CompressionState.total_out,
-										  CompressionState.total_in,
-										  ArchiveFileImplementation::CompressionMethod::Deflate, InputCRC);
-
-					*RollingFileHash = *RollingFileHash ^ InputCRC;
+					ArchiveFile->AddEntry(FileName, LocalHeaderOffset, CompressedSize, UncompressedSize, EntryCompression,
+										  InputCRC, false, true);
 
 					// Close file handles
 					InputFile.reset();
@@ -329,6 +370,138 @@ namespace Modio
 			}
 
 		private:
+			/// @brief Marshals the local file header for this entry. The entry is written before its CRC and sizes are
+			/// known, so those are left empty and flagged as following the data in a data descriptor
+			Modio::Detail::Buffer MakeLocalFileHeader() const
+			{
+				// Marshal fields of fixed sizes into our local file header's data buffer
+				Modio::Detail::Buffer LocalFileHeaderBuffer(LocalHeaderSize);
+				// Header signature
+				Modio::Detail::TypedBufferWrite(Constants::ZipTag::LocalFileHeaderSignature, LocalFileHeaderBuffer, 0)
+					// Minimum version to extract
+					.FollowedBy<uint16_t>(IsZip64 ? Constants::ZipTag::Zip64Version : Constants::ZipTag::ZipVersion)
+					// General Purpose bit-flag
+					.FollowedBy<uint16_t>(Constants::ZipTag::DataDescriptorFlag)
+					// Compression Method
+					.FollowedBy<uint16_t>(static_cast<uint16_t>(EntryCompression))
+					// Last modified time
+					.FollowedBy<uint16_t>(0)
+					// Last modified date
+					.FollowedBy<uint16_t>(0)
+					// CRC-32 of uncompressed data
+					.FollowedBy<uint32_t>(0)
+					// Compressed size. Must be set to MAX32 if actual value is included in Zip64 Extended
+					// Information
+					.FollowedBy<uint32_t>(IsZip64 ? Constants::ZipTag::MAX32 : 0)
+					// Uncompressed size. Must be set to MAX32 if actual value is included in Zip64 Extended
+					// Information
+					.FollowedBy<uint32_t>(IsZip64 ? Constants::ZipTag::MAX32 : 0)
+					// File name length
+					.FollowedBy<uint16_t>(std::uint16_t(FileName.size()))
+					// Extra field length
+					.FollowedBy<uint16_t>(IsZip64 ? Constants::ZipTag::Zip64LocalFileExtraFieldSize : 0);
+
+				// Manually write (variable sized) file name
+				std::copy(FileName.begin(), FileName.end(),
+						  LocalFileHeaderBuffer.Data() + Constants::ZipTag::LocalFileHeaderSize);
+
+				// Include Zip64 Extended Information Extra Field if file size exceeds Zip32 limit
+				if (IsZip64)
+				{
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+								"Including Zip64 Extended Information Extra Field in the local directory for file {}",
+								FileName);
+
+					// Zip64 Extra Field Signature
+					Modio::Detail::TypedBufferWrite(Constants::ZipTag::Zip64ExtraFieldSignature, LocalFileHeaderBuffer,
+													Constants::ZipTag::LocalFileHeaderSize + FileName.size())
+						// Size of this extra block, excluding leading 4 bytes (signature and size fields)
+						.FollowedBy<uint16_t>(Constants::ZipTag::Zip64LocalFileExtraFieldSize - 4)
+						// Uncompressed size, in the data descriptor
+						.FollowedBy<uint64_t>(0)
+						// Compressed size, in the data descriptor
+						.FollowedBy<uint64_t>(0);
+				}
+
+				return LocalFileHeaderBuffer;
+			}
+
+			/// @brief Marshals the data descriptor that follows the data of this entry
+			Modio::Detail::Buffer MakeDataDescriptor() const
+			{
+				Modio::Detail::Buffer DataDescriptorBuffer(IsZip64 ? Constants::ZipTag::Zip64DataDescriptorSize
+																   : Constants::ZipTag::DataDescriptorSize);
+				if (IsZip64)
+				{
+					// Sizes are 8 bytes each when the local header carries a Zip64 extra field
+					Modio::Detail::TypedBufferWrite(Constants::ZipTag::DataDescriptorSignature, DataDescriptorBuffer, 0)
+						.FollowedBy<uint32_t>(InputCRC)
+						.FollowedBy<uint64_t>(CompressedSize)
+						.FollowedBy<uint64_t>(UncompressedSize);
+				}
+				else
+				{
+					Modio::Detail::TypedBufferWrite(Constants::ZipTag::DataDescriptorSignature, DataDescriptorBuffer, 0)
+						.FollowedBy<uint32_t>(InputCRC)
+						.FollowedBy<uint32_t>(std::uint32_t(CompressedSize))
+						.FollowedBy<uint32_t>(std::uint32_t(UncompressedSize));
+				}
+				return DataDescriptorBuffer;
+			}
+
+			/// @brief Checks the file extension against formats that are always stored in compressed form
+			static bool HasIncompressibleExtension(const Modio::filesystem::path& FilePath)
+			{
+				static const std::array<const char*, 24> CompressedExtensions = {
+					".zip", ".7z",	 ".rar", ".gz",	 ".bz2", ".xz",	 ".zst", ".lz4", ".png", ".jpg", ".jpeg", ".webp",
+					".gif", ".ogg", ".oga", ".opus", ".mp3", ".m4a", ".flac", ".mp4", ".webm", ".mkv", ".bk2", ".bik"};
+
+				std::string Extension =
+					Modio::Detail::String::ToLowercase(Modio::ToModioString(FilePath.extension().u8string()));
+				return std::find_if(CompressedExtensions.begin(), CompressedExtensions.end(),
+									[&Extension](const char* Candidate) { return Extension == Candidate; }) !=
+					   CompressedExtensions.end();
+			}
+
+			/// @brief Deflates a sample of the input at the fastest level to estimate whether compression will pay off
+			/// @param Sample The first block of the file
+			/// @return true if the sample shrank by at least ArchiveStoreMinimumSavingsPercent
+			static bool IsSampleCompressible(const Modio::Detail::DynamicBuffer& Sample)
+			{
+				Modio::Detail::Zlib::deflate_stream SampleStream;
+				SampleStream.reset(1, 15, 8, Modio::Detail::Zlib::Strategy::normal);
+
+				Modio::Detail::Buffer SampleOutput(static_cast<std::size_t>(SampleStream.upper_bound(Sample.size())));
+				Modio::Detail::Zlib::z_params SampleState;
+				SampleState.next_out = SampleOutput.Data();
+				SampleState.avail_out = SampleOutput.GetSize();
+
+				Modio::ErrorCode ec;
+				for (const Modio::Detail::Buffer& SampleBuffer : Sample)
+				{
+					SampleState.next_in = SampleBuffer.Data();
+					SampleState.avail_in = SampleBuffer.GetSize();
+					SampleStream.write(SampleState, Modio::Detail::Zlib::Flush::none, ec);
+					if (ec && ec != Modio::ZlibError::EndOfStream)
+					{
+						// Let the regular deflate path surface the error
+						return true;
+					}
+				}
+
+				SampleState.next_in = nullptr;
+				SampleState.avail_in = 0;
+				SampleStream.write(SampleState, Modio::Detail::Zlib::Flush::finish, ec);
+				if (ec && ec != Modio::ZlibError::EndOfStream)
+				{
+					return true;
+				}
+
+				return SampleState.total_out * 100 <
+					   SampleState.total_in *
+						   (100 - Modio::Detail::Constants::Configuration::ArchiveStoreMinimumSavingsPercent);
+			}
+
 			Modio::Detail::Zlib::z_params CompressionState;
 			std::unique_ptr<Modio::Detail::Zlib::deflate_stream> CompressionStream;
 			std::shared_ptr<Modio::Detail::ArchiveFileImplementation> ArchiveFile;
@@ -339,17 +512,17 @@ namespace Modio
 			Modio::filesystem::path PathInsideArchive;
 			Modio::Detail::DynamicBuffer InputFileBuffer;
 			Modio::Detail::Buffer CompressedOutputBuffer;
-			std::unique_ptr<Modio::Detail::Buffer> LocalFileHeaderBuffer;
 			Modio::FileSize BytesProcessed;
 			Modio::FileOffset LocalHeaderOffset;
-			Modio::FileOffset FileDataOffset;
-			Modio::FileOffset EndOffset;
 			std::size_t MaxBytesToRead = 0;
 			std::size_t LocalHeaderSize = 0;
 			std::uint32_t InputCRC = 0;
+			std::uint64_t CompressedSize = 0;
+			std::uint64_t UncompressedSize = 0;
+			ArchiveFileImplementation::CompressionMethod EntryCompression =
+				ArchiveFileImplementation::CompressionMethod::Deflate;
 			ModioAsio::coroutine CoroutineState;
 			Modio::Optional<Modio::Detail::Buffer> NextBuf;
-			std::shared_ptr<uint64_t> RollingFileHash;
 			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo;
 			std::string FileName;
 		};
@@ -14,6 +14,7 @@
 #include "modio/detail/FilesystemWrapper.h"
 #include "modio/detail/compression/zip/ArchiveFileImplementation.h"
 #include "modio/detail/compression/zip/ZipStructures.h"
+#include "modio/detail/ops/compression/zip/WriteToArchivePartSpoolOp.h"
 #include "modio/file/ModioFile.h"
 #include <memory>
 
@@ -30,8 +31,11 @@ namespace Modio
 			FinalizeArchiveOp(std::shared_ptr<Modio::Detail::ArchiveFileImplementation> ArchiveFile)
 				: ArchiveFile(ArchiveFile)
 			{
-				OutputFile = std::make_unique<Modio::Detail::File>(ArchiveFile->FilePath,
-																   Modio::Detail::FileMode::ReadWrite, false);
+				if (!ArchiveFile->OutputSpool)
+				{
+					OutputFile = std::make_unique<Modio::Detail::File>(ArchiveFile->FilePath,
+																	   Modio::Detail::FileMode::ReadWrite, false);
+				}
 			}
 
 			template<typename CoroType>
@@ -40,8 +44,15 @@ namespace Modio
 				reenter(CoroutineState)
 				{
 					// Determine the start of the central directory
-					OutputFile->Seek(Modio::FileOffset(OutputFile->GetFileSize()));
-					StartOfCentralDirectory = OutputFile->Tell();
+					if (ArchiveFile->OutputSpool)
+					{
+						StartOfCentralDirectory = Modio::FileOffset(ArchiveFile->OutputSpool->GetBytesWritten());
+					}
+					else
+					{
+						OutputFile->Seek(Modio::FileOffset(OutputFile->GetFileSize()));
+						StartOfCentralDirectory = OutputFile->Tell();
+					}
 
 					// If the central directory is outside of "4294967295" bytes, tag the archive as Zip64
 					if (StartOfCentralDirectory >= Constants::ZipTag::MAX32)
@@ -102,7 +113,9 @@ namespace Modio
 															   ? Constants::ZipTag::Zip64Version
 															   : Constants::ZipTag::ZipVersion)
 								// General purpose bit-flag
-								.FollowedBy<std::uint16_t>(0)
+								.FollowedBy<std::uint16_t>(CurrentArchiveEntry->bHasDataDescriptor
+															   ? Constants::ZipTag::DataDescriptorFlag
+															   : 0)
 								// Compression method
 								.FollowedBy<std::uint16_t>(static_cast<uint16_t>(CurrentArchiveEntry->Compression))
 								// Last modified time
@@ -175,7 +188,8 @@ namespace Modio
 						}
 
 						// Write out the central directory header for this entry
-						yield OutputFile->WriteAsync(std::move(*RecordBuffer), std::move(Self));
+						yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(), std::move(*RecordBuffer),
+																  std::move(Self));
 						if (ec)
 						{
 							Self.complete(ec);
@@ -220,12 +234,13 @@ namespace Modio
 							// disk number with Zip64 EOCD start
 							.FollowedBy<std::uint32_t>(0)
 							// relative offset of zip64 EOCD record
-							.FollowedBy<std::uint64_t>(OutputFile->Tell())
+							.FollowedBy<std::uint64_t>(StartOfCentralDirectory + SizeOfCentralDirectory)
 							// total number of disks
 							.FollowedBy<std::uint32_t>(1);
 
 						// Write the Zip64 End of Central Directory Record and Locator to the archive file
-						yield OutputFile->WriteAsync(std::move(*RecordBuffer), std::move(Self));
+						yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(), std::move(*RecordBuffer),
+																  std::move(Self));
 					}
 
 					// End of Central Directory Record (EOCD)
@@ -263,7 +278,8 @@ namespace Modio
 						.FollowedBy<std::uint16_t>(0);
 
 					// Write the End of Central Directory Record to archive file
-					yield OutputFile->WriteAsync(std::move(*RecordBuffer), std::move(Self));
+					yield Modio::Detail::AppendToArchiveAsync(*ArchiveFile, OutputFile.get(), std::move(*RecordBuffer),
+																  std::move(Self));
 
 					// Close file handle
 					OutputFile.reset();
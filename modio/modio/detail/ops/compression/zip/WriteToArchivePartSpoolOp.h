@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioErrorCode.h"
+#include "modio/core/ModioServices.h"
+#include "modio/detail/AsioWrapper.h"
+#include "modio/detail/compression/zip/ArchiveFileImplementation.h"
+#include "modio/detail/compression/zip/ArchivePartSpool.h"
+#include "modio/file/ModioFile.h"
+#include <algorithm>
+#include <memory>
+
+MODIO_DIAGNOSTIC_PUSH
+
+MODIO_ALLOW_DEPRECATED_SYMBOLS
+
+namespace Modio
+{
+	namespace Detail
+	{
+#include <asio/yield.hpp>
+		/// @brief Appends a buffer to an ArchivePartSpool, splitting it across part files as they fill up and waiting
+		/// for the reader to release a part when the spool has no room for another
+		class WriteToArchivePartSpoolOp
+		{
+		public:
+			WriteToArchivePartSpoolOp(std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool,
+									  Modio::Detail::Buffer Data)
+				: Spool(Spool),
+				  DataSize(Data.GetSize()),
+				  Data(std::move(Data))
+			{}
+
+			template<typename CoroType>
+			void operator()(CoroType& Self, Modio::ErrorCode ec = {})
+			{
+				reenter(CoroutineState)
+				{
+					while (BytesConsumed < DataSize)
+					{
+						if (Spool->GetError())
+						{
+							Self.complete(Spool->GetError());
+							return;
+						}
+
+						if (!Spool->HasOpenPart())
+						{
+							// More bytes follow the part that was filled last, so it is not the final one
+							Spool->HandOverFullPart();
+							while (!Spool->CanOpenPart() && !Spool->GetError())
+							{
+								yield Spool->WaitForPartReleaseAsync(std::move(Self));
+							}
+
+							if (Spool->GetError())
+							{
+								Self.complete(Spool->GetError());
+								return;
+							}
+
+							if ((ec = Spool->OpenPart()))
+							{
+								Self.complete(ec);
+								return;
+							}
+						}
+
+						ChunkSize = static_cast<std::size_t>(
+							std::min<std::uint64_t>(DataSize - BytesConsumed, Spool->GetOpenPartCapacity()));
+
+						// Avoid copying the common case of a buffer that fits in the open part as a whole
+						if (BytesConsumed == 0 && ChunkSize == DataSize)
+						{
+							yield Spool->GetOpenPartFile().WriteAsync(std::move(Data), std::move(Self));
+						}
+						else
+						{
+							yield Spool->GetOpenPartFile().WriteAsync(
+								Data.CopyRange(BytesConsumed, BytesConsumed + ChunkSize), std::move(Self));
+						}
+
+						if (ec)
+						{
+							Self.complete(ec);
+							return;
+						}
+
+						Spool->CommitBytes(ChunkSize);
+						BytesConsumed += ChunkSize;
+					}
+
+					Self.complete({});
+					return;
+				}
+			}
+
+		private:
+			ModioAsio::coroutine CoroutineState {};
+			std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool {};
+			std::size_t DataSize = 0;
+			Modio::Detail::Buffer Data;
+			std::size_t BytesConsumed = 0;
+			std::size_t ChunkSize = 0;
+		};
+#include <asio/unyield.hpp>
+
+		template<typename CompletionTokenType>
+		auto WriteToArchivePartSpoolAsync(std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool,
+										  Modio::Detail::Buffer Data, CompletionTokenType&& Token)
+		{
+			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
+				WriteToArchivePartSpoolOp(Spool, std::move(Data)), Token,
+				Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
+
+		/// @brief Appends Data to an archive that is being written, through the archive's output spool if it has one
+		/// and to OutputFile otherwise. Every byte of the archive goes through here, in order, so this is also where
+		/// the archive digest is updated
+		template<typename CompletionTokenType>
+		void AppendToArchiveAsync(Modio::Detail::ArchiveFileImplementation& ArchiveFile,
+								  Modio::Detail::File* OutputFile, Modio::Detail::Buffer Data,
+								  CompletionTokenType&& Token)
+		{
+			ArchiveFile.ArchiveDigest.Update(Data);
+			if (ArchiveFile.OutputSpool)
+			{
+				WriteToArchivePartSpoolAsync(ArchiveFile.OutputSpool, std::move(Data),
+											 std::forward<CompletionTokenType>(Token));
+			}
+			else
+			{
+				OutputFile->WriteAsync(std::move(Data), std::forward<CompletionTokenType>(Token));
+			}
+		}
+	} // namespace Detail
+} // namespace Modio
+
+MODIO_DIAGNOSTIC_POP
@@ -41,6 +41,7 @@ namespace Modio
 			void AppendRemainingResults();
 			void LogRequestDetails();
 			void LogResponseDetails();
+			void RecordLatency();
 			Modio::ErrorCode MarshallResponse();
 
 		public:
@@ -87,6 +88,7 @@ namespace Modio
 					}
 
 					LogRequestDetails();
+					Impl->SendTime = std::chrono::steady_clock::now();
 
 					yield Request->SendAsync(std::move(Self));
 
@@ -199,6 +201,8 @@ namespace Modio
 						AppendRemainingResults();
 					}
 
+					RecordLatency();
+
 					/// \todo	is this right???? [RB]
 					ec = MarshallResponse();
 
@@ -211,7 +215,8 @@ namespace Modio
 					{
 						// @note: We will never cache a response that's not 200 as they are returned earlier than this
 						Services::GetGlobalService<CacheService>().AddToCache(
-							Request->Parameters().GetFormattedResourcePath(), ResultBuffer);
+							Request->Parameters().GetFormattedResourcePath(), ResultBuffer,
+							Request->Parameters().GetCacheLifetime());
 
 						Self.complete(Modio::ErrorCode {});
 						return;
@@ -12,8 +12,12 @@
 	#include "modio/detail/ops/http/PerformRequestAndGetResponseOp.h"
 #endif
 
+#include "modio/core/ModioBuffer.h"
+#include "modio/core/ModioLogService.h"
+#include "modio/core/ModioServices.h"
 #include "modio/detail/http/ResponseError.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/serialization/ModioResponseErrorSerialization.h"
 
 namespace Modio
@@ -34,11 +38,9 @@ namespace Modio
 											? AllowCachedResponseValue
 											: Modio::Detail::CachedResponse::Disallow;
 
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-										"Creating {} request for {}{}",
-										Request->Parameters().GetVerb(),
-										Request->Parameters().GetServerAddress(),
-										Request->Parameters().GetFormattedResourcePath());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Creating {} request for {}{}",
+						Request->Parameters().GetVerb(), Request->Parameters().GetServerAddress(),
+						Request->Parameters().GetFormattedResourcePath());
 
 			if (Request->Parameters().GetTypedVerb() != Modio::Detail::Verb::GET)
 			{
@@ -46,8 +48,8 @@ namespace Modio
 					Request->Parameters().GetUrlEncodedPayload();
 				if (UrlEncodedPayload.has_value())
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"Request payload: {}", UrlEncodedPayload.value());
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Request payload: {}",
+								UrlEncodedPayload.value());
 				}
 			}
 		}
@@ -96,6 +98,22 @@ namespace Modio
 				Impl->PayloadElement->second.PathToFile.value(), Modio::Detail::FileMode::ReadOnly);
 		}
 
+		void PerformRequestAndGetResponseOp::RecordLatency()
+		{
+			Modio::Detail::HttpEndpointClass EndpointClass = Modio::Detail::HttpEndpointClass::Mutation;
+			// The payload file is only opened if the request uploaded one
+			if (Impl->CurrentPayloadFile != nullptr)
+			{
+				EndpointClass = Modio::Detail::HttpEndpointClass::Upload;
+			}
+			else if (Request->Parameters().GetTypedVerb() == Modio::Detail::Verb::GET)
+			{
+				EndpointClass = Modio::Detail::HttpEndpointClass::Query;
+			}
+			Modio::Detail::RuntimeStatsCollector::Get().RecordHttpLatency(
+				EndpointClass, std::chrono::steady_clock::now() - Impl->SendTime);
+		}
+
 		std::size_t PerformRequestAndGetResponseOp::CalculateNumBytesToRead() const
 		{
 			constexpr std::size_t ChunkOfBytes = 64 * 1024;
@@ -150,21 +168,21 @@ namespace Modio
 			{
 				if (Header.first == "Authorization")
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Request header Authorization : ******");
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+								"Request header Authorization : ******");
 				} 
 				else 
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"Request header {} : {}", Header.first, Header.second);
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Request header {} : {}", Header.first,
+								Header.second);
 				}
 			}
 
 			if (Request->Parameters().ContainsFormData())
 			{
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"Request content type: {}, payload size: {}",
-												Request->Parameters().GetContentType(),
-												Request->Parameters().GetPayloadSize());
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+							"Request content type: {}, payload size: {}", Request->Parameters().GetContentType(),
+							Request->Parameters().GetPayloadSize());
 			}
 		}
 
@@ -180,8 +198,8 @@ namespace Modio
 
 			for (const auto& Header : Request->GetAllHeaders())
 			{
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"Response header {} : {}", Header.first, Header.second);
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Response header {} : {}", Header.first,
+							Header.second);
 			}
 		}
 
@@ -193,15 +211,14 @@ namespace Modio
 			// Additional if guarding as this logging is extra slow, so don't want to incur any overhead if
 			// someone don't include this trace data
 #if defined(MODIO_TRACE_DUMP_RESPONSE) && MODIO_TRACE_DUMP_RESPONSE
-			if (Services::GetGlobalService<Modio::Detail::LogService>().GetLogLevel() <= Modio::LogLevel::Trace)
+			if (MODIO_LOG_ENABLED(Modio::LogLevel::Trace, Modio::LogCategory::Http))
 			{
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-											"Received response code {} of size {}:", ResponseCode,
-											ResultBuffer.size());
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Received response code {} of size {}:",
+							ResponseCode, ResultBuffer.size());
 				for (const auto& Buffer : ResultBuffer)
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http, "{}",
-												std::string(Buffer.begin(), Buffer.end()));
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "{}",
+								std::string(Buffer.begin(), Buffer.end()));
 				}
 			}
 #endif
@@ -242,14 +259,12 @@ namespace Modio
 						// No need to log rate-limited response out
 						ErrRef != Modio::ApiError::Ratelimited)
 					{
-						Modio::Detail::Buffer ResponseBuffer(ResultBuffer.size());
-						Modio::Detail::BufferCopy(ResponseBuffer, ResultBuffer);
-
 						// Hate doing this copy but this really should be only happening in exceptional
 						// circumstances and we want to avoid dragging in fmt string_view
-						Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Http,
-													"Non 200-204 response received: {}",
-													std::string(ResponseBuffer.begin(), ResponseBuffer.end()));
+						Modio::Detail::Logger().Log(
+							Modio::LogLevel::Error, Modio::LogCategory::Http, "Non 200-204 response received: {}",
+							std::string(Modio::Detail::DynamicBufferByteIterator(ResultBuffer),
+										Modio::Detail::DynamicBufferByteIterator()));
 					}
 					// Return the error-ref regardless, defer upwards to Subscribe/Unsubscribe etc to handle as
 					// success
@@ -269,11 +284,13 @@ namespace Modio
 										"Response received for {}; status code was: {}",
 										Request->Parameters().GetFormattedResourcePath(), ResponseCode);
 
-			Modio::Detail::Buffer ResponseBuffer(ResultBuffer.size());
-			Modio::Detail::BufferCopy(ResponseBuffer, ResultBuffer);
-
-			Modio::Detail::Logger().Log(Modio::LogLevel::Detailed, Modio::LogCategory::Http, "Response body was {}",
-										std::string(ResponseBuffer.begin(), ResponseBuffer.end()));
+			// The body is only copied into a string when it will be logged, rather than for every response
+			if (MODIO_LOG_ENABLED(Modio::LogLevel::Detailed, Modio::LogCategory::Http))
+			{
+				MODIO_LOG(Modio::LogLevel::Detailed, Modio::LogCategory::Http, "Response body was {}",
+							std::string(Modio::Detail::DynamicBufferByteIterator(ResultBuffer),
+										Modio::Detail::DynamicBufferByteIterator()));
+			}
 
 			return {};
 		}
@@ -16,6 +16,7 @@
 #include "modio/detail/serialization/ModioModInfoListSerialization.h"
 #include "modio/detail/ModioProfiling.h"
 #include "modio/detail/ops/http/PerformRequestAndGetResponseOp.h"
+#include <chrono>
 
 #include <asio/yield.hpp>
 
@@ -28,13 +29,19 @@ namespace Modio
 		class ListAllModsOp
 		{
 			Modio::Detail::DynamicBuffer ResponseBodyBuffer {};
+			Modio::Optional<std::chrono::steady_clock::duration> CacheLifetime {};
 			Modio::FilterParams Filter {};
 			Modio::GameID GameID {};
 
 			ModioAsio::coroutine CoroutineState {};
 
 		public:
-			ListAllModsOp(Modio::GameID GameID, FilterParams InFilter) : Filter(std::move(InFilter)), GameID(GameID) {}
+			ListAllModsOp(Modio::GameID GameID, FilterParams InFilter,
+						  Modio::Optional<std::chrono::steady_clock::duration> CacheLifetime = {})
+				: CacheLifetime(CacheLifetime),
+				  Filter(std::move(InFilter)),
+				  GameID(GameID)
+			{}
 
 			template<typename CoroType>
 			void operator()(CoroType& Self, Modio::ErrorCode ec = {})
@@ -55,13 +62,9 @@ namespace Modio
 						}
 					}
 
-						yield Modio::Detail::PerformRequestAndGetResponseAsync(
-							ResponseBodyBuffer,
-								Modio::Detail::GetModsRequest.SetGameID(GameID)
-								.AddPlatformStatusFilter()
-								.AddStatusFilter()
-								.AppendQueryParameterMap(Filter.ToQueryParamaters()),
-							Modio::Detail::CachedResponse::Allow, std::move(Self));
+					yield Modio::Detail::PerformRequestAndGetResponseAsync(ResponseBodyBuffer, MakeRequestParams(),
+																		   Modio::Detail::CachedResponse::Allow,
+																		   std::move(Self));
 					
 					if (ec)
 					{
@@ -78,7 +81,7 @@ namespace Modio
 					{
 						// Got the response OK, try to marshal to the expected type
 						Modio::Optional<Modio::ModInfoList> List =
-							TryMarshalResponse<Modio::ModInfoList>(ResponseBodyBuffer);
+							TryMarshalListResponse<Modio::ModInfoList>(ResponseBodyBuffer);
 						// Marshalled OK
 						if (List.has_value())
 						{
@@ -94,14 +97,30 @@ namespace Modio
 					}
 				}
 			}
+
+		private:
+			Modio::Detail::HttpRequestParams MakeRequestParams() const
+			{
+				Modio::Detail::HttpRequestParams Params = Modio::Detail::GetModsRequest.SetGameID(GameID)
+															  .AddPlatformStatusFilter()
+															  .AddStatusFilter()
+															  .AppendQueryParameterMap(Filter.ToQueryParamaters());
+				if (CacheLifetime.has_value())
+				{
+					Params.SetCacheLifetime(CacheLifetime.value());
+				}
+				return Params;
+			}
 		};
 
+		/// @param CacheLifetime How long the response is cached for, if not the CacheService's expiry time
 		template<typename WrappedCallback>
-		auto ListAllModsAsync(FilterParams Filter, WrappedCallback&& Callback)
+		auto ListAllModsAsync(FilterParams Filter, WrappedCallback&& Callback,
+							  Modio::Optional<std::chrono::steady_clock::duration> CacheLifetime = {})
 		{
 			return ModioAsio::async_compose<WrappedCallback, void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)>(
-				Modio::Detail::ListAllModsOp(Modio::Detail::SDKSessionData::CurrentGameID(), Filter), Callback,
-				Modio::Detail::Services::GetGlobalContext().get_executor());
+				Modio::Detail::ListAllModsOp(Modio::Detail::SDKSessionData::CurrentGameID(), Filter, CacheLifetime),
+				Callback, Modio::Detail::Services::GetGlobalContext().get_executor());
 		}
 
 	} // namespace Detail
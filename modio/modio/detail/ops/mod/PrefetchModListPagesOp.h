@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioCoreTypes.h"
+#include "modio/core/ModioFilterParams.h"
+#include "modio/core/ModioLogger.h"
+#include "modio/detail/ModioProfiling.h"
+#include "modio/detail/ModioSDKSessionData.h"
+#include "modio/detail/ops/mod/ListAllModsOp.h"
+
+#include <asio/yield.hpp>
+
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @brief Requests the pages of a mod query that follow a page the caller already has, one at a time, so
+		/// their responses are in the CacheService when the caller asks for them. The responses are kept for
+		/// PrefetchedModListPageCacheLifetime rather than the usual cache expiry time, as the caller may take a while
+		/// to reach them. The pages are fetched in order and the op stops before the next page once a newer prefetch
+		/// or a different query has begun, so only one prefetch request is ever queued ahead of the caller's own
+		/// requests
+		class PrefetchModListPagesOp
+		{
+			Modio::FilterParams Filter {};
+			std::size_t PagesRemaining = 0;
+			std::uint64_t Generation = 0;
+
+			ModioAsio::coroutine CoroutineState {};
+
+		public:
+			PrefetchModListPagesOp(Modio::FilterParams InFilter, std::size_t NumPages, std::uint64_t Generation)
+				: Filter(std::move(InFilter)),
+				  PagesRemaining(NumPages),
+				  Generation(Generation)
+			{}
+
+			template<typename CoroType>
+			void operator()(CoroType& Self, Modio::ErrorCode ec = {}, Modio::Optional<Modio::ModInfoList> Page = {})
+			{
+				MODIO_PROFILE_SCOPE(PrefetchModListPages);
+				reenter(CoroutineState)
+				{
+					while (PagesRemaining > 0 && Modio::Detail::SDKSessionData::IsModListPrefetchCurrent(Generation))
+					{
+						Filter = Filter.FollowingResults();
+						PagesRemaining--;
+
+						yield Modio::Detail::ListAllModsAsync(
+							Filter, std::move(Self),
+							Modio::Detail::Constants::Configuration::PrefetchedModListPageCacheLifetime);
+
+						if (ec)
+						{
+							Modio::Detail::Logger().Log(Modio::LogLevel::Detailed, Modio::LogCategory::Http,
+														"Stopped prefetching mod list pages: {}", ec.message());
+							Self.complete(ec);
+							return;
+						}
+
+						// There is nothing to prefetch past the last page
+						if (!Page.has_value() || Page->Size() == 0 ||
+							Page->GetPageIndex() + 1 >= Page->GetPageCount())
+						{
+							break;
+						}
+					}
+
+					Self.complete({});
+					return;
+				}
+			}
+		};
+
+		template<typename PrefetchDoneCallback>
+		auto PrefetchModListPagesAsync(Modio::FilterParams Filter, std::size_t NumPages,
+									   PrefetchDoneCallback&& OnPrefetchDone)
+		{
+			return ModioAsio::async_compose<PrefetchDoneCallback, void(Modio::ErrorCode)>(
+				Modio::Detail::PrefetchModListPagesOp(
+					Filter, NumPages, Modio::Detail::SDKSessionData::BeginModListPrefetch(Filter.ToQueryKey())),
+				OnPrefetchDone, Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
+	} // namespace Detail
+} // namespace Modio
+
+#include <asio/unyield.hpp>
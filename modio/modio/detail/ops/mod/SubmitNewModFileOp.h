@@ -13,6 +13,8 @@
 #include "modio/core/ModioCreateModFileParams.h"
 #include "modio/core/ModioBuffer.h"
 #include "modio/core/ModioLogger.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/compression/zip/ArchivePartSpool.h"
 #include "modio/detail/ops/compression/CompressFolderOp.h"
 #include "modio/detail/ops/upload/UploadFileOp.h"
 #include "modio/detail/ops/upload/UploadMultipartFileOp.h"
@@ -59,105 +61,208 @@ namespace Modio
 													   {} });
 					}
 
-					Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
-						"Compressing directory {}", ModRootDirectory.string());
-					yield Modio::Detail::CompressFolderAsync(ModRootDirectory, ArchivePath, FileHash, ProgressInfo,
-						std::move(Self));
+					SubmitParams = CreateRequestParams(
+						Modio::Detail::AddModfileRequest.SetGameID(Modio::Detail::SDKSessionData::CurrentGameID()),
+						CurrentModID, CurrentModParams);
 
-					if (ec)
+					if (ShouldPipelineUpload())
 					{
-						// Marshal generic cancellation as mod management specific cancellation, because the archive
-						// implementation is potentially used outside of uploads it can return
-						// Modio::GenericError::OperationCanceled
-						Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(Modio::ModManagementEvent{
-							CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
-							Modio::ErrorCodeMatches(ec, Modio::GenericError::OperationCanceled)
-								? Modio::make_error_code(Modio::ModManagementError::UploadCancelled)
-								: ec });
-						Modio::Detail::SDKSessionData::CancelModDownloadOrUpdate(CurrentModID);
+						// Upload the archive in parts while it is still being compressed. Only a few parts exist in
+						// the temp directory at once, and the central directory ends up in the final part
+						Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+													"Compressing and uploading directory {} in parts",
+													ModRootDirectory.string());
+						Spool = std::make_shared<Modio::Detail::ArchivePartSpool>(
+							ArchivePath, Modio::Detail::Constants::Configuration::MultipartMaxFilePartSize,
+							Modio::Detail::SDKSessionData::GetMultipartUploadConcurrency() + 1);
+						Modio::Detail::CompressFolderToSpoolAsync(
+							ModRootDirectory, Spool, FileHash, ProgressInfo,
+							[PartSpool = Spool](Modio::ErrorCode ec) { PartSpool->Close(ec); });
 
-						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(ArchivePath);
-						Self.complete(ec);
-						return;
-					}
+						Session = std::make_shared<Modio::Detail::UploadSession>();
+						yield Modio::Detail::UploadMultipartSpoolAsync(Session, CurrentModID, ArchivePath,
+																	   std::to_string(ManifestHash), Spool,
+																	   ProgressInfo, std::move(Self));
 
-					{
-						// Determine the file size of the compressed modfile
-						ZipFileSize = Modio::filesystem::file_size(ArchivePath, ec);
+						// Waiting for the compression below resumes the operation without an error code
+						UploadError = ec;
+						if (!Spool->IsClosed())
+						{
+							// Stop the compression if the upload finished early, either because it failed or because
+							// the server already had this archive
+							Spool->Fail(ec ? ec : Modio::make_error_code(Modio::GenericError::OperationCanceled));
+						}
 
-						if (ec)
+						// The archive hash is only set once the compression has finished, and the compression must
+						// not be writing parts while the archive is compressed again below
+						while (!Spool->IsWriterFinished())
+						{
+							yield Spool->SetReaderNotifier(
+								[Waiter = fu2::unique_function<void()>(std::move(Self))]() mutable {
+									if (Waiter)
+									{
+										ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(),
+														std::move(Waiter));
+										Waiter = nullptr;
+									}
+								});
+						}
+
+						ec = UploadError;
+						if (!ec && Session->UploadID.has_value() == false)
 						{
-							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
-								ArchivePath);
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+														"ModID {} Upload Multipart did not obtain an UploadID",
+														CurrentModID);
+							ec = Modio::make_error_code(Modio::HttpError::RequestError);
+						}
 
+						if (ec)
+						{
+							// Marshal generic cancellation as mod management specific cancellation, because the
+							// archive implementation is potentially used outside of uploads it can return
+							// Modio::GenericError::OperationCanceled
+							if (Modio::ErrorCodeMatches(ec, Modio::GenericError::OperationCanceled))
+							{
+								ec = Modio::make_error_code(Modio::ModManagementError::UploadCancelled);
+							}
+							Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(
+								Modio::ModManagementEvent {CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
+														   ec});
+							Modio::Detail::SDKSessionData::CancelModDownloadOrUpdate(CurrentModID);
 							Self.complete(ec);
 							return;
 						}
-					}
 
-					SubmitParams = CreateRequestParams(
-						Modio::Detail::AddModfileRequest.SetGameID(Modio::Detail::SDKSessionData::CurrentGameID()),
-						CurrentModID, CurrentModParams);
+						if (Spool->IsClosed() && !Spool->GetError())
+						{
+							// Every part was uploaded and the compression finished, so the archive hash is known and
+							// the server can check the assembled file against it
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+														"Upload pipelined archive with UploadID {} and MD5 {}",
+														Session->UploadID.value(), *FileHash);
+							yield Modio::Detail::UploadFileAsync(
+								ResponseBuffer,
+								SubmitParams.AppendPayloadValue("upload_id", Session->UploadID.value())
+									.AppendPayloadValue(Modio::Detail::Constants::APIStrings::FileHash, *FileHash),
+								ProgressInfo, std::move(Self));
+						}
+						else
+						{
+							// The upload session finished without reading the whole archive, so the compression was
+							// stopped before the archive hash was known. Compress the archive again and upload it
+							// the regular way, which submits it with its hash
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+														"Upload session {} ended before the archive was complete, "
+														"falling back to a regular upload",
+														Session->UploadID.value());
+							Spool.reset();
+						}
+					}
 
-					// The API requires that 500MiB+ files should upload using the Multipart
-					if (ZipFileSize > Modio::Detail::Constants::Configuration::MultipartMaxFileSize)
+					if (!Spool)
 					{
 						Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
-							"ModID {} Upload Multipart Archive file at {}", CurrentModID,
-							ArchivePath.string());
-						Session = std::make_shared<Modio::Detail::UploadSession>();
-						// This operation would split request in 50MB chunks
-						yield Modio::Detail::UploadMultipartFileAsync(Session, CurrentModID, ArchivePath,
-							std::to_string(*FileHash), ProgressInfo,
+							"Compressing directory {}", ModRootDirectory.string());
+						yield Modio::Detail::CompressFolderAsync(ModRootDirectory, ArchivePath, FileHash, ProgressInfo,
 							std::move(Self));
 
-						FileHash.reset();
 						if (ec)
 						{
-							Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(
-								Modio::ModManagementEvent{ CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
-														   ec });
+							// Marshal generic cancellation as mod management specific cancellation, because the archive
+							// implementation is potentially used outside of uploads it can return
+							// Modio::GenericError::OperationCanceled
+							Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(Modio::ModManagementEvent{
+								CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
+								Modio::ErrorCodeMatches(ec, Modio::GenericError::OperationCanceled)
+									? Modio::make_error_code(Modio::ModManagementError::UploadCancelled)
+									: ec });
+							Modio::Detail::SDKSessionData::CancelModDownloadOrUpdate(CurrentModID);
 
-							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
-								ArchivePath);
+							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(ArchivePath);
 							Self.complete(ec);
 							return;
 						}
 
-						if (Session->UploadID.has_value() == false)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
-								"ModID {} Upload Multipart did not obtain an UploadID",
-								CurrentModID, ArchivePath.string());
-							ec = Modio::make_error_code(Modio::HttpError::RequestError);
-							Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(
-								Modio::ModManagementEvent{ CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
-														   ec });
+							// Determine the file size of the compressed modfile
+							ZipFileSize = Modio::filesystem::file_size(ArchivePath, ec);
 
-							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
-								ArchivePath);
-							Self.complete(ec);
-							return;
+							if (ec)
+							{
+								Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+									ArchivePath);
+
+								Self.complete(ec);
+								return;
+							}
 						}
 
-						Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
-							"Upload Archive file {} with UploadID {}", ArchivePath.string(),
-							Session->UploadID.value());
-						yield Modio::Detail::UploadFileAsync(
-							ResponseBuffer, SubmitParams.AppendPayloadValue("upload_id", Session->UploadID.value()),
-							ProgressInfo, std::move(Self));
-					}
-					else
-					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
-							"Upload Archive file at {}", ArchivePath.string());
-						yield Modio::Detail::UploadFileAsync(ResponseBuffer,
-							SubmitParams.AppendPayloadFile("filedata", ArchivePath),
-							ProgressInfo, std::move(Self));
+						// The API requires that 500MiB+ files should upload using the Multipart
+						if (ZipFileSize > Modio::Detail::Constants::Configuration::MultipartMaxFileSize)
+						{
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+								"ModID {} Upload Multipart Archive file at {}", CurrentModID,
+								ArchivePath.string());
+							Session = std::make_shared<Modio::Detail::UploadSession>();
+							// This operation would split request in 50MB chunks
+							// The archive MD5 doubles as the session nonce, so the server recognizes a session for
+							// an archive with the same contents
+							yield Modio::Detail::UploadMultipartFileAsync(Session, CurrentModID, ArchivePath,
+								*FileHash, ProgressInfo,
+								std::move(Self));
+
+							if (ec)
+							{
+								Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(
+									Modio::ModManagementEvent{ CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
+															   ec });
+
+								Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+									ArchivePath);
+								Self.complete(ec);
+								return;
+							}
+
+							if (Session->UploadID.has_value() == false)
+							{
+								Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+									"ModID {} Upload Multipart did not obtain an UploadID",
+									CurrentModID, ArchivePath.string());
+								ec = Modio::make_error_code(Modio::HttpError::RequestError);
+								Modio::Detail::SDKSessionData::GetModManagementEventLog().AddEntry(
+									Modio::ModManagementEvent{ CurrentModID, Modio::ModManagementEvent::EventType::Uploaded,
+															   ec });
+
+								Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+									ArchivePath);
+								Self.complete(ec);
+								return;
+							}
+
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+								"Upload Archive file {} with UploadID {}", ArchivePath.string(),
+								Session->UploadID.value());
+							yield Modio::Detail::UploadFileAsync(
+								ResponseBuffer,
+								SubmitParams.AppendPayloadValue("upload_id", Session->UploadID.value())
+									.AppendPayloadValue(Modio::Detail::Constants::APIStrings::FileHash, *FileHash),
+								ProgressInfo, std::move(Self));
+						}
+						else
+						{
+							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::ModManagement,
+								"Upload Archive file at {}", ArchivePath.string());
+							yield Modio::Detail::UploadFileAsync(ResponseBuffer,
+								SubmitParams.AppendPayloadFile("filedata", ArchivePath)
+									.AppendPayloadValue(Modio::Detail::Constants::APIStrings::FileHash, *FileHash),
+								ProgressInfo, std::move(Self));
+						}
 					}
 
-					// Delete zip file when the upload is done
-					if (!Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+					// Delete zip file when the upload is done. The parts of a pipelined upload are deleted as they are
+					// uploaded
+					if (!Spool && !Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
 						ArchivePath))
 					{
 						Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::ModManagement,
@@ -190,14 +295,25 @@ namespace Modio
 			Modio::Detail::HttpRequestParams CreateRequestParams(HttpRequestParams AddRequest, Modio::ModID ModID,
 																 Modio::CreateModFileParams Params);
 		private:
+			/// @brief Decides whether the archive is uploaded while it is being compressed. That is the case when
+			/// pipelined uploads are enabled and the folder is large enough to need a multipart upload. As the archive
+			/// hash is not known until compression ends, this also hashes the path, size and modification time of every
+			/// entry in the folder into ManifestHash, which is used as the nonce of the upload session
+			bool ShouldPipelineUpload();
+
 			ModioAsio::coroutine CoroutineState {};
 			Modio::Detail::HttpRequestParams SubmitParams {};
 			Modio::Detail::DynamicBuffer ResponseBuffer {};
 			std::shared_ptr<Modio::Detail::UploadSession> Session {};
+			std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool {};
+			/// @brief Result of the pipelined multipart upload
+			Modio::ErrorCode UploadError {};
+			std::uint64_t ManifestHash = 0;
 			Modio::filesystem::path ArchivePath {};
 			Modio::filesystem::path ModRootDirectory {};
 			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo {};
-			std::shared_ptr<uint64_t> FileHash {};
+			/// @brief MD5 of the archive, set once it has been compressed
+			std::shared_ptr<std::string> FileHash {};
 			Modio::ModID CurrentModID {};
 			Modio::CreateModFileParams CurrentModParams {};
 			std::uintmax_t ZipFileSize = 0;
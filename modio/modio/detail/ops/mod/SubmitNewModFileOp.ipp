@@ -12,6 +12,8 @@
 	#include "modio/detail/ops/mod/SubmitNewModFileOp.h"
 #endif
 
+#include "modio/detail/ModioStringHash.h"
+
 namespace Modio
 {
 	namespace Detail
@@ -28,10 +30,68 @@ namespace Modio
 								.MakeTempFilePath(fmt::format("modfile_{}.zip", ModID))
 								.value_or("");
 			ProgressInfo = Modio::Detail::SDKSessionData::StartModDownloadOrUpdate(CurrentModID);
-			FileHash = std::make_shared<uint64_t>(0ULL);
+			FileHash = std::make_shared<std::string>();
 		}
 
 
+		bool SubmitNewModFileOp::ShouldPipelineUpload()
+		{
+			if (!Modio::Detail::SDKSessionData::IsPipelinedModfileUploadEnabled())
+			{
+				return false;
+			}
+
+			Modio::filesystem::path RootPath = ModRootDirectory;
+			if (RootPath.has_filename())
+			{
+				RootPath = RootPath.parent_path();
+			}
+
+			Modio::ErrorCode ec;
+			std::uint64_t TotalSize = 0;
+			std::uint64_t Hash = Modio::Detail::val_64_const;
+			Modio::filesystem::recursive_directory_iterator Entries(RootPath, ec);
+			if (ec)
+			{
+				return false;
+			}
+
+			for (Modio::filesystem::recursive_directory_iterator Entry = begin(Entries); Entry != end(Entries);
+				 Entry.increment(ec))
+			{
+				if (ec)
+				{
+					return false;
+				}
+
+				std::string Descriptor =
+					Modio::ToModioString(Modio::filesystem::relative(Entry->path(), RootPath, ec).generic_u8string());
+				if (Modio::filesystem::is_regular_file(Entry->path(), ec))
+				{
+					std::uint64_t FileSize = Modio::filesystem::file_size(Entry->path(), ec);
+					TotalSize += FileSize;
+					Descriptor += fmt::format(":{}:{}", FileSize,
+											  Modio::filesystem::last_write_time(Entry->path(), ec)
+												  .time_since_epoch()
+												  .count());
+				}
+				if (ec)
+				{
+					return false;
+				}
+				Hash = Modio::Detail::hash_64_fnv1a_const(Descriptor.c_str(), Hash);
+			}
+
+			// Folders that would fit in a single request compress to a file that is uploaded as a whole
+			if (TotalSize <= Modio::Detail::Constants::Configuration::MultipartMaxFileSize)
+			{
+				return false;
+			}
+
+			ManifestHash = Hash;
+			return true;
+		}
+
 		Modio::Detail::HttpRequestParams SubmitNewModFileOp::CreateRequestParams(HttpRequestParams AddRequest,
 																					Modio::ModID ModID,
 																					Modio::CreateModFileParams Params)
@@ -102,7 +102,7 @@ namespace Modio
 						Session = std::make_shared<Modio::Detail::UploadSession>();
 						// This operation would split request in 50MB chunks
 						yield Modio::Detail::UploadMultipartFileAsync(Session, CurrentModID, ArchivePath,
-																	  std::to_string(*FileHash), ProgressInfo,
+																	  *FileHash, ProgressInfo,
 																	  std::move(Self));
 
 						if (ec)
@@ -196,7 +196,7 @@ namespace Modio
 			Modio::filesystem::path ArchivePath;
 			Modio::filesystem::path ModRootDirectory;
 			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo;
-			std::shared_ptr<uint64_t> FileHash;
+			std::shared_ptr<std::string> FileHash;
 			Modio::ModID CurrentModID;
 			Modio::CreateSourceFileParams CurrentModParams;
 			std::uintmax_t ZipFileSize = 0;
@@ -26,7 +26,7 @@ namespace Modio
 								  .MakeTempFilePath(fmt::format("modfile_{}.zip", ModID))
 								  .value_or("");
 				ProgressInfo = Modio::Detail::SDKSessionData::StartModDownloadOrUpdate(CurrentModID);
-				FileHash = std::make_shared<uint64_t>(0ULL);
+				FileHash = std::make_shared<std::string>();
 			}
 			Modio::Detail::HttpRequestParams SubmitNewModSourceFileOp::CreateSourceRequestParams(
 				HttpRequestParams AddRequest, Modio::ModID ModID,
@@ -84,10 +84,9 @@ namespace Modio
 
 				reenter(CoroutineState)
 				{
-					Modio::Detail::Logger().Log(
-						Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin copy directory from {} to {}",
-						Modio::ToModioString(Impl->SourceDirectoryPath.u8string()), 
-						Modio::ToModioString(Impl->DestinationDirectoryPath.u8string()));
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin copy directory from {} to {}",
+								Modio::ToModioString(Impl->SourceDirectoryPath.u8string()),
+								Modio::ToModioString(Impl->DestinationDirectoryPath.u8string()));
 
 					// Build the file list and replicate the directory structure
 					{
@@ -145,10 +144,9 @@ namespace Modio
 						Impl->CurrentFileSize = Impl->SourceFile->GetFileSize();
 						Impl->BytesProcessed = 0;
 
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-													"Copying file {} ({} bytes) to {}",
-													Modio::ToModioString(Impl->FileIterator->first.u8string()), Impl->CurrentFileSize,
-													Modio::ToModioString(Impl->FileIterator->second.u8string()));
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Copying file {} ({} bytes) to {}",
+									Modio::ToModioString(Impl->FileIterator->first.u8string()), Impl->CurrentFileSize,
+									Modio::ToModioString(Impl->FileIterator->second.u8string()));
 
 						while (Impl->BytesProcessed < Impl->CurrentFileSize)
 						{
@@ -194,9 +192,9 @@ namespace Modio
 							}
 						}
 
-						Modio::Detail::Logger().Log(
-							Modio::LogLevel::Trace, Modio::LogCategory::File, "Finished copying file {} to {}",
-							Modio::ToModioString(Impl->FileIterator->first.u8string()), Modio::ToModioString(Impl->FileIterator->second.u8string()));
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finished copying file {} to {}",
+									Modio::ToModioString(Impl->FileIterator->first.u8string()),
+									Modio::ToModioString(Impl->FileIterator->second.u8string()));
 
 						// Close files
 						Impl->SourceFile.reset();
@@ -208,9 +206,9 @@ namespace Modio
 											  std::move(Self));
 					}
 
-					Modio::Detail::Logger().Log(
-						Modio::LogLevel::Trace, Modio::LogCategory::File, "Finished copy directory from {} to {}",
-						Modio::ToModioString(Impl->SourceDirectoryPath.u8string()), Modio::ToModioString(Impl->DestinationDirectoryPath.u8string()));
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finished copy directory from {} to {}",
+								Modio::ToModioString(Impl->SourceDirectoryPath.u8string()),
+								Modio::ToModioString(Impl->DestinationDirectoryPath.u8string()));
 					Impl.reset();
 					Self.complete({});
 					return;
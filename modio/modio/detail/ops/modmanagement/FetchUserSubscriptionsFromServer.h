@@ -63,7 +63,7 @@ namespace Modio
 						// append the results to a modinfolist in stable storage
 						{
 							Modio::Optional<Modio::ModInfoList> CurrentModInfoPage =
-								TryMarshalResponse<Modio::ModInfoList>(SubscriptionBuffer);
+								TryMarshalListResponse<Modio::ModInfoList>(SubscriptionBuffer);
 							if (!CurrentModInfoPage.has_value())
 							{
 								Self.complete(Modio::make_error_code(Modio::HttpError::InvalidResponse), {});
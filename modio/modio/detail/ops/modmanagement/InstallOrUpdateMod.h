@@ -11,6 +11,7 @@
 #pragma once
 
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ops/ComputeFileMD5Op.h"
 #include "modio/detail/ops/DownloadFileOp.h"
 #include "modio/detail/ops/compression/ExtractAllToFolderOp.h"
 #include "modio/detail/ops/http/PerformRequestAndGetResponseOp.h"
@@ -219,6 +220,26 @@ namespace Modio
 						}
 					}
 
+					if (bFileDownloadComplete && !ModInfoData.FileInfo->FilehashMD5.empty())
+					{
+						// A file of the right size may still be corrupt, or left over from an older modfile of the same
+						// size. Hashing it is much cheaper than downloading it again
+						ExistingFileMD5 = std::make_shared<std::string>();
+						yield Modio::Detail::ComputeFileMD5Async(DownloadPath, ExistingFileMD5, std::move(Self));
+						if (ec || *ExistingFileMD5 !=
+									  Modio::Detail::String::ToLowercase(ModInfoData.FileInfo->FilehashMD5))
+						{
+							Modio::Detail::Logger().Log(LogLevel::Warning, LogCategory::File,
+														"Downloaded modfile {} does not match the expected MD5, "
+														"downloading it again",
+														DownloadPath.string());
+							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().DeleteFile(
+								DownloadPath);
+							bFileDownloadComplete = false;
+							ec = {};
+						}
+					}
+
 					// this check may be redundant given the above check
 					if (std::shared_ptr<Modio::ModProgressInfo> MPI = ModProgress.lock())
 					{
@@ -237,7 +258,7 @@ namespace Modio
 						return;
 					}
 
-					if (!bFileDownloadComplete)
+					while (!bFileDownloadComplete)
 					{
 						Modio::Detail::Logger().Log(
 							LogLevel::Detailed, LogCategory::Http,
@@ -248,13 +269,29 @@ namespace Modio
 						yield Modio::Detail::DownloadFileAsync(
 							Modio::Detail::HttpRequestParams::FileDownload(ModInfoData.FileInfo->DownloadBinaryURL)
 								.value(),
-							DownloadPath, ModProgress, ModInfoData.FileInfo.value().Filesize, std::move(Self));
+							DownloadPath, ModProgress, ModInfoData.FileInfo.value().Filesize,
+							ModInfoData.FileInfo->FilehashMD5, std::move(Self));
+
+						// A download that does not match its expected size or MD5 is discarded, so it can be
+						// downloaded again a limited number of times
+						if (ec == Modio::make_error_code(Modio::FilesystemError::FileVerificationFailed) &&
+							VerificationRetriesRemaining > 0)
+						{
+							VerificationRetriesRemaining--;
+							Modio::Detail::Logger().Log(LogLevel::Warning, LogCategory::Http,
+														"Download of modfile for mod {} was corrupt, retrying",
+														ModInfoData.ModId);
+							continue;
+						}
+
 						if (ec)
 						{
 							Modio::Detail::SDKSessionData::FinishModDownloadOrUpdate();
 							Self.complete(ec);
 							return;
 						}
+
+						bFileDownloadComplete = true;
 					}
 
 					CollectionEntry->SetModState(Modio::ModState::Extracting);
@@ -326,6 +363,9 @@ namespace Modio
 			Modio::Transaction<Modio::ModCollectionEntry> Transaction {};
 			std::weak_ptr<Modio::ModProgressInfo> ModProgress {};
 			bool bFileDownloadComplete = false;
+			std::shared_ptr<std::string> ExistingFileMD5 {};
+			std::uint8_t VerificationRetriesRemaining =
+				Modio::Detail::Constants::Configuration::MaxModfileVerificationRetries;
 		};
 
 		template<typename InstallDoneCallback>
@@ -50,17 +50,7 @@ namespace Modio
 						// Check for pending uninstallations regardless of user
 						{
 							auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
-							for (auto ModEntry :
-								 Modio::Detail::SDKSessionData::GetSystemModCollection().SortEntriesByRetryPriority())
-							{
-								if (ModEntry->GetModState() == Modio::ModState::UninstallPending)
-								{
-									if (ModEntry->ShouldRetry())
-									{
-										EntryToProcess = ModEntry;
-									}
-								}
-							}
+							EntryToProcess = Modio::Detail::SDKSessionData::GetNextPendingUninstall();
 						}
 
 						if (!EntryToProcess)
@@ -96,23 +86,16 @@ namespace Modio
 							if (Modio::Optional<Modio::ModID> PriorityID =
 									Modio::Detail::SDKSessionData::GetPriorityModID())
 							{
-								Modio::ModCollection UserModCollection =
-									Modio::Detail::SDKSessionData::FilterSystemModCollectionByUserSubscriptions();
-								// If it is set, is it in the user's mod collection?
-								if (Modio::Optional<Modio::ModCollectionEntry&> FoundEntry =
-										UserModCollection.GetByModID(*PriorityID))
+								// If it is set, is it in the user's mod collection, and does it need an installation or
+								// update?
+								if (std::shared_ptr<Modio::ModCollectionEntry> FoundEntry =
+										Modio::Detail::SDKSessionData::FindPendingInstallOrUpdate(*PriorityID))
 								{
-									// If it is, does it need an installation or update?
-									Modio::ModState CurrentState = FoundEntry->GetModState();
-									if (CurrentState == Modio::ModState::InstallationPending ||
-										CurrentState == Modio::ModState::UpdatePending)
+									// Has it already been retried too much for this session?
+									if (FoundEntry->ShouldRetry())
 									{
-										// Has it already been retried too much for this session?
-										if (FoundEntry->ShouldRetry())
-										{
-											// If good to retry, prioritize specified mod download/install
-											EntryToProcess = UserModCollection.Entries().at(*PriorityID);
-										}
+										// If good to retry, prioritize specified mod download/install
+										EntryToProcess = FoundEntry;
 									}
 								}
 							}
@@ -140,29 +123,8 @@ namespace Modio
 									return;
 								}
 
-								Modio::ModCollection UserModCollection =
-									Modio::Detail::SDKSessionData::FilterSystemModCollectionByUserSubscriptions();
-
-								// No prioritized mod, sort by normal retry priority
-								for (auto ModEntry : UserModCollection.SortEntriesByRetryPriority())
-								{
-									Modio::ModState CurrentState = ModEntry->GetModState();
-
-									Modio::Detail::Logger().Log(Modio::LogLevel::Trace,
-																Modio::LogCategory::ModManagement,
-																"Checking {} state: {}", ModEntry->GetID(),
-																Modio::ModStateToString(CurrentState));
-
-									if (CurrentState == Modio::ModState::InstallationPending ||
-										CurrentState == Modio::ModState::UpdatePending)
-									{
-										if (ModEntry->ShouldRetry())
-										{
-											EntryToProcess = ModEntry;
-											// break;
-										}
-									}
-								}
+								// No prioritized mod, pick by normal retry priority
+								EntryToProcess = Modio::Detail::SDKSessionData::GetNextPendingInstallOrUpdate();
 							}
 						}
 					}
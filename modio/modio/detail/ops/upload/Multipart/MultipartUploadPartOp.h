@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2021 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io SDK.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-sdk/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "modio/core/ModioBuffer.h"
+#include "modio/detail/ModioConstants.h"
+#include "modio/detail/entities/ModioUploadSession.h"
+#include "modio/detail/ops/upload/UploadFilePartOp.h"
+#include "modio/timer/ModioTimer.h"
+
+MODIO_DIAGNOSTIC_PUSH
+MODIO_ALLOW_DEPRECATED_SYMBOLS
+
+#include <asio/yield.hpp>
+namespace Modio
+{
+	namespace Detail
+	{
+		/// @brief Uploads a single part of a multipart upload session, retrying transient failures with an exponential
+		/// backoff. Any progress reported by a failed attempt is rolled back before the part is retried so the
+		/// aggregated ModProgressInfo stays accurate when several parts are in flight
+		class MultipartUploadPartOp
+		{
+			Modio::Detail::HttpRequestParams PartRequest {};
+			Modio::Detail::DynamicBuffer ResponseBuffer {};
+			Modio::Detail::UploadFilePartRange Part {};
+			std::shared_ptr<Modio::Detail::UploadSession> Session {};
+			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo {};
+			// Bytes of this part sent by the current attempt, shared with the caller
+			std::shared_ptr<std::uintmax_t> AttemptBytesUploaded {};
+			std::uint8_t RetriesRemaining = Modio::Detail::Constants::Configuration::DefaultNumberOfRetries;
+			std::chrono::steady_clock::duration RetryDelay =
+				Modio::Detail::Constants::Configuration::MultipartPartRetryInitialDelay;
+			Modio::Detail::Timer RetryTimer {};
+			ModioAsio::coroutine Coroutine {};
+
+		public:
+			MultipartUploadPartOp(Modio::Detail::HttpRequestParams PartRequest, Modio::Detail::UploadFilePartRange Part,
+								  std::shared_ptr<Modio::Detail::UploadSession> Session,
+								  std::weak_ptr<Modio::ModProgressInfo> ProgressInfo,
+								  std::shared_ptr<std::uintmax_t> AttemptBytesUploaded)
+				: PartRequest(PartRequest),
+				  Part(Part),
+				  Session(Session),
+				  ProgressInfo(ProgressInfo),
+				  AttemptBytesUploaded(AttemptBytesUploaded)
+			{}
+
+			template<typename CoroType>
+			void operator()(CoroType& Self, Modio::ErrorCode ec = {})
+			{
+				reenter(Coroutine)
+				{
+					while (true)
+					{
+						*AttemptBytesUploaded = 0;
+						// Each attempt gets its own response buffer, parts in flight must not share one
+						ResponseBuffer = Modio::Detail::DynamicBuffer();
+						yield Modio::Detail::UploadFilePartAsync(ResponseBuffer, PartRequest, Part, Session,
+																 ProgressInfo, AttemptBytesUploaded, std::move(Self));
+
+						if (!ec || RetriesRemaining == 0 || !IsRetryable(ec))
+						{
+							Self.complete(ec);
+							return;
+						}
+
+						RollbackAttemptProgress();
+						RetriesRemaining--;
+
+						Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::Http,
+													"Multipart upload of part {} failed with {}, retrying in {}ms",
+													Part.FilePart + 1, ec.message(),
+													std::chrono::duration_cast<std::chrono::milliseconds>(RetryDelay)
+														.count());
+
+						RetryTimer.ExpiresAfter(RetryDelay);
+						RetryDelay *= 2;
+						yield RetryTimer.WaitAsync(std::move(Self));
+
+						if (Session->UploadID.has_value() == false)
+						{
+							// The session was torn down while we were waiting
+							Self.complete(Modio::make_error_code(Modio::ModManagementError::UploadCancelled));
+							return;
+						}
+					}
+				}
+			}
+
+		private:
+			/// @brief Failures that are caused by the connection or by server load, rather than by the request itself
+			static bool IsRetryable(const Modio::ErrorCode& ec)
+			{
+				return ec == Modio::HttpError::CannotOpenConnection || ec == Modio::HttpError::RequestError ||
+					   ec == Modio::HttpError::ServerClosedConnection || ec == Modio::HttpError::ServerUnavailable ||
+					   ec == Modio::HttpError::ServersOverloaded || ec == Modio::HttpError::RateLimited ||
+					   ec == Modio::ApiError::Ratelimited;
+			}
+
+			void RollbackAttemptProgress()
+			{
+				std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
+				// Before the upload takes over the progress, the bytes of the attempt have not been reported yet.
+				// Afterwards, the bytes the attempt sent before that were reported when the upload took over
+				if (Progress && *AttemptBytesUploaded > 0 &&
+					Progress->GetCurrentState() == Modio::ModProgressInfo::EModProgressState::Uploading)
+				{
+					Modio::FileSize Current =
+						Progress->GetCurrentProgress(Modio::ModProgressInfo::EModProgressState::Uploading);
+					Modio::FileSize Rollback = Modio::FileSize(*AttemptBytesUploaded);
+					SetCurrentProgress(*Progress.get(), Current > Rollback ? Current - Rollback : Modio::FileSize(0));
+				}
+			}
+		};
+#include <asio/unyield.hpp>
+
+		/// @param AttemptBytesUploaded Receives the number of bytes sent by the current attempt, reset on every retry
+		template<typename CompletionTokenType>
+		auto MultipartUploadPartAsync(Modio::Detail::HttpRequestParams PartRequest,
+									  Modio::Detail::UploadFilePartRange Part,
+									  std::shared_ptr<Modio::Detail::UploadSession> Session,
+									  std::weak_ptr<Modio::ModProgressInfo> ProgressInfo,
+									  std::shared_ptr<std::uintmax_t> AttemptBytesUploaded, CompletionTokenType&& Token)
+		{
+			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
+				MultipartUploadPartOp(PartRequest, Part, Session, ProgressInfo, AttemptBytesUploaded), Token,
+				Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
+	} // namespace Detail
+} // namespace Modio
+
+MODIO_DIAGNOSTIC_POP
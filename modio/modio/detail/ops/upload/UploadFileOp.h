@@ -13,6 +13,7 @@
 #include "modio/core/ModioBuffer.h"
 #include "modio/http/ModioHttpRequest.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/http/ResponseError.h"
 #include "modio/detail/http/PerformRequestImpl.h"
 
@@ -84,6 +85,7 @@ namespace Modio
 						return;
 					}
 
+					Impl->SendTime = std::chrono::steady_clock::now();
 					yield Request->SendAsync(std::move(Self));
 
 					if (ec)
@@ -269,20 +271,22 @@ namespace Modio
 					}
 					// After this State.ResponseBodyBuffer is considered dead
 
+					Modio::Detail::RuntimeStatsCollector::Get().RecordHttpLatency(
+						Modio::Detail::HttpEndpointClass::Upload, std::chrono::steady_clock::now() - Impl->SendTime);
+
 					std::uint32_t ResponseCode = Request->GetResponseCode();
 
 // Additional if guarding as this logging is extra slow, so don't want to incur any overhead if someone
 // don't include this trace data
 #if defined(MODIO_TRACE_DUMP_RESPONSE) && MODIO_TRACE_DUMP_RESPONSE
-					if (Services::GetGlobalService<Modio::Detail::LogService>().GetLogLevel() <= Modio::LogLevel::Trace)
+					if (MODIO_LOG_ENABLED(Modio::LogLevel::Trace, Modio::LogCategory::Http))
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"Received response code {} of size {}:", ResponseCode,
-													ResultBuffer.size());
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+									"Received response code {} of size {}:", ResponseCode, ResultBuffer.size());
 						for (const auto& Buffer : ResultBuffer)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http, "{}",
-														std::string(Buffer.begin(), Buffer.end()));
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "{}",
+										std::string(Buffer.begin(), Buffer.end()));
 						}
 					}
 #endif
@@ -11,11 +11,14 @@
 #pragma once
 
 #include "modio/http/ModioHttpRequest.h"
+#include "modio/detail/ModioConstants.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/http/ResponseError.h"
 #include "modio/detail/http/PerformRequestImpl.h"
 #include "modio/detail/entities/ModioUploadSession.h"
 #include "modio/detail/serialization/ModioResponseErrorSerialization.h"
+#include <algorithm>
 
 MODIO_DIAGNOSTIC_PUSH
 MODIO_ALLOW_DEPRECATED_SYMBOLS
@@ -25,6 +28,39 @@ namespace Modio
 {
 	namespace Detail
 	{
+		/// @brief Describes which bytes of which file make up a single part of a multipart upload
+		struct UploadFilePartRange
+		{
+			/// @brief Zero-based index of the part in the upload session
+			std::int32_t FilePart = 0;
+			/// @brief File the bytes of the part are read from
+			Modio::filesystem::path FilePath {};
+			/// @brief Location of the first byte of the part in FilePath
+			std::uintmax_t FileOffset = 0;
+			/// @brief Location of the first byte of the part in the complete upload
+			std::uintmax_t UploadOffset = 0;
+			/// @brief Number of bytes in the part
+			std::uintmax_t Size = 0;
+			/// @brief Size of the complete upload, empty while the upload is still being produced
+			Modio::Optional<std::uintmax_t> UploadTotalSize {};
+
+			/// @brief Range of a part of a file that is uploaded as a whole
+			static UploadFilePartRange FromFile(Modio::filesystem::path FilePath, std::int32_t FilePart,
+												std::uintmax_t FileSize)
+			{
+				std::uintmax_t MaxFilePart = Modio::Detail::Constants::Configuration::MultipartMaxFilePartSize;
+				UploadFilePartRange Range;
+				Range.FilePart = FilePart;
+				Range.FilePath = FilePath;
+				Range.FileOffset = FilePart * MaxFilePart;
+				Range.UploadOffset = Range.FileOffset;
+				// If the part exceeds the number of bytes remaining in the file, it only holds that portion
+				Range.Size = Range.FileOffset < FileSize ? std::min(MaxFilePart, FileSize - Range.FileOffset) : 0;
+				Range.UploadTotalSize = FileSize;
+				return Range;
+			}
+		};
+
 		class UploadFilePartOp
 		{
 			Modio::StableStorage<Modio::Detail::HttpRequest> Request {};
@@ -40,16 +76,21 @@ namespace Modio
 			std::uintmax_t FileSize = 0;
 			// The number of bytes that will be sent over the wire
 			std::uintmax_t BytesToSend = 0;
+			// The number of bytes in the chunk most recently written to the request
+			std::uintmax_t ChunkBytes = 0;
 			// The number of bytes that have already been sent over the wire
 			std::uintmax_t BytesProcessed = 0;
+			// Shared with the caller, which accounts for the bytes sent by this attempt in the progress and rolls them
+			// back if it needs to retry. Counted even while the progress belongs to the compression
+			std::shared_ptr<std::uintmax_t> BytesReported {};
 
 		public:
 			UploadFilePartOp(Modio::Detail::DynamicBuffer Response, Modio::Detail::HttpRequestParams BasicParams,
-				Modio::filesystem::path FilePath, std::int32_t FilePart,
-				std::shared_ptr<Modio::Detail::UploadSession> UploadSession,
+				UploadFilePartRange Part, std::shared_ptr<Modio::Detail::UploadSession> UploadSession,
 				Modio::Detail::OperationQueue::Ticket RequestTicket,
-				std::weak_ptr<Modio::ModProgressInfo> ProgressInfo)
-				: Session(UploadSession)
+				std::weak_ptr<Modio::ModProgressInfo> ProgressInfo, std::shared_ptr<std::uintmax_t> BytesReported)
+				: Session(UploadSession),
+				  BytesReported(BytesReported)
 			{
 				if (UploadSession->UploadID.has_value() == false)
 				{
@@ -62,13 +103,11 @@ namespace Modio
 				Impl->ProgressInfo = ProgressInfo;
 				ResponseBuffer = Response;
 				this->AllowCachedResponse = Modio::Detail::CachedResponse::Disallow;
-				ArchiveFile = std::make_unique<Modio::Detail::File>(FilePath, Modio::Detail::FileMode::ReadOnly, false);
-				std::uintmax_t MaxFilePart = Modio::Detail::Constants::Configuration::MultipartMaxFilePartSize;
-				FileOffset = FilePart * MaxFilePart;
+				ArchiveFile = std::make_unique<Modio::Detail::File>(Part.FilePath, Modio::Detail::FileMode::ReadOnly, false);
+				FileOffset = Part.FileOffset;
 				FileSize = ArchiveFile->GetFileSize();
-				// We need to know how many bytes this operation will process. If it exceeds the number
-				// of bytes remaining in the file, it would only send that portion, otherwise MaxFilePart
-				BytesToSend = FileOffset + MaxFilePart > FileSize ? FileSize - FileOffset : MaxFilePart;
+				// We need to know how many bytes this operation will process
+				BytesToSend = Part.Size;
 				// The number of bytes that have already been sent over the wire, start at zero always
 				BytesProcessed = 0;
 
@@ -81,9 +120,10 @@ namespace Modio
 					.AppendPayloadValue("upload_id", UploadSession->UploadID.value());
 
 				// It has "BytesToRead - 1" because the server counts the "0" byte
-				RequestParams.SetContentRange(Modio::FileOffset(FileOffset),
-					Modio::FileOffset(FileOffset + BytesToSend - 1),
-					Modio::FileOffset(FileSize));
+				RequestParams.SetContentRange(Modio::FileOffset(Part.UploadOffset),
+					Modio::FileOffset(Part.UploadOffset + BytesToSend - 1),
+					Part.UploadTotalSize ? Modio::Optional<Modio::FileOffset>(Modio::FileOffset(*Part.UploadTotalSize))
+										 : Modio::Optional<Modio::FileOffset> {});
 
 				Request = std::make_shared<Modio::Detail::HttpRequest>(RequestParams);
 			}
@@ -119,15 +159,16 @@ namespace Modio
 						return;
 					}
 
-					if (FileOffset > FileSize)
+					if (FileOffset + BytesToSend > FileSize)
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-							"Multipart part upload with offset: {} exceeds file size: {}",
-							FileOffset, FileSize);
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+									"Multipart part upload with offset: {} and size: {} exceeds file size: {}",
+									FileOffset, BytesToSend, FileSize);
 						Self.complete(make_error_code(Modio::GenericError::EndOfFile));
 						return;
 					}
 
+					Impl->SendTime = std::chrono::steady_clock::now();
 					yield Request->SendAsync(std::move(Self));
 
 					if (ec)
@@ -154,8 +195,9 @@ namespace Modio
 							return;
 						}
 
-						BytesProcessed += FileChunk.value().GetSize();
-						FileOffset += FileChunk.value().GetSize();
+						ChunkBytes = FileChunk.value().GetSize();
+						BytesProcessed += ChunkBytes;
+						FileOffset += ChunkBytes;
 
 						yield Request->WriteSomeAsync(std::move(FileChunk.value()), std::move(Self));
 
@@ -165,13 +207,22 @@ namespace Modio
 							return;
 						}
 
+						if (BytesReported)
+						{
+							*BytesReported += ChunkBytes;
+						}
+
 						std::shared_ptr<Modio::ModProgressInfo> Progress = Impl->ProgressInfo.lock();
-						if (Progress)
+						// When parts are uploaded while the archive is still being compressed, the progress belongs
+						// to the compression until the upload takes over
+						if (Progress &&
+							Progress->GetCurrentState() == Modio::ModProgressInfo::EModProgressState::Uploading)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-								"Multipart upload bytes uploaded {} of {} total bytes",
-								FileOffset, FileSize);
-							SetCurrentProgress(*Progress.get(), Modio::FileSize(FileOffset));
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+										"Multipart upload bytes uploaded {} of {} total bytes", FileOffset, FileSize);
+							// Several parts may be in flight at once, so report the bytes this chunk added rather
+							// than an absolute offset
+							IncrementCurrentProgress(*Progress.get(), Modio::FileSize(ChunkBytes));
 						}
 					}
 
@@ -248,9 +299,8 @@ namespace Modio
 						}
 					}
 
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-						"Multipart upload_id {} bytes sent: {}", Session->UploadID.value(),
-						FileOffset);
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Multipart upload_id {} bytes sent: {}",
+								Session->UploadID.value(), FileOffset);
 
 					// We only need to read the response when debugging with the server
 					yield Request->ReadSomeFromResponseBodyAsync(ResponseBuffer, std::move(Self));
@@ -261,10 +311,12 @@ namespace Modio
 						return;
 					}
 
-					Modio::Detail::Logger().Log(
-						Modio::LogLevel::Trace, Modio::LogCategory::Http,
-						"UploadFilePartOp sent a part with upload_id: {}, response code {} of size {}:",
-						Session->UploadID.value(), Request->GetResponseCode(), ResponseBuffer.size());
+					Modio::Detail::RuntimeStatsCollector::Get().RecordHttpLatency(
+						Modio::Detail::HttpEndpointClass::Upload, std::chrono::steady_clock::now() - Impl->SendTime);
+
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+								"UploadFilePartOp sent a part with upload_id: {}, response code {} of size {}:",
+								Session->UploadID.value(), Request->GetResponseCode(), ResponseBuffer.size());
 
 					// All parts of the file were uploaded as expected
 					Self.complete({});
@@ -275,15 +327,16 @@ namespace Modio
 
 		template<typename CompletionTokenType>
 		auto UploadFilePartAsync(Modio::Detail::DynamicBuffer Response,
-			Modio::Detail::HttpRequestParams RequestParameters, Modio::filesystem::path FilePath,
-			int FilePart, std::shared_ptr<Modio::Detail::UploadSession> Session,
-			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo, CompletionTokenType&& Token)
+			Modio::Detail::HttpRequestParams RequestParameters, UploadFilePartRange Part,
+			std::shared_ptr<Modio::Detail::UploadSession> Session,
+			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo, std::shared_ptr<std::uintmax_t> BytesReported,
+			CompletionTokenType&& Token)
 		{
 			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
 				UploadFilePartOp(
-					Response, RequestParameters, FilePath, FilePart, Session,
+					Response, RequestParameters, Part, Session,
 					Modio::Detail::Services::GetGlobalService<Modio::Detail::HttpService>().GetFileDownloadTicket(),
-					ProgressInfo),
+					ProgressInfo, BytesReported),
 				Token, Modio::Detail::Services::GetGlobalContext().get_executor());
 		}
 	} // namespace Detail
@@ -17,10 +17,14 @@
 #include "modio/detail/http/PerformRequestImpl.h"
 #include "modio/detail/entities/ModioUploadPart.h"
 #include "modio/detail/entities/ModioUploadSession.h"
-#include "modio/detail/ops/upload/UploadFilePartOp.h"
+#include "modio/detail/Function2Wrapper.h"
+#include "modio/detail/compression/zip/ArchivePartSpool.h"
 #include "modio/detail/ops/upload/Multipart/MultipartGetSessionOp.h"
 #include "modio/detail/ops/upload/Multipart/MultipartGetUploadedOp.h"
+#include "modio/detail/ops/upload/Multipart/MultipartUploadPartOp.h"
 #include "modio/detail/serialization/ModioUploadSessionSerialization.h"
+#include <algorithm>
+#include <map>
 
 MODIO_DIAGNOSTIC_PUSH
 MODIO_ALLOW_DEPRECATED_SYMBOLS
@@ -32,10 +36,74 @@ namespace Modio
 	{
 		class UploadMultipartFileOp
 		{
+			/// @brief Book-keeping for the parts currently being uploaded. Shared with the completion handlers of those
+			/// parts, so they can report back regardless of where this operation has been moved to
+			class PartsInFlightState
+			{
+				fu2::unique_function<void()> Waiter {};
+
+			public:
+				std::uint32_t NumInFlight = 0;
+				// The first error reported by a part, once set no further parts are started
+				Modio::ErrorCode FirstError {};
+				// Bytes sent so far by each spooled part in flight, keyed by part index
+				std::map<int, std::shared_ptr<std::uintmax_t>> BytesSentByPart {};
+
+				/// @brief Suspends the operation until the next part in flight completes
+				template<typename OperationType>
+				void WaitForPartCompletionAsync(OperationType&& Operation)
+				{
+					Waiter = std::forward<OperationType>(Operation);
+				}
+
+				void OnPartComplete(int FilePart, Modio::ErrorCode ec)
+				{
+					NumInFlight--;
+					BytesSentByPart.erase(FilePart);
+					if (ec && !FirstError)
+					{
+						Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Http,
+													"Multipart upload of part {} failed: {}", FilePart + 1,
+													ec.message());
+						FirstError = ec;
+					}
+
+					Notify();
+				}
+
+				/// @return The number of bytes sent by the spooled parts still in flight
+				std::uint64_t GetBytesSentInFlight() const
+				{
+					std::uint64_t BytesSent = 0;
+					for (const auto& Part : BytesSentByPart)
+					{
+						BytesSent += *Part.second;
+					}
+					return BytesSent;
+				}
+
+				/// @brief Resumes the operation if it is waiting
+				void Notify()
+				{
+					if (Waiter)
+					{
+						ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(),
+										std::move(Waiter));
+						Waiter = nullptr;
+					}
+				}
+			};
+
 			// Keeps track of the upload number
 			int FilePart = 0;
 			// A calculated number of parts related to the file size
 			int NumParts = 0;
+			// The number of parts that may be uploaded concurrently
+			std::uint32_t MaxPartsInFlight = 1;
+			std::uint64_t ArchiveFileSize = 0;
+			// Set once the spooled upload has taken over the progress reporting from the compression
+			bool bReportingUploadProgress = false;
+			std::shared_ptr<PartsInFlightState> PartsInFlight {};
 			Modio::Detail::HttpRequestParams OpenSessionRequest {};
 			Modio::StableStorage<Modio::Detail::HttpRequest> CloseSessionRequest {};
 			Modio::Detail::DynamicBuffer ResponseBuffer {};
@@ -44,6 +112,9 @@ namespace Modio
 			std::shared_ptr<Modio::Detail::UploadSessionPartList> SessionParts {};
 			Modio::ModID ModID {};
 			Modio::filesystem::path ArchivePath {};
+			// When set, the parts are taken from this spool as the archive is being written rather than from
+			// ArchivePath
+			std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool {};
 			Modio::Detail::OperationQueue::Ticket RequestTicket;
 			std::weak_ptr<Modio::ModProgressInfo> ProgressInfo {};
 			ModioAsio::coroutine Coroutine {};
@@ -52,9 +123,11 @@ namespace Modio
 			UploadMultipartFileOp(std::shared_ptr<Modio::Detail::UploadSession> ResponseSession,
 								  Modio::ModID CurrentModID, Modio::filesystem::path ArchivePath, std::string FileHash,
 								  Modio::Detail::OperationQueue::Ticket RequestTicket,
-								  std::weak_ptr<Modio::ModProgressInfo> ProgressInfo)
+								  std::weak_ptr<Modio::ModProgressInfo> ProgressInfo,
+								  std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool = nullptr)
 				: ModID(CurrentModID),
 				  ArchivePath(ArchivePath),
+				  Spool(Spool),
 				  RequestTicket(std::move(RequestTicket)),
 				  ProgressInfo(ProgressInfo)
 			{
@@ -76,6 +149,9 @@ namespace Modio
 						.SetModID(CurrentModID);
 				CloseSessionRequest = std::make_shared<Modio::Detail::HttpRequest>(ParamsRequest);
 				SessionParts = std::make_shared<Modio::Detail::UploadSessionPartList>();
+				PartsInFlight = std::make_shared<PartsInFlightState>();
+				MaxPartsInFlight = std::max<std::uint32_t>(
+					1, Modio::Detail::SDKSessionData::GetMultipartUploadConcurrency());
 			}
 
 			template<typename CoroType>
@@ -105,7 +181,8 @@ namespace Modio
 					}
 
 					// Confirm the file exists in the system
-					if (Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(
+					if (Spool == nullptr &&
+						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(
 							ArchivePath) == false)
 					{
 						Self.complete(Modio::make_error_code(Modio::FilesystemError::FileNotFound));
@@ -166,9 +243,9 @@ namespace Modio
 
 						if (Session->UploadStatus == UploadSession::Status::Completed)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-														"Multipart upload session {} has been completed already",
-														Session->UploadID.value());
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+										"Multipart upload session {} has been completed already",
+										Session->UploadID.value());
 							Self.complete({});
 							return;
 						}
@@ -187,69 +264,62 @@ namespace Modio
 						}
 					}
 
-					// With a successful UploadID, then calculate the number of parts to upload based on
-					// the current file size
+					if (Spool)
+					{
+						// Parts become available as the archive is being written. The progress is reported by the
+						// compression until the spool is closed
+						Spool->SetReaderNotifier([State = PartsInFlight]() { State->Notify(); });
+					}
+					else
 					{
-						std::uint64_t FileSize =
+						// With a successful UploadID, then calculate the number of parts to upload based on
+						// the current file size
+						ArchiveFileSize =
 							Modio::Detail::File(ArchivePath, Modio::Detail::FileMode::ReadOnly, false).GetFileSize();
 						// Make sure that NumParts nears to the next integer
-						NumParts = 1 + static_cast<int>(FileSize / Constants::Configuration::MultipartMaxFilePartSize);
-                        
-                        // Report to the ProgressInfo that the TotalDownloadSize would be the FileSize
-                        std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
-                        if (Progress)
-                        {
-							SetState(*Progress.get(), Modio::ModProgressInfo::EModProgressState::Uploading);
-							SetTotalProgress(*Progress.get(), Modio::ModProgressInfo::EModProgressState::Uploading,
-											 Modio::FileSize(FileSize));
-						}
+						NumParts = 1 + static_cast<int>(ArchiveFileSize /
+														Constants::Configuration::MultipartMaxFilePartSize);
+
+						// Report to the ProgressInfo that the TotalDownloadSize would be the FileSize
+						BeginUploadProgress(ArchiveFileSize);
 					}
 
-					// #2: Upload every part of the file
-					while (FilePart < NumParts)
+					// #2: Upload every part of the file, keeping up to MaxPartsInFlight parts in flight at once.
+					// The server accepts parts in any order as each carries its own Content-Range
+					while (HasPartsRemaining() || PartsInFlight->NumInFlight > 0)
 					{
-						// We need to check for FilePart + 1 because the server counts from 1, whereas FilePart counts
-						// from 0
-						if (ContainsPart(*SessionParts, FilePart + 1) == true)
+						if (Spool)
 						{
-							// Advance the progress by the amount of bytes the part already has in the server
-							std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
-							if (Progress)
-							{
-								std::uintmax_t MaxFilePart =
-									Modio::Detail::Constants::Configuration::MultipartMaxFilePartSize;
-								Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-															"Part {} already uploaded, advancing the ModProgressInfo",
-															FilePart);
-								SetCurrentProgress(*Progress.get(), Modio::FileSize(MaxFilePart * (FilePart + 1)));
-							}
-
-							// Increase the part to process next
-							FilePart += 1;
-							continue;
+							LaunchPendingSpooledParts();
+						}
+						else
+						{
+							LaunchPendingParts();
 						}
 
-						// This section means that this part needs to upload
-						yield Modio::Detail::UploadFilePartAsync(
-							ResponseBuffer,
-							Modio::Detail::AddMultipartUploadPartRequest
-								.SetGameID(Modio::Detail::SDKSessionData::CurrentGameID())
-								.SetModID(ModID)
-								// A "AddMultipartUploadPartRequest" needs the upload_id as part of the
-								// URL parameters
-								.AddQueryParamRaw("upload_id", Session->UploadID.value()),
-							ArchivePath, FilePart, Session, ProgressInfo, std::move(Self));
-
-						if (ec)
+						// Once a part has failed no more parts are started, but the ones already in flight are
+						// allowed to finish before reporting the error
+						if (PartsInFlight->FirstError && PartsInFlight->NumInFlight == 0)
 						{
 							// Make sure any connection error would clear the upload_id to any caller of this operation
 							Session->UploadID = {};
-							Self.complete(ec);
+							Self.complete(PartsInFlight->FirstError);
 							return;
 						}
 
-						// Increase the part to process next
-						FilePart += 1;
+						// Wait for a part to finish or, when the archive is still being written, for the next one to
+						// become available
+						if (PartsInFlight->NumInFlight > 0 || HasPartsRemaining())
+						{
+							yield PartsInFlight->WaitForPartCompletionAsync(std::move(Self));
+						}
+					}
+
+					if (PartsInFlight->FirstError)
+					{
+						Session->UploadID = {};
+						Self.complete(PartsInFlight->FirstError);
+						return;
 					}
 
 					// #3: Finalize the "Upload Session"
@@ -280,9 +350,8 @@ namespace Modio
 
 						if (CloseSessionRequest->GetResponseCode() == 415)
 						{
-							Modio::Detail::Logger().Log(
-								Modio::LogLevel::Trace, Modio::LogCategory::Http,
-								"Complete Request requires a Content-Type x-www-form-urlencoded");
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+										"Complete Request requires a Content-Type x-www-form-urlencoded");
 							Self.complete(Modio::make_error_code(Modio::HttpError::RequestError));
 							return;
 						}
@@ -295,11 +364,11 @@ namespace Modio
 							return;
 						}
 
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"UploadMultipartFileOp CloseSessionRequest with upload_id: {}, "
-													"response code {} of size {}:",
-													Session->UploadID.value(), CloseSessionRequest->GetResponseCode(),
-													ResponseBuffer.size());
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+									"UploadMultipartFileOp CloseSessionRequest with upload_id: {}, "
+									"response code {} of size {}:",
+									Session->UploadID.value(), CloseSessionRequest->GetResponseCode(),
+									ResponseBuffer.size());
 
 					}
 
@@ -309,6 +378,147 @@ namespace Modio
 			}
 
 		private:
+			bool HasPartsRemaining() const
+			{
+				if (Spool)
+				{
+					return !Spool->IsClosed() || Spool->HasReadyParts();
+				}
+				return FilePart < NumParts;
+			}
+
+			void BeginUploadProgress(std::uint64_t TotalSize)
+			{
+				std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
+				if (Progress)
+				{
+					SetState(*Progress.get(), Modio::ModProgressInfo::EModProgressState::Uploading);
+					SetTotalProgress(*Progress.get(), Modio::ModProgressInfo::EModProgressState::Uploading,
+									 Modio::FileSize(TotalSize));
+				}
+			}
+
+			/// @brief Spooled counterpart of LaunchPendingParts, uploading parts of the archive as they are written
+			void LaunchPendingSpooledParts()
+			{
+				if (Spool->GetError() && !PartsInFlight->FirstError)
+				{
+					PartsInFlight->FirstError = Spool->GetError();
+				}
+
+				// Once the archive is complete its size is known, and the upload takes over the progress reporting.
+				// The bytes sent until then are reported once here, afterwards each part reports its own chunks
+				if (Spool->IsClosed() && !bReportingUploadProgress)
+				{
+					bReportingUploadProgress = true;
+					ArchiveFileSize = Spool->GetTotalSize().value_or(0);
+					BeginUploadProgress(ArchiveFileSize);
+					std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
+					if (Progress)
+					{
+						IncrementCurrentProgress(
+							*Progress.get(),
+							Modio::FileSize(Spool->GetBytesReleased() + PartsInFlight->GetBytesSentInFlight()));
+					}
+				}
+
+				while (PartsInFlight->NumInFlight < MaxPartsInFlight && !PartsInFlight->FirstError)
+				{
+					Modio::Optional<Modio::Detail::ArchivePartSpool::SpooledPart> Part = Spool->TakeReadyPart();
+					if (!Part.has_value())
+					{
+						break;
+					}
+
+					if (ContainsPart(*SessionParts, Part->Index + 1) == true)
+					{
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Part {} already uploaded",
+									Part->Index);
+						Spool->ReleasePart(Part.value());
+						// Before the upload reports progress, released parts are accounted for when it takes over
+						std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
+						if (Progress && bReportingUploadProgress)
+						{
+							IncrementCurrentProgress(*Progress.get(), Modio::FileSize(Part->Size));
+						}
+						continue;
+					}
+
+					Modio::Detail::UploadFilePartRange Range;
+					Range.FilePart = Part->Index;
+					Range.FilePath = Part->FilePath;
+					Range.FileOffset = 0;
+					Range.UploadOffset = Part->ArchiveOffset;
+					Range.Size = Part->Size;
+					if (Modio::Optional<std::uint64_t> TotalSize = Spool->GetTotalSize())
+					{
+						Range.UploadTotalSize = TotalSize.value();
+					}
+
+					PartsInFlight->NumInFlight++;
+					std::shared_ptr<std::uintmax_t> BytesSent = std::make_shared<std::uintmax_t>(0);
+					PartsInFlight->BytesSentByPart[Part->Index] = BytesSent;
+					Modio::Detail::MultipartUploadPartAsync(
+						Modio::Detail::AddMultipartUploadPartRequest
+							.SetGameID(Modio::Detail::SDKSessionData::CurrentGameID())
+							.SetModID(ModID)
+							.AddQueryParamRaw("upload_id", Session->UploadID.value()),
+						Range, Session, ProgressInfo, BytesSent,
+						[State = PartsInFlight, PartSpool = Spool, SpooledPart = Part.value()](Modio::ErrorCode ec) {
+							// The part file is no longer needed whether or not it was uploaded, and releasing it lets
+							// the compression continue
+							PartSpool->ReleasePart(SpooledPart);
+							State->OnPartComplete(SpooledPart.Index, ec);
+						});
+				}
+			}
+
+			/// @brief Starts uploading parts until the concurrency window is full, skipping parts the server already has
+			void LaunchPendingParts()
+			{
+				while (FilePart < NumParts && PartsInFlight->NumInFlight < MaxPartsInFlight && !PartsInFlight->FirstError)
+				{
+					int PartToUpload = FilePart;
+					// Increase the part to process next
+					FilePart += 1;
+
+					// We need to check for PartToUpload + 1 because the server counts from 1, whereas FilePart counts
+					// from 0
+					if (ContainsPart(*SessionParts, PartToUpload + 1) == true)
+					{
+						// Advance the progress by the amount of bytes the part already has in the server
+						std::shared_ptr<Modio::ModProgressInfo> Progress = ProgressInfo.lock();
+						if (Progress)
+						{
+							std::uint64_t MaxFilePart = Modio::Detail::Constants::Configuration::MultipartMaxFilePartSize;
+							std::uint64_t PartOffset = MaxFilePart * PartToUpload;
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+										"Part {} already uploaded, advancing the ModProgressInfo", PartToUpload);
+							IncrementCurrentProgress(
+								*Progress.get(),
+								Modio::FileSize(PartOffset < ArchiveFileSize
+													? std::min(MaxFilePart, ArchiveFileSize - PartOffset)
+													: 0));
+						}
+						continue;
+					}
+
+					PartsInFlight->NumInFlight++;
+					Modio::Detail::MultipartUploadPartAsync(
+						Modio::Detail::AddMultipartUploadPartRequest
+							.SetGameID(Modio::Detail::SDKSessionData::CurrentGameID())
+							.SetModID(ModID)
+							// A "AddMultipartUploadPartRequest" needs the upload_id as part of the
+							// URL parameters
+							.AddQueryParamRaw("upload_id", Session->UploadID.value()),
+						Modio::Detail::UploadFilePartRange::FromFile(ArchivePath, PartToUpload, ArchiveFileSize), Session,
+						ProgressInfo, std::make_shared<std::uintmax_t>(0),
+						[State = PartsInFlight, PartToUpload](Modio::ErrorCode ec) {
+							State->OnPartComplete(PartToUpload, ec);
+						});
+				}
+			}
+
 			// Iterate over "UploadSessionPartList" to check if any equals the "Part" variable
 			static bool ContainsPart(Modio::Detail::UploadSessionPartList Parts, std::uint32_t Part)
 			{
@@ -341,6 +551,23 @@ namespace Modio
 					ProgressInfo),
 				Token, Modio::Detail::Services::GetGlobalContext().get_executor());
 		}
+
+		/// @brief Uploads an archive through a multipart session while it is still being written to Spool. Each part is
+		/// uploaded as soon as the spool hands it over, and its file is released once it is done
+		/// @param ArchivePath Path whose file name is used for the upload session. The file itself is never read
+		template<typename CompletionTokenType>
+		auto UploadMultipartSpoolAsync(std::shared_ptr<Modio::Detail::UploadSession> Response,
+									   Modio::ModID CurrentModID, Modio::filesystem::path ArchivePath,
+									   std::string FileHash, std::shared_ptr<Modio::Detail::ArchivePartSpool> Spool,
+									   std::weak_ptr<Modio::ModProgressInfo> ProgressInfo, CompletionTokenType&& Token)
+		{
+			return ModioAsio::async_compose<CompletionTokenType, void(Modio::ErrorCode)>(
+				UploadMultipartFileOp(
+					std::move(Response), CurrentModID, ArchivePath, FileHash,
+					Modio::Detail::Services::GetGlobalService<Modio::Detail::HttpService>().GetFileDownloadTicket(),
+					ProgressInfo, Spool),
+				Token, Modio::Detail::Services::GetGlobalContext().get_executor());
+		}
 	} // namespace Detail
 } // namespace Modio
 
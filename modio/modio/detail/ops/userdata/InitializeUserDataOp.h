@@ -32,61 +32,63 @@ namespace Modio
 			{
 				reenter(CoroutineState)
 				{
-					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::User,
-													"Loading user data");
+					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::User, "Loading user data");
+
+					RootPath = Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().UserDataFolder();
 
-						RootPath =
-							Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().UserDataFolder();
+					// user.bin is the fast path. user.json is written alongside it, and is also the only file saved by
+					// earlier versions of the SDK, so it is read whenever user.bin is missing or cannot be loaded
+					for (bReadingExport = false;; bReadingExport = true)
+					{
+						UserDataPath = RootPath / (bReadingExport ? "user.json" : "user.bin");
 						if (Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().FileExists(
-								RootPath / "user.json"))
+								UserDataPath))
 						{
 							DestinationFile = std::make_unique<Modio::Detail::File>(
-								RootPath / "user.json", Modio::Detail::FileMode::ReadOnly, false);
+								UserDataPath, Modio::Detail::FileMode::ReadOnly, false);
 
 							yield DestinationFile->ReadAsync(DestinationFile->GetFileSize(), DataBuffer,
 															 std::move(Self));
+							DestinationFile.reset();
 							if (ec)
 							{
-								Self.complete(ec);
-								return;
+								Modio::Detail::Logger().Log(Modio::LogLevel::Warning, Modio::LogCategory::User,
+															"Could not read {}: {}", UserDataPath.string(),
+															ec.message());
 							}
-							else
+							else if (DataBuffer.size() > 0)
 							{
-								if (DataBuffer.size() > 0)
-								{
-									Modio::Detail::Buffer CollatedBuffer(DataBuffer.size());
-									Modio::Detail::BufferCopy(CollatedBuffer, DataBuffer);
-									if (Modio::Detail::SDKSessionData::DeserializeUserDataFromBuffer(
-											std::move(CollatedBuffer)))
-									{
-										Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::User,
-																	"User Data Loaded");
-									}
-									else
-									{
-										Modio::Detail::Logger().Log(
-											Modio::LogLevel::Trace, Modio::LogCategory::User,
-											"User Data file present but not valid. Initializing to default state");
-									}
-								}
-								else
+								Modio::Detail::Buffer CollatedBuffer(DataBuffer.size());
+								Modio::Detail::BufferCopy(CollatedBuffer, DataBuffer);
+								if (Modio::Detail::SDKSessionData::DeserializeUserDataFromBuffer(
+										std::move(CollatedBuffer)))
 								{
-									Modio::Detail::Logger().Log(
-										Modio::LogLevel::Info, Modio::LogCategory::User,
-										"User data file not readable or zero-length. Initializing to default state");
+									Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::User,
+																"User Data Loaded");
+									Self.complete({});
+									return;
 								}
-								Self.complete({});
-								return;
+								Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::User,
+															"User data file {} present but not valid",
+															UserDataPath.string());
 							}
+							else
+							{
+								Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::User,
+															"User data file {} not readable or zero-length",
+															UserDataPath.string());
+							}
+							DataBuffer.Clear();
 						}
-						else
+
+						if (bReadingExport)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::User,
-														"User data file not found. Initializing to default state");
+							break;
 						}
 					}
 
+					Modio::Detail::Logger().Log(Modio::LogLevel::Info, Modio::LogCategory::User,
+												"No valid user data file found. Initializing to default state");
 					Self.complete({});
 					return;
 				}
@@ -98,6 +100,8 @@ namespace Modio
 			std::unique_ptr<Modio::Detail::File> DestinationFile {};
 			Modio::Detail::DynamicBuffer DataBuffer {};
 			Modio::filesystem::path RootPath {};
+			Modio::filesystem::path UserDataPath {};
+			bool bReadingExport = false;
 		};
 	} // namespace Detail
 } // namespace Modio
@@ -58,7 +58,7 @@ namespace Modio
 					{
 						// Got the response OK, try to marshal to the expected type
 						Modio::Optional<Modio::GameInfoList> List =
-							TryMarshalResponse<Modio::GameInfoList>(ResponseBodyBuffer);
+							TryMarshalListResponse<Modio::GameInfoList>(ResponseBodyBuffer);
 						// Marshalled OK
 						if (List.has_value())
 						{
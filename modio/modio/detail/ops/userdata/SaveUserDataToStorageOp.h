@@ -29,6 +29,8 @@ namespace Modio
 
 				LocalState->UserDataBuffer =
 					std::make_unique<Modio::Detail::Buffer>(Modio::Detail::SDKSessionData::SerializeUserData());
+				LocalState->UserDataExportBuffer =
+					std::make_unique<Modio::Detail::Buffer>(Modio::Detail::SDKSessionData::ExportUserData());
 			}
 
 			SaveUserDataToStorageOp(SaveUserDataToStorageOp&& Other)
@@ -41,10 +43,25 @@ namespace Modio
 			{
 				reenter(CoroutineState)
 				{
+					// user.json is only read if user.bin is missing or damaged, but is written first so it is never
+					// older than user.bin
 					LocalState->UserDataFile = std::make_unique<Modio::Detail::File>(
 						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().UserDataFolder() /
 							"user.json",
 						Modio::Detail::FileMode::ReadWrite, true);
+					yield LocalState->UserDataFile->WriteAsync(std::move(*LocalState->UserDataExportBuffer),
+															   std::move(Self));
+					LocalState->UserDataFile.reset();
+					if (ec)
+					{
+						Self.complete(ec);
+						return;
+					}
+
+					LocalState->UserDataFile = std::make_unique<Modio::Detail::File>(
+						Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().UserDataFolder() /
+							"user.bin",
+						Modio::Detail::FileMode::ReadWrite, true);
 					yield LocalState->UserDataFile->WriteAsync(std::move(*LocalState->UserDataBuffer), std::move(Self));
 
 					LocalState->UserDataFile.reset();
@@ -60,6 +77,7 @@ namespace Modio
 			{
 				std::unique_ptr<Modio::Detail::File> UserDataFile {};
 				std::unique_ptr<Modio::Detail::Buffer> UserDataBuffer {};
+				std::unique_ptr<Modio::Detail::Buffer> UserDataExportBuffer {};
 			};
 
 			Modio::StableStorage<Impl> LocalState {};
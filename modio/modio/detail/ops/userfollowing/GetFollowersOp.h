@@ -12,6 +12,7 @@
 
 #include "modio/detail/ops/http/PerformRequestAndGetResponseOp.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioJsonStreaming.h"
 #include "modio/core/entities/ModioUserList.h"
 
 #include <asio/yield.hpp>
@@ -48,7 +49,7 @@ namespace Modio::Detail
 						}
 
 						Modio::Optional<Modio::UserList> List =
-							TryMarshalResponse<Modio::UserList>(ResponseBodyBuffer);
+							TryMarshalListResponse<Modio::UserList>(ResponseBodyBuffer);
 						if (!List.has_value())
 						{
 							Self.complete(Modio::make_error_code(Modio::HttpError::InvalidResponse), {});
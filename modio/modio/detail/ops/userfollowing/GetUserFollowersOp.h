@@ -50,7 +50,8 @@ namespace Modio::Detail
 							CollatedResults = std::make_unique<Modio::UserList>();
 						}
 
-						Modio::Optional<Modio::UserList> List = TryMarshalResponse<Modio::UserList>(ResponseBodyBuffer);
+						Modio::Optional<Modio::UserList> List =
+							TryMarshalListResponse<Modio::UserList>(ResponseBodyBuffer);
 						if (!List.has_value())
 						{
 							Self.complete(Modio::make_error_code(Modio::HttpError::InvalidResponse), {});
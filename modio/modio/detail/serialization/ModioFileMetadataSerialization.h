@@ -48,6 +48,7 @@ namespace Modio
 		Detail::ParseSafe(Json, FileMetadata.Filesize, "filesize");
 		Detail::ParseSafe(Json, FileMetadata.FilesizeUncompressed, "filesize_uncompressed");
 		Detail::ParseSafe(Json, FileMetadata.Filename, "filename");
+		Detail::ParseSubobjectSafe(Json, FileMetadata.FilehashMD5, "filehash", "md5");
 		Detail::ParseSafe(Json, FileMetadata.Version, "version");
 		Detail::ParseSafe(Json, FileMetadata.Changelog, "changelog");
 		Detail::ParseSafe(Json, FileMetadata.MetadataBlob, "metadata_blob");
@@ -66,6 +67,7 @@ namespace Modio
 				{"filesize", FileMetadata.Filesize},
 				{"filesize_uncompressed", FileMetadata.FilesizeUncompressed},
 				{"filename", FileMetadata.Filename},
+				{"filehash", nlohmann::json::object({{"md5", FileMetadata.FilehashMD5}})},
 				{"version", FileMetadata.Version},
 				{"changelog", FileMetadata.Changelog},
 				{"metadata_blob", FileMetadata.MetadataBlob},
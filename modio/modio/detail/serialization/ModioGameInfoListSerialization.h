@@ -15,6 +15,7 @@
 #include "modio/detail/serialization/ModioGameInfoSerialization.h"
 #include "modio/detail/ModioConstants.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioJsonStreaming.h"
 
 namespace Modio
 {
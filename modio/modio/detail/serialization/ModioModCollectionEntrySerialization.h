@@ -40,6 +40,13 @@ namespace Modio
 		{
 			return Entry.RollbackState;
 		}
+
+		/// @docinternal
+		/// @return The MessagePack encoded profile, empty if the entry has none
+		const std::vector<std::uint8_t>& GetEncodedModProfile() const
+		{
+			return Entry.GetEncodedModProfile();
+		}
 	};
 
 	/// @docinternal
@@ -67,10 +74,19 @@ namespace Modio
 		}
 
 		/// @docinternal
-		/// @return Modio::ModInfo containing mod profile data
-		Modio::ModInfo& GetModProfile()
+		/// @brief Replaces the mod profile without checking it for an update
+		void SetModProfile(const Modio::ModInfo& ProfileData)
+		{
+			Entry.StoreModProfile(ProfileData);
+		}
+
+		/// @docinternal
+		/// @brief Stores a MessagePack encoded profile, which is only decoded once something asks for the profile
+		/// @param EncodedModfileID ID of the modfile in the encoded profile
+		void SetEncodedModProfile(std::vector<std::uint8_t> EncodedProfile,
+								  Modio::Optional<Modio::FileMetadataID> EncodedModfileID)
 		{
-			return Entry.ModProfile;
+			Entry.StoreEncodedModProfile(std::move(EncodedProfile), EncodedModfileID);
 		}
 
 		/// @docinternal
@@ -104,7 +120,9 @@ namespace Modio
 		}
 	};
 
-	inline void to_json(nlohmann::json& j, const Modio::ModCollectionEntry& Entry)
+	/// @docinternal
+	/// @brief Works out the state an entry is saved with
+	inline Modio::ModState GetPersistentModState(const Modio::ModCollectionEntry& Entry)
 	{
 		Modio::ModCollectionEntryConstAccessor Helper(Entry);
 		Modio::ModState EntryState = Helper.CurrentState().load();
@@ -127,30 +145,80 @@ namespace Modio
 				EntryState = Modio::ModState::InstallationPending;
 			}
 		}
+		return EntryState;
+	}
 
-		j = nlohmann::json::object(
-			{{Modio::Detail::Constants::JSONKeys::ModEntryID, Entry.GetID()},
-			 {Modio::Detail::Constants::JSONKeys::ModEntryProfile, Entry.GetModProfile()},
-			 {Modio::Detail::Constants::JSONKeys::ModEntrySubCount, Entry.GetLocalUserSubscriptions()},
-			 {Modio::Detail::Constants::JSONKeys::ModEntryState, EntryState},
-			 {Modio::Detail::Constants::JSONKeys::ModSizeOnDisk, Entry.GetRawSizeOnDisk()},
-			 {Modio::Detail::Constants::JSONKeys::ModPathOnDisk, Entry.GetPath()},
-			 {Modio::Detail::Constants::JSONKeys::ModNeverRetryCode, Entry.GetNeverRetryReason().value()},
-			 {Modio::Detail::Constants::JSONKeys::ModNeverRetryCategory,
-			  Modio::Detail::ModioErrorCategoryID(Entry.GetNeverRetryReason().category())}});
+	/// @docinternal
+	/// @brief Serializes the ID of an entry and the persisted fields named by Fields
+	/// @param Fields ModCollectionEntry::PersistedField flags
+	inline nlohmann::json ModCollectionEntryFieldsToJson(const Modio::ModCollectionEntry& Entry, std::uint32_t Fields)
+	{
+		using PersistedField = Modio::ModCollectionEntry::PersistedField;
+
+		nlohmann::json j = nlohmann::json::object({{Modio::Detail::Constants::JSONKeys::ModEntryID, Entry.GetID()}});
+		if (Fields & PersistedField::Profile)
+		{
+			// Converted straight from the stored encoding, so saving an entry does not leave its profile decoded
+			const std::vector<std::uint8_t>& EncodedProfile =
+				ModCollectionEntryConstAccessor(Entry).GetEncodedModProfile();
+			nlohmann::json ProfileJson =
+				nlohmann::json::from_msgpack(EncodedProfile.begin(), EncodedProfile.end(), true, false);
+			if (EncodedProfile.empty() || ProfileJson.is_discarded())
+			{
+				ProfileJson = Entry.GetModProfile();
+			}
+			j[Modio::Detail::Constants::JSONKeys::ModEntryProfile] = std::move(ProfileJson);
+		}
+		if (Fields & PersistedField::Subscriptions)
+		{
+			j[Modio::Detail::Constants::JSONKeys::ModEntrySubCount] = Entry.GetLocalUserSubscriptions();
+		}
+		if (Fields & PersistedField::State)
+		{
+			j[Modio::Detail::Constants::JSONKeys::ModEntryState] = GetPersistentModState(Entry);
+		}
+		if (Fields & PersistedField::SizeOnDisk)
+		{
+			j[Modio::Detail::Constants::JSONKeys::ModSizeOnDisk] = Entry.GetRawSizeOnDisk();
+		}
+		if (Fields & PersistedField::Path)
+		{
+			j[Modio::Detail::Constants::JSONKeys::ModPathOnDisk] = Entry.GetPath();
+		}
+		if (Fields & PersistedField::NeverRetryReason)
+		{
+			j[Modio::Detail::Constants::JSONKeys::ModNeverRetryCode] = Entry.GetNeverRetryReason().value();
+			j[Modio::Detail::Constants::JSONKeys::ModNeverRetryCategory] =
+				Modio::Detail::ModioErrorCategoryID(Entry.GetNeverRetryReason().category());
+		}
+		return j;
 	}
 
+	inline void to_json(nlohmann::json& j, const Modio::ModCollectionEntry& Entry)
+	{
+		j = ModCollectionEntryFieldsToJson(Entry, Modio::ModCollectionEntry::PersistedField::All);
+	}
+
+	/// @docinternal
+	/// @brief Only the fields present in j are read, so a journal record holding some of the fields of an entry can
+	/// be applied on top of it
 	inline void from_json(const nlohmann::json& j, Modio::ModCollectionEntry& Entry)
 	{
 		Modio::ModCollectionEntryAccessor Helper(Entry);
 		Modio::Detail::ParseSafe(j, Helper.GetID(), Modio::Detail::Constants::JSONKeys::ModEntryID);
-		Modio::Detail::ParseSafe(j, Helper.GetModProfile(), Modio::Detail::Constants::JSONKeys::ModEntryProfile);
+		Modio::ModInfo ProfileData;
+		if (Modio::Detail::ParseSafe(j, ProfileData, Modio::Detail::Constants::JSONKeys::ModEntryProfile))
+		{
+			Helper.SetModProfile(ProfileData);
+		}
 		Modio::Detail::ParseSafe(j, Helper.GetLocalUserSubscriptions(),
 								 Modio::Detail::Constants::JSONKeys::ModEntrySubCount);
 		Modio::Detail::ParseSafe(j, Helper.GetRawSizeOnDisk(), Modio::Detail::Constants::JSONKeys::ModSizeOnDisk);
 		Modio::ModState StateTmp = ModState::InstallationPending;
-		Modio::Detail::ParseSafe(j, StateTmp, Modio::Detail::Constants::JSONKeys::ModEntryState);
-		Helper.GetCurrentState().store(StateTmp);
+		if (Modio::Detail::ParseSafe(j, StateTmp, Modio::Detail::Constants::JSONKeys::ModEntryState))
+		{
+			Helper.GetCurrentState().store(StateTmp);
+		}
 		Modio::Detail::ParseSafe(j, Helper.GetPath(), Modio::Detail::Constants::JSONKeys::ModPathOnDisk);
 		if (j.contains(Modio::Detail::Constants::JSONKeys::ModNeverRetryCode) &&
 			j.contains(Modio::Detail::Constants::JSONKeys::ModNeverRetryCategory))
@@ -13,6 +13,7 @@
 #include "modio/core/entities/ModioModInfo.h"
 #include "modio/detail/JsonWrapper.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioJsonStreaming.h"
 #include "modio/detail/serialization/ModioModCommunityOptionsSerialization.h"
 #include "modio/detail/serialization/ModioGalleryListSerialization.h"
 #include "modio/detail/serialization/ModioModMonetizationSKUSerialization.h"
@@ -23,6 +24,11 @@
 #include "modio/detail/serialization/ModioFileMetadataSerialization.h"
 #include "modio/detail/serialization/ModioUserSerialization.h"
 #include "modio/detail/serialization/ModioStrongIntegerSerialization.h"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
 
 namespace Modio
 {
@@ -70,7 +76,7 @@ namespace Modio
 				}
 				else
 				{
-					ModInfo.FileInfo = FileInfo;
+					ModInfo.FileInfo = std::move(FileInfo);
 				}
 			}
 
@@ -103,15 +109,39 @@ namespace Modio
 			Detail::ParseSafe(Json, ModInfo.ModLogo, "logo");
 		}
 
-		if (Json.contains("media"))
+		if (const nlohmann::json* Media = Detail::FindNonNull(Json, "media"))
 		{
-			Detail::ParseSafe(Json.at("media"), ModInfo.YoutubeURLs.GetRawList(), "youtube");
-			Detail::ParseSafe(Json.at("media"), ModInfo.SketchfabURLs.GetRawList(), "sketchfab");
-			Detail::ParseSafe(Json.at("media"), ModInfo.GalleryImages, "images");
+			Detail::ParseSafe(*Media, ModInfo.YoutubeURLs.GetRawList(), "youtube");
+			Detail::ParseSafe(*Media, ModInfo.SketchfabURLs.GetRawList(), "sketchfab");
+			Detail::ParseSafe(*Media, ModInfo.GalleryImages, "images");
 			ModInfo.NumGalleryImages = ModInfo.GalleryImages.Size();
 		}
 	}
 
+	namespace Detail
+	{
+		/// @docnone
+		/// @brief The keys read by from_json for ModInfo, in sorted order, which has to be kept in step with it. Mod
+		/// objects also carry fields no ModInfo member holds, such as the platforms and the game ID, and those are
+		/// skipped when a list of mods is streamed
+		constexpr std::array<std::string_view, 24> ModInfoJsonKeys = {
+			"community_options", "date_added", "date_live", "date_updated", "dependencies", "description",
+			"description_plaintext", "id", "logo", "maturity_option", "media", "metadata_blob", "metadata_kvp",
+			"modfile", "name", "price", "profile_url", "skus", "stats", "status", "submitted_by", "summary", "tags",
+			"visible"};
+		static_assert(IsSortedKeyList(ModInfoJsonKeys), "ModInfoJsonKeys must be sorted to be binary searched");
+
+		/// @docnone
+		template<>
+		struct JsonStreamedFields<Modio::ModInfo>
+		{
+			static bool IsRead(const std::string& Key)
+			{
+				return std::binary_search(ModInfoJsonKeys.begin(), ModInfoJsonKeys.end(), std::string_view(Key));
+			}
+		};
+	} // namespace Detail
+
 	/// @docnone
 	inline void to_json(nlohmann::json& Json, const Modio::ModInfo& Info)
 	{
@@ -132,7 +162,9 @@ namespace Modio
 							   {"summary", Info.ProfileSummary},
 							   {"status", Info.ModStatus},
 							   {"visible", Info.Visibility},
+							   {"price", Info.Price},
 							   {"dependencies", Info.Dependencies},
+							   {"skus", Info.SKUMappings},
 							   {"stats", Info.Stats},
 							   {"logo", Info.ModLogo},
 							   {"media", nlohmann::json::object({{"youtube", Info.YoutubeURLs.GetRawList()},
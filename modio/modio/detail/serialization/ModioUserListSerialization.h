@@ -13,6 +13,7 @@
 #include "modio/core/entities/ModioUserList.h"
 #include "modio/detail/ModioConstants.h"
 #include "modio/detail/ModioJsonHelpers.h"
+#include "modio/detail/ModioJsonStreaming.h"
 #include "modio/detail/serialization/ModioPagedResultSerialization.h"
 
 namespace Modio
@@ -11,6 +11,9 @@
 #pragma once
 
 #include "modio/detail/AsioWrapper.h"
+#include "modio/detail/ModioIOThreadPool.h"
+#include "modio/detail/ModioRuntimeStats.h"
+#include "modio/detail/ops/RunOnIOStrandOp.h"
 #include "modio/file/ModioFileService.h"
 
 namespace Modio
@@ -21,14 +24,40 @@ namespace Modio
 		{
 			Modio::filesystem::path FilePath {};
 			ModioAsio::strand<ModioAsio::io_context::executor_type> FileStrand;
+			/// @brief Strand of the I/O thread pool the platform operations of this file run on, if there is a pool
+			Modio::Optional<Modio::Detail::IOStrand> IOThreadStrand;
 			Modio::Detail::FileMode Mode {};
 
+			/// @brief Calls Initiation with the service, the implementation and a handler to start a platform operation
+			/// with. The operation runs on IOThreadStrand when there is one, and Token is called on the global
+			/// io_context either way. Specify the results the platform operation completes with after its error code as
+			/// ResultTypes
+			template<typename... ResultTypes, typename InitiationType, typename CompletionTokenType>
+			void StartPlatformOperation(InitiationType Initiation, CompletionTokenType&& Token)
+			{
+				if (IOThreadStrand)
+				{
+					Modio::Detail::RunOnIOStrandAsync<ResultTypes...>(
+						*IOThreadStrand,
+						[&Service = get_service(), Implementation = get_implementation(),
+						 Initiation = std::move(Initiation)](auto Handler) mutable {
+							Initiation(Service, Implementation, std::move(Handler));
+						},
+						std::forward<CompletionTokenType>(Token));
+				}
+				else
+				{
+					Initiation(get_service(), get_implementation(), std::forward<CompletionTokenType>(Token));
+				}
+			}
+
 		public:
 			explicit File(Modio::filesystem::path FilePath, Modio::Detail::FileMode Mode,
 						  bool bOverwriteExisting = false)
 				: ModioAsio::basic_io_object<Modio::Detail::FileService>(Modio::Detail::Services::GetGlobalContext()),
 				  FilePath(FilePath),
 				  FileStrand(ModioAsio::make_strand(Modio::Detail::Services::GetGlobalContext())),
+				  IOThreadStrand(Modio::Detail::IOThreadPool::MakeStrand()),
 				  Mode(Mode)
 			{
 				get_implementation()->SetFileStrand(FileStrand);
@@ -55,6 +84,7 @@ namespace Modio
 				: ModioAsio::basic_io_object<Modio::Detail::FileService>(Context),
 				  FilePath(FilePath),
 				  FileStrand(ModioAsio::make_strand(Context)),
+				  IOThreadStrand(Modio::Detail::IOThreadPool::MakeStrand()),
 				  Mode(Mode)
 			{
 				get_implementation()->SetFileStrand(FileStrand);
@@ -80,6 +110,7 @@ namespace Modio
 				: ModioAsio::basic_io_object<Modio::Detail::FileService>(std::move(Other)),
 				  FilePath(std::move(Other.FilePath)),
 				  FileStrand(std::move(Other.FileStrand)),
+				  IOThreadStrand(std::move(Other.IOThreadStrand)),
 				  Mode(std::move(Other.Mode)) {}
 
 			std::uint64_t GetFileSize()
@@ -116,38 +147,66 @@ namespace Modio
 			template<typename CompletionTokenType>
 			auto WriteSomeAtAsync(std::uintmax_t Offset, Modio::Detail::Buffer Buffer, CompletionTokenType&& Token)
 			{
-				return get_service().WriteSomeAtAsync(get_implementation(), Offset, std::move(Buffer),
-													  std::forward<CompletionTokenType>(Token));
+				Modio::Detail::RuntimeStatsCollector::Get().RecordFileWrite(Buffer.GetSize());
+				return StartPlatformOperation(
+					[Offset, Buffer = std::move(Buffer)](FileService& Service, implementation_type& Implementation,
+														 auto&& Handler) mutable {
+						Service.WriteSomeAtAsync(Implementation, Offset, std::move(Buffer),
+												 std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			template<typename CompletionTokenType>
 			auto ReadSomeAtAsync(std::uintmax_t Offset, std::uintmax_t Length, CompletionTokenType&& Token)
 			{
-				return get_service().ReadSomeAtAsync(get_implementation(), Offset, Length,
-													 std::forward<CompletionTokenType>(Token));
+				Modio::Detail::RuntimeStatsCollector::Get().RecordFileRead(Length);
+				return StartPlatformOperation<Modio::Optional<Modio::Detail::Buffer>>(
+					[Offset, Length](FileService& Service, implementation_type& Implementation, auto&& Handler) {
+						Service.ReadSomeAtAsync(Implementation, Offset, Length,
+												std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			template<typename CompletionTokenType>
 			auto ReadSomeAtAsync(std::uintmax_t Offset, std::uintmax_t MaxBytesToRead,
 								 Modio::Detail::DynamicBuffer Destination, CompletionTokenType&& Token)
 			{
-				return get_service().ReadSomeAtAsync(get_implementation(), Offset, MaxBytesToRead, Destination,
-													 std::forward<CompletionTokenType>(Token));
+				Modio::Detail::RuntimeStatsCollector::Get().RecordFileRead(MaxBytesToRead);
+				return StartPlatformOperation(
+					[Offset, MaxBytesToRead, Destination](FileService& Service, implementation_type& Implementation,
+														  auto&& Handler) {
+						Service.ReadSomeAtAsync(Implementation, Offset, MaxBytesToRead, Destination,
+												std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			template<typename CompletionTokenType>
 			auto ReadAsync(std::uintmax_t MaxBytesToRead, Modio::Detail::DynamicBuffer Destination,
 						   CompletionTokenType&& Token)
 			{
-				return get_service().ReadAsync(get_implementation(), MaxBytesToRead, Destination,
-											   std::forward<CompletionTokenType>(Token));
+				Modio::Detail::RuntimeStatsCollector::Get().RecordFileRead(MaxBytesToRead);
+				return StartPlatformOperation(
+					[MaxBytesToRead, Destination](FileService& Service, implementation_type& Implementation,
+												  auto&& Handler) {
+						Service.ReadAsync(Implementation, MaxBytesToRead, Destination,
+										  std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			template<typename CompletionTokenType>
 			auto WriteAsync(Modio::Detail::Buffer Buffer, CompletionTokenType&& Token)
 			{
-				return get_service().WriteAsync(get_implementation(), std::move(Buffer),
-												std::forward<CompletionTokenType>(Token));
+				Modio::Detail::RuntimeStatsCollector::Get().RecordFileWrite(Buffer.GetSize());
+				return StartPlatformOperation(
+					[Buffer = std::move(Buffer)](FileService& Service, implementation_type& Implementation,
+												 auto&& Handler) mutable {
+						Service.WriteAsync(Implementation, std::move(Buffer), std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 		};
 	} // namespace Detail
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "modio/detail/AsioWrapper.h"
+#include "modio/detail/ModioOperationQueue.h"
 #include "modio/detail/ModioStringHelpers.h"
 #include "modio/core/entities/ModioLogo.h"
 #include "modio/core/entities/ModioAvatar.h"
@@ -29,6 +30,8 @@ namespace Modio
 		public:
 			explicit FileService(ModioAsio::io_context& IOService) : ModioAsio::detail::service_base<FileService>(IOService)
 			{
+				MetadataWriteQueue = std::make_shared<Modio::Detail::OperationQueue>(IOService, "Metadata Write Queue");
+
 				auto NewImplementation = std::make_shared<FileSystemImplementation>(*this);
 				PlatformImplementation.swap(NewImplementation);
 			}
@@ -75,6 +78,14 @@ namespace Modio
 			void Shutdown()
 			{
 				PlatformImplementation->Shutdown();
+				MetadataWriteQueue->CancelAll();
+			}
+
+			/// @brief Operations that update files in the local metadata folder take a ticket from this queue, so
+			/// they never interleave their writes
+			Modio::Detail::OperationQueue::Ticket GetMetadataWriteTicket()
+			{
+				return MetadataWriteQueue->GetTicket();
 			}
 
 			template<typename CompletionHandlerType>
@@ -496,6 +507,7 @@ namespace Modio
 			}
 
 			std::shared_ptr<FileSystemImplementation> PlatformImplementation;
+			std::shared_ptr<Modio::Detail::OperationQueue> MetadataWriteQueue {};
 		};
 	} // namespace Detail
 } // namespace Modio
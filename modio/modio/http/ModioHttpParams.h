@@ -18,6 +18,7 @@
 #include "modio/detail/ModioStringHash.h"
 #include "modio/detail/ModioStringHelpers.h"
 #include "modio/detail/http/ModioRequestBodyKVPContainer.h"
+#include <chrono>
 #include <string_view>
 
 #undef DELETE
@@ -288,6 +289,14 @@ namespace Modio
 
 			MODIO_IMPL HttpRequestParams& SetAuthTokenOverride(const std::string& AuthToken);
 
+			// Keep the cached response to this request for Lifetime instead of the CacheService's expiry time
+			MODIO_IMPL HttpRequestParams SetCacheLifetime(std::chrono::steady_clock::duration Lifetime) const;
+
+			// Keep the cached response to this request for Lifetime instead of the CacheService's expiry time
+			MODIO_IMPL HttpRequestParams& SetCacheLifetime(std::chrono::steady_clock::duration Lifetime);
+
+			MODIO_IMPL Modio::Optional<std::chrono::steady_clock::duration> GetCacheLifetime() const;
+
 			// Suppress sending the X-Modio-Platform header for this request
 			MODIO_IMPL HttpRequestParams SuppressPlatformHeader() const;
 
@@ -301,9 +310,10 @@ namespace Modio
 			// It would enable the HTTP header "Range: bytes=Start-End"
 			MODIO_IMPL HttpRequestParams& SetRange(Modio::FileOffset Start, Modio::Optional<Modio::FileOffset> End);
 
-			// It would enable the HTTP header "ContentRange: bytes Start-End/TotalBytes"
+			// It would enable the HTTP header "ContentRange: bytes Start-End/TotalBytes". An empty TotalBytes is sent
+			// as "*", for when the complete length is not known yet
 			MODIO_IMPL HttpRequestParams& SetContentRange(Modio::FileOffset Start, Modio::FileOffset End,
-														  Modio::FileOffset TotalBytes);
+														  Modio::Optional<Modio::FileOffset> TotalBytes);
 
 			MODIO_IMPL std::string GetServerAddress() const;
 
@@ -418,6 +428,8 @@ namespace Modio
 
 			Modio::Optional<std::string> AuthTokenOverride {};
 
+			Modio::Optional<std::chrono::steady_clock::duration> CacheLifetime {};
+
 			std::string APIKey {};
 
 			// current API key
@@ -434,7 +446,8 @@ namespace Modio
 
 			// Three variables needed to create the header Content-Range
 			// {Start, End, Total}
-			Modio::Optional<std::tuple<Modio::FileOffset, Modio::FileOffset, Modio::FileOffset>> ContentRangeOffsets {};
+			Modio::Optional<std::tuple<Modio::FileOffset, Modio::FileOffset, Modio::Optional<Modio::FileOffset>>>
+				ContentRangeOffsets {};
 
 			Modio::Optional<std::string> UserAgentOverride {};
 
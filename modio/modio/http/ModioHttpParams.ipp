@@ -343,6 +343,26 @@ namespace Modio
 			return NewParamsInstance;
 		}
 
+		Modio::Detail::HttpRequestParams& HttpRequestParams::SetCacheLifetime(
+			std::chrono::steady_clock::duration Lifetime)
+		{
+			CacheLifetime = Lifetime;
+			return *this;
+		}
+
+		Modio::Detail::HttpRequestParams HttpRequestParams::SetCacheLifetime(
+			std::chrono::steady_clock::duration Lifetime) const
+		{
+			HttpRequestParams NewParamsInstance(*this);
+			NewParamsInstance.CacheLifetime = Lifetime;
+			return NewParamsInstance;
+		}
+
+		Modio::Optional<std::chrono::steady_clock::duration> HttpRequestParams::GetCacheLifetime() const
+		{
+			return CacheLifetime;
+		}
+
 		Modio::Detail::HttpRequestParams& HttpRequestParams::SuppressPlatformHeader()
 		{
 			bSuppressPlatformHeader = true;
@@ -375,7 +395,7 @@ namespace Modio
 
 		Modio::Detail::HttpRequestParams& HttpRequestParams::SetContentRange(Modio::FileOffset Start,
 																			 Modio::FileOffset End,
-																			 Modio::FileOffset Total)
+																			 Modio::Optional<Modio::FileOffset> Total)
 		{
 			ContentRangeOffsets = std::make_tuple(Start, End, Total);
 			return *this;
@@ -718,12 +738,14 @@ namespace Modio
 			{
 				std::uintmax_t StartValue = 0;
 				std::uintmax_t EndValue = 0;
-				std::uintmax_t TotalValue = 0;
+				Modio::Optional<Modio::FileOffset> TotalValue {};
 
 				std::tie(StartValue, EndValue, TotalValue) = ContentRangeOffsets.value();
 
 				// https://developer.mozilla.org/en-US/docs/Web/HTTP/Headers/Content-Range
-				Headers.emplace_back("Content-Range", fmt::format("bytes {}-{}/{}", StartValue, EndValue, TotalValue));
+				Headers.emplace_back("Content-Range",
+									 fmt::format("bytes {}-{}/{}", StartValue, EndValue,
+												 TotalValue ? std::to_string(TotalValue.value()) : std::string("*")));
 			}
 
 			// Add Local Language Header
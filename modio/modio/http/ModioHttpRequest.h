@@ -11,6 +11,8 @@
 #pragma once
 
 #include "modio/detail/AsioWrapper.h"
+#include "modio/detail/ModioIOThreadPool.h"
+#include "modio/detail/ops/RunOnIOStrandOp.h"
 #include "modio/http/ModioHttpParams.h"
 #include "modio/http/ModioHttpService.h"
 
@@ -21,6 +23,30 @@ namespace Modio
 		class HttpRequest : public ModioAsio::basic_io_object<HttpService>
 		{
 			HttpRequestParams RequestParameters;
+			/// @brief Strand of the I/O thread pool the platform operations of this request run on, if there is a pool
+			Modio::Optional<Modio::Detail::IOStrand> IOThreadStrand;
+
+			/// @brief Calls Initiation with the service, the implementation and a handler to start a platform operation
+			/// with. The operation runs on IOThreadStrand when there is one, and Token is called on the global
+			/// io_context either way
+			template<typename InitiationType, typename CompletionTokenType>
+			void StartPlatformOperation(InitiationType Initiation, CompletionTokenType&& Token)
+			{
+				if (IOThreadStrand)
+				{
+					Modio::Detail::RunOnIOStrandAsync(
+						*IOThreadStrand,
+						[&Service = get_service(), Implementation = get_implementation(),
+						 Initiation = std::move(Initiation)](auto Handler) mutable {
+							Initiation(Service, Implementation, std::move(Handler));
+						},
+						std::forward<CompletionTokenType>(Token));
+				}
+				else
+				{
+					Initiation(get_service(), get_implementation(), std::forward<CompletionTokenType>(Token));
+				}
+			}
 
 		public:
 			MODIO_IMPL explicit HttpRequest(HttpRequestParams RequestParams);
@@ -51,7 +77,11 @@ namespace Modio
 			{
 				// TODO: @Modio-core Double check if this is a pessimizing move
 				// TODO: @Modio-core prevent double-sending
-				get_service().SendRequestAsync(get_implementation(), std::forward<CompletionTokenType>(Token));
+				StartPlatformOperation(
+					[](HttpService& Service, implementation_type& Implementation, auto&& Handler) {
+						Service.SendRequestAsync(Implementation, std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			/// @brief Begins the send operation for a request which requires a streamed upload
@@ -61,8 +91,11 @@ namespace Modio
 			template<typename CompletionTokenType>
 			auto BeginWriteAsync(Modio::FileSize TotalSize, CompletionTokenType&& Token)
 			{
-				get_service().BeginWriteAsync(get_implementation(), TotalSize,
-											  std::forward<CompletionTokenType>(Token));
+				StartPlatformOperation(
+					[TotalSize](HttpService& Service, implementation_type& Implementation, auto&& Handler) {
+						Service.BeginWriteAsync(Implementation, TotalSize, std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			/// @brief Uploads the passed-in buffer as part of a streamed upload to the server. Call
@@ -73,8 +106,13 @@ namespace Modio
 			template<typename CompletionTokenType>
 			auto WriteSomeAsync(Modio::Detail::Buffer Data, CompletionTokenType&& Token)
 			{
-				get_service().WriteSomeAsync(get_implementation(), std::move(Data),
-											 std::forward<CompletionTokenType>(Token));
+				StartPlatformOperation(
+					[Data = std::move(Data)](HttpService& Service, implementation_type& Implementation,
+											 auto&& Handler) mutable {
+						Service.WriteSomeAsync(Implementation, std::move(Data),
+											   std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			template<typename CompletionTokenType>
@@ -82,15 +120,23 @@ namespace Modio
 			{
 				// Must have sent the request first before we read headers
 
-				get_service().ReadResponseHeadersAsync(get_implementation(), std::forward<CompletionTokenType>(Token));
+				StartPlatformOperation(
+					[](HttpService& Service, implementation_type& Implementation, auto&& Handler) {
+						Service.ReadResponseHeadersAsync(Implementation, std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 
 			// pass in a mutable buffer to read into as well?
 			template<typename CompletionTokenType>
 			auto ReadSomeFromResponseBodyAsync(DynamicBuffer DynamicBufferInstance, CompletionTokenType&& Token)
 			{
-				get_service().ReadSomeFromResponseBodyAsync(get_implementation(), DynamicBufferInstance,
-															std::forward<CompletionTokenType>(Token));
+				StartPlatformOperation(
+					[DynamicBufferInstance](HttpService& Service, implementation_type& Implementation, auto&& Handler) {
+						Service.ReadSomeFromResponseBodyAsync(Implementation, DynamicBufferInstance,
+															  std::forward<decltype(Handler)>(Handler));
+					},
+					std::forward<CompletionTokenType>(Token));
 			}
 		};
 	} // namespace Detail
@@ -20,27 +20,30 @@ namespace Modio
 	{
 		HttpRequest::HttpRequest(HttpRequest&& Other)
 			: ModioAsio::basic_io_object<HttpService>(std::move(Other)),
-			  RequestParameters(std::move(Other.RequestParameters))
+			  RequestParameters(std::move(Other.RequestParameters)),
+			  IOThreadStrand(std::move(Other.IOThreadStrand))
 
 		{}
 
 		HttpRequest::HttpRequest(ModioAsio::io_context& Context, HttpRequestParams RequestParams)
 			: ModioAsio::basic_io_object<HttpService>(Context),
-			  RequestParameters(RequestParams)
+			  RequestParameters(RequestParams),
+			  IOThreadStrand(Modio::Detail::IOThreadPool::MakeStrand())
 
 		{
 			get_implementation()->Parameters = RequestParams;
-			Logger().Log(LogLevel::Trace, LogCategory::Http, "Creating Request for {}{}",
-						 RequestParams.GetServerAddress(), RequestParams.GetFormattedResourcePath());
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Creating Request for {}{}", RequestParams.GetServerAddress(),
+						RequestParams.GetFormattedResourcePath());
 		}
 
 		HttpRequest::HttpRequest(HttpRequestParams RequestParams)
 			: ModioAsio::basic_io_object<HttpService>(Modio::Detail::Services::GetGlobalContext()),
-			  RequestParameters(RequestParams)
+			  RequestParameters(RequestParams),
+			  IOThreadStrand(Modio::Detail::IOThreadPool::MakeStrand())
 		{
 			get_implementation()->Parameters = RequestParameters;
-			Logger().Log(LogLevel::Trace, LogCategory::Http, "Creating Request for {}{}",
-						 RequestParams.GetServerAddress(), RequestParams.GetFormattedResourcePath());
+			MODIO_LOG(LogLevel::Trace, LogCategory::Http, "Creating Request for {}{}", RequestParams.GetServerAddress(),
+						RequestParams.GetFormattedResourcePath());
 		}
 
 		HttpRequest::~HttpRequest() {}
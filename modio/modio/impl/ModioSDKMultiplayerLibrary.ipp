@@ -36,6 +36,7 @@ namespace Modio
 
 	void InitializeModioServerAsync(Modio::ServerInitializeOptions InitOptions, std::function<void(Modio::ErrorCode)> OnInitComplete)
 	{
+		OnInitComplete = Modio::Detail::MarshalCallback(std::move(OnInitComplete));
 		Modio::Detail::SDKSessionData::EnqueueTask([InitOptions, OnInitComplete = std::move(OnInitComplete)]() mutable {
 			if (Modio::Detail::RequireValidServerInitParam(InitOptions, OnInitComplete))
 			{
@@ -48,6 +49,7 @@ namespace Modio
 	void InstallOrUpdateServerModsAsync(std::vector<Modio::ModID> Mods,
 		std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Mods, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireModManagementEnabled(Callback) &&
@@ -61,6 +63,7 @@ namespace Modio
 	void RegisterClientModsWithServerAsync(std::vector<Modio::ModID> ModIDs,
 		std::function<void(Modio::ErrorCode, std::set<Modio::ModID>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModIDs, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireAllModIDsValid(ModIDs, Callback))
@@ -9,8 +9,11 @@
  */
 
 #include "modio/cache/ModioCacheService.h"
+#include "modio/detail/ModioComputePool.h"
 #include "modio/detail/ModioLibraryConfigurationHelpers.h"
+#include "modio/detail/ModioRuntimeStats.h"
 #include "modio/detail/ModioSDKMultiplayerLibrary.h"
+#include "modio/detail/ModioWorkerThread.h"
 #include "modio/detail/ops/ServiceInitializationOp.h"
 #include "modio/detail/ops/GetGameInfoOp.h"
 #include "modio/detail/ops/GetMutedUsersOp.h"
@@ -37,6 +40,66 @@ namespace Modio
 	MODIOSDK_API void InitializeAsync(Modio::InitializeOptions InitOptions,
 									 std::function<void(Modio::ErrorCode)> OnInitComplete)
 	{
+		OnInitComplete = Modio::Detail::MarshalCallback(std::move(OnInitComplete));
+
+		// The worker has to be running before the initialization task is queued, as nothing else runs queued tasks
+		// once the SDK owns its thread
+		auto WorkerThreadParam = InitOptions.ExtendedParameters.find("WorkerThread");
+		if (WorkerThreadParam != InitOptions.ExtendedParameters.end() && WorkerThreadParam->second == "true")
+		{
+			Modio::Detail::WorkerIdleStrategy IdleStrategy = Modio::Detail::WorkerIdleStrategy::Park;
+			auto IdleStrategyParam = InitOptions.ExtendedParameters.find("WorkerIdleStrategy");
+			if (IdleStrategyParam != InitOptions.ExtendedParameters.end())
+			{
+				Modio::Optional<Modio::Detail::WorkerIdleStrategy> ParsedStrategy =
+					Modio::Detail::WorkerThread::ParseIdleStrategy(IdleStrategyParam->second);
+				if (!ParsedStrategy.has_value())
+				{
+					Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::Core,
+												"Extended parameter WorkerIdleStrategy must be Park, Yield or Spin");
+					Modio::Detail::SDKSessionData::EnqueueTask([OnInitComplete = std::move(OnInitComplete)]() {
+						OnInitComplete(Modio::make_error_code(Modio::GenericError::BadParameter));
+					});
+					return;
+				}
+				IdleStrategy = *ParsedStrategy;
+			}
+
+			std::chrono::microseconds IdleInterval = Modio::Detail::Constants::Configuration::DefaultWorkerIdleInterval;
+			auto IdleIntervalParam = InitOptions.ExtendedParameters.find("WorkerIdleIntervalMicroseconds");
+			if (IdleIntervalParam != InitOptions.ExtendedParameters.end())
+			{
+				const std::string& Value = IdleIntervalParam->second;
+				bool bIsNumeric = !Value.empty() && Value.size() < 7 &&
+								  std::all_of(Value.begin(), Value.end(), [](char c) { return std::isdigit(c); });
+				IdleInterval = std::chrono::microseconds(bIsNumeric ? std::stol(Value) : 0);
+				if (IdleInterval.count() < 1 ||
+					IdleInterval > Modio::Detail::Constants::Configuration::MaxWorkerIdleInterval)
+				{
+					Modio::Detail::Logger().Log(
+						Modio::LogLevel::Error, Modio::LogCategory::Core,
+						"Extended parameter WorkerIdleIntervalMicroseconds must be an integer between 1 and {}",
+						Modio::Detail::Constants::Configuration::MaxWorkerIdleInterval.count());
+					Modio::Detail::SDKSessionData::EnqueueTask([OnInitComplete = std::move(OnInitComplete)]() {
+						OnInitComplete(Modio::make_error_code(Modio::GenericError::BadParameter));
+					});
+					return;
+				}
+			}
+
+			if (Modio::Detail::WorkerThread::Start(IdleStrategy, IdleInterval))
+			{
+				// A worker started for an initialization that fails is not needed by anything
+				OnInitComplete = [OnInitComplete = std::move(OnInitComplete)](Modio::ErrorCode ec) {
+					if (ec)
+					{
+						Modio::Detail::WorkerThread::RequestStop();
+					}
+					OnInitComplete(ec);
+				};
+			}
+		}
+
 		Modio::Detail::SDKSessionData::EnqueueTask([InitOptions, OnInitComplete = std::move(OnInitComplete)]() mutable {
 			if (Modio::Detail::RequireValidInitParams(InitOptions, OnInitComplete))
 			{
@@ -49,6 +112,25 @@ namespace Modio
 
 	MODIOSDK_API void RunPendingHandlers()
 	{
+		// Records how long the call took for QueryRuntimeStats, however it returns
+		struct CallTimer
+		{
+			std::chrono::steady_clock::time_point StartTime = std::chrono::steady_clock::now();
+
+			~CallTimer()
+			{
+				Modio::Detail::RuntimeStatsCollector::Get().RecordRunPendingHandlers(
+					std::chrono::steady_clock::now() - StartTime);
+			}
+		} Timer;
+
+		// The SDK's own thread runs the handlers, so all that is left to do here is run the callbacks it queued
+		if (Modio::Detail::WorkerThread::IsRunning())
+		{
+			Modio::Detail::WorkerThread::DispatchCallbacks();
+			return;
+		}
+
 		// Static atomic flag to track if the function is already running
 		static std::atomic_flag bIsRunning = ATOMIC_FLAG_INIT;
 
@@ -112,7 +194,22 @@ namespace Modio
 	// This might need a timeout parameter
 	MODIOSDK_API void ShutdownAsync(std::function<void(Modio::ErrorCode)> OnShutdownComplete)
 	{
+		OnShutdownComplete = Modio::Detail::MarshalCallback(std::move(OnShutdownComplete));
+		if (Modio::Detail::WorkerThread::IsRunning())
+		{
+			// The worker is no longer needed once the shutdown has completed, and is joined before the callback runs
+			OnShutdownComplete = [OnShutdownComplete = std::move(OnShutdownComplete)](Modio::ErrorCode ec) {
+				if (!ec)
+				{
+					Modio::Detail::WorkerThread::RequestStop();
+				}
+				OnShutdownComplete(ec);
+			};
+		}
+
+		Modio::Detail::WorkerThread::SetShutdownPending(true);
 		auto ShutdownLock = Modio::Detail::SDKSessionData::GetShutdownLock();
+		Modio::Detail::WorkerThread::SetShutdownPending(false);
 		if (Modio::Detail::RequireSDKIsInitialized(OnShutdownComplete))
 		{
 			// Halt the mod management loop
@@ -124,6 +221,9 @@ namespace Modio
 			Modio::Detail::Services::GetGlobalService<Modio::Detail::FileService>().Shutdown();
 			Modio::Detail::Services::GetGlobalService<Modio::Detail::LogService>().Shutdown();
 			Modio::Detail::Services::GetGlobalService<Modio::Detail::TimerService>().Shutdown();
+			// Lets the work already on the pool finish, so the operations waiting on it can be resumed and cancelled
+			// along with everything else on the old io_context
+			Modio::Detail::ComputePool::Stop();
 			Modio::Detail::SDKSessionData::Deinitialize();
 
 			//Resets the Server Framework State
@@ -142,6 +242,17 @@ namespace Modio
 		}
 	}
 
+	MODIOSDK_API void DispatchCallbacks()
+	{
+		Modio::Detail::WorkerThread::DispatchCallbacks();
+	}
+
+	MODIOSDK_API Modio::RuntimeStats QueryRuntimeStats()
+	{
+		return Modio::Detail::RuntimeStatsCollector::Get().Snapshot(
+			Modio::Detail::Services::GetGlobalService<Modio::Detail::LogService>().GetDroppedLogCount());
+	}
+
 	MODIOSDK_API void SetLogLevel(Modio::LogLevel Level)
 	{
 		auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
@@ -149,11 +260,18 @@ namespace Modio
 		Modio::Detail::LogService::SetGlobalLogLevel(Level);
 	}
 
+	MODIOSDK_API void SetCategoryLogLevel(Modio::LogCategory Category, Modio::LogLevel Level)
+	{
+		auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
+
+		Modio::Detail::Services::GetGlobalService<Modio::Detail::LogService>().SetCategoryLogLevel(Category, Level);
+	}
+
 	MODIOSDK_API void SetLogCallback(std::function<void(Modio::LogLevel Level, const std::string& Message)> LogCallback)
 	{
 		auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
 
-		Modio::Detail::LogService::SetLogCallback(LogCallback);
+		Modio::Detail::LogService::SetLogCallback(Modio::Detail::MarshalCallback(std::move(LogCallback)));
 	}
 
 	MODIOSDK_API std::vector<Modio::FieldError> GetLastValidationError()
@@ -165,6 +283,7 @@ namespace Modio
 
 	MODIOSDK_API void ReportContentAsync(Modio::ReportParams Report, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[Report = std::move(Report), Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -177,6 +296,7 @@ namespace Modio
 
 	MODIOSDK_API void MuteUserAsync(Modio::UserID UserID, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([UserID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -189,6 +309,7 @@ namespace Modio
 
 	MODIOSDK_API void UnmuteUserAsync(Modio::UserID UserID, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([UserID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -202,6 +323,7 @@ namespace Modio
 	MODIOSDK_API void GetMutedUsersAsync(
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::UserList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback))
@@ -214,6 +336,7 @@ namespace Modio
 	MODIOSDK_API void GetGameInfoAsync(Modio::GameID GameID,
 						  std::function<void(Modio::ErrorCode, Modio::Optional<Modio::GameInfo>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([GameID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireValidGameID(GameID, Callback))
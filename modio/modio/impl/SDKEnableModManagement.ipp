@@ -15,6 +15,7 @@
 #include "modio/core/ModioLogger.h"
 #include "modio/detail/ModioSDKSessionData.h"
 #include "modio/detail/ops/ModManagementLoop.h"
+#include "modio/impl/SDKPostAsync.h"
 
 namespace Modio
 {
@@ -37,7 +38,8 @@ namespace Modio
 				Modio::Detail::Logger().Log(LogLevel::Warning, LogCategory::Core, "Mod Management is already enabled");
 				return Modio::make_error_code(Modio::ModManagementError::ModManagementAlreadyEnabled);
 			}
-			Modio::Detail::SDKSessionData::SetUserModManagementCallback(ModManagementHandler);
+			Modio::Detail::SDKSessionData::SetUserModManagementCallback(
+				Modio::Detail::MarshalCallback(std::move(ModManagementHandler)));
 			Modio::Detail::SDKSessionData::AllowModManagement();
 		}
 
@@ -12,12 +12,14 @@
 #include "modio/core/ModioLogger.h"
 #include "modio/detail/FmtWrapper.h"
 #include "modio/detail/ModioSDKSessionData.h"
+#include "modio/impl/SDKPostAsync.h"
 #include "modio/impl/SDKPreconditionChecks.h"
 
 namespace Modio
 {
 	MODIOSDK_API void MetricsSessionStartAsync(Modio::MetricsSessionParams Params, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		if (!Params.SessionId.has_value() || !Params.SessionId.value().IsValid())
 		{
 			Modio::Guid SessionId = Modio::Guid::GenerateGuid();
@@ -41,6 +43,7 @@ namespace Modio
 
 	MODIOSDK_API void MetricsSessionSendHeartbeatOnceAsync(std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -56,6 +59,7 @@ namespace Modio
 	MODIOSDK_API void MetricsSessionSendHeartbeatAtIntervalAsync(std::uint32_t IntervalSeconds,
 													std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([IntervalSeconds, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -70,6 +74,7 @@ namespace Modio
 
 	MODIOSDK_API void MetricsSessionEndAsync(std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
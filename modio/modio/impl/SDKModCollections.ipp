@@ -20,6 +20,7 @@
 #include "modio/detail/ops/collection/GetModCollectionMediaLogoOp.h"
 #include "modio/detail/ops/collection/GetModCollectionMediaAvatarOp.h"
 #include "modio/detail/ops/collection/UnsubscribeFromModCollectionOp.h"
+#include "modio/impl/SDKPostAsync.h"
 #include "modio/impl/SDKPreconditionChecks.h"
 
 namespace Modio
@@ -28,6 +29,7 @@ namespace Modio
 		Modio::FilterParams Filter,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModCollectionInfoList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[Filter = std::move(Filter), Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) && 
@@ -42,6 +44,7 @@ namespace Modio
 		Modio::FilterParams Filter,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModCollectionInfoList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[Filter = std::move(Filter), Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -57,6 +60,7 @@ namespace Modio
 		Modio::ModCollectionID ModCollectionID,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModCollectionInfo>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModCollectionID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -71,6 +75,7 @@ namespace Modio
 		Modio::ModCollectionID ModCollectionID,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModCollectionID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -84,6 +89,7 @@ namespace Modio
 	MODIOSDK_API void SubmitModCollectionRatingAsync(Modio::ModCollectionID ModCollectionID, Modio::Rating Rating,
 													 std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModCollectionID, Callback = std::move(Callback), Rating]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -97,6 +103,7 @@ namespace Modio
 	MODIOSDK_API void SubscribeToModCollectionAsync(Modio::ModCollectionID ModCollectionToSubscribeTo,
 													std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[ModCollectionToSubscribeTo, Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -111,6 +118,7 @@ namespace Modio
 	MODIOSDK_API void UnsubscribeFromModCollectionAsync(Modio::ModCollectionID ModCollectionToUnsubscribeFrom,
 														std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[ModCollectionToUnsubscribeFrom, Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -126,6 +134,7 @@ namespace Modio
 		Modio::ModCollectionID ModCollectionToFollow,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModCollectionInfo>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModCollectionToFollow, Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 					Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -139,6 +148,7 @@ namespace Modio
 	MODIOSDK_API void UnfollowModCollectionAsync(Modio::ModCollectionID ModCollectionToUnfollow,
 												 std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModCollectionToUnfollow, Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 					Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -153,6 +163,7 @@ namespace Modio
 		Modio::ModCollectionID CollectionId, Modio::LogoSize LogoSize,
 		std::function<void(Modio::ErrorCode, Modio::Optional<std::string>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([CollectionId, LogoSize, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireValidModCollectionID(CollectionId, Callback))
@@ -166,6 +177,7 @@ namespace Modio
 		Modio::ModCollectionID CollectionId, Modio::AvatarSize AvatarSize,
 		std::function<void(Modio::ErrorCode, Modio::Optional<std::string>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[CollectionId, AvatarSize, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
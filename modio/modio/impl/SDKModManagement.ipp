@@ -30,6 +30,7 @@
 #include "modio/detail/ops/modmanagement/InstallOrUpdateMod.h"
 #include "modio/detail/serialization/ModioResponseErrorSerialization.h"
 #include "modio/detail/serialization/ModioUploadSessionSerialization.h"
+#include "modio/impl/SDKPostAsync.h"
 #include "modio/impl/SDKPreconditionChecks.h"
 
 namespace Modio
@@ -47,6 +48,7 @@ namespace Modio
 
 	void FetchExternalUpdatesAsync(std::function<void(Modio::ErrorCode)> OnFetchDone)
 	{
+		OnFetchDone = Modio::Detail::MarshalCallback(std::move(OnFetchDone));
 		Modio::Detail::SDKSessionData::EnqueueTask([OnFetchDone = std::move(OnFetchDone)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(OnFetchDone) &&
 				Modio::Detail::RequireNotRateLimited(OnFetchDone) &&
@@ -63,6 +65,7 @@ namespace Modio
 		std::function<void(Modio::ErrorCode, std::map<Modio::ModID, Modio::UserSubscriptionList::ChangeType>)>
 			OnPreviewDone)
 	{
+		OnPreviewDone = Modio::Detail::MarshalCallback(std::move(OnPreviewDone));
 		Modio::Detail::SDKSessionData::EnqueueTask([OnPreviewDone = std::move(OnPreviewDone)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(OnPreviewDone) &&
 				Modio::Detail::RequireNotRateLimited(OnPreviewDone) &&
@@ -76,6 +79,7 @@ namespace Modio
 	void SubscribeToModAsync(Modio::ModID ModToSubscribeTo, bool IncludeDependencies,
 							 std::function<void(Modio::ErrorCode)> OnSubscribeComplete)
 	{
+		OnSubscribeComplete = Modio::Detail::MarshalCallback(std::move(OnSubscribeComplete));
 		{
 			auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
 			Modio::Detail::SDKSessionData::IncrementModManagementEventQueued();
@@ -102,6 +106,7 @@ namespace Modio
 	void UnsubscribeFromModAsync(Modio::ModID ModToUnsubscribeFrom,
 								 std::function<void(Modio::ErrorCode)> OnUnsubscribeComplete)
 	{
+		OnUnsubscribeComplete = Modio::Detail::MarshalCallback(std::move(OnUnsubscribeComplete));
 		{
 			auto Lock = Modio::Detail::SDKSessionData::GetWriteLock();
 			Modio::Detail::SDKSessionData::IncrementModManagementEventQueued();
@@ -244,24 +249,29 @@ namespace Modio
 	}
 
 	std::map<Modio::ModID, Modio::ModCollectionEntry> QueryUserSubscriptions()
+	{
+		std::map<Modio::ModID, ModCollectionEntry> UserSubscriptions;
+		ForEachUserSubscription([&UserSubscriptions](const Modio::ModCollectionEntry& Entry) {
+			UserSubscriptions.emplace_hint(UserSubscriptions.end(), Entry.GetID(), Entry);
+		});
+		return UserSubscriptions;
+	}
+
+	void ForEachUserSubscription(std::function<void(const Modio::ModCollectionEntry&)> Visitor)
 	{
 		auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
 		if (Modio::Detail::SDKSessionData::IsInitialized())
 		{
-			Modio::ModCollection UserModCollection =
-				Modio::Detail::SDKSessionData::FilterSystemModCollectionByUserSubscriptions();
-
-			std::map<Modio::ModID, ModCollectionEntry> UserSubscriptions;
-
-			for (auto ModEntry : UserModCollection.Entries())
+			const Modio::ModCollection& SystemCollection = Modio::Detail::SDKSessionData::GetSystemModCollection();
+			const Modio::UserSubscriptionList& UserSubscriptions =
+				Modio::Detail::SDKSessionData::GetUserSubscriptions();
+			for (Modio::ModID UserModID : UserSubscriptions.Get())
 			{
-				UserSubscriptions.emplace(std::make_pair(ModEntry.first, (*ModEntry.second)));
+				if (Modio::Optional<Modio::ModCollectionEntry&> Entry = SystemCollection.GetByModID(UserModID))
+				{
+					Visitor(Entry.value());
+				}
 			}
-			return UserSubscriptions;
-		}
-		else
-		{
-			return {};
 		}
 	}
 
@@ -287,53 +297,62 @@ namespace Modio
 
 	std::map<Modio::ModID, Modio::ModCollectionEntry> QueryUserInstallations(bool bIncludeOutdatedMods)
 	{
-		auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
-		if (Modio::Detail::SDKSessionData::IsInitialized())
-		{
-			Modio::ModCollection UserModCollection =
-				Modio::Detail::SDKSessionData::FilterSystemModCollectionByUserSubscriptions();
-			std::map<Modio::ModID, ModCollectionEntry> UserInstallations;
+		std::map<Modio::ModID, ModCollectionEntry> UserInstallations;
+		ForEachUserInstallation(bIncludeOutdatedMods, [&UserInstallations](const Modio::ModCollectionEntry& Entry) {
+			UserInstallations.emplace_hint(UserInstallations.end(), Entry.GetID(), Entry);
+		});
+		return UserInstallations;
+	}
 
-			// Only return mods that are either installed, and if bIncludeOutdatedMods mods that are installed but have
-			// an update available that isn't currently being processed
-			for (auto ModEntry : UserModCollection.Entries())
+	void ForEachUserInstallation(bool bIncludeOutdatedMods,
+								 std::function<void(const Modio::ModCollectionEntry&)> Visitor)
+	{
+		// Only visit mods that are either installed, and if bIncludeOutdatedMods mods that are installed but have
+		// an update available that isn't currently being processed
+		ForEachUserSubscription([bIncludeOutdatedMods, &Visitor](const Modio::ModCollectionEntry& Entry) {
+			Modio::ModState State = Entry.GetModState();
+			if (State == ModState::Installed || (bIncludeOutdatedMods && State == ModState::UpdatePending))
 			{
-				if (ModEntry.second->GetModState() == ModState::Installed)
-				{
-					UserInstallations.emplace(std::make_pair(ModEntry.first, (*ModEntry.second)));
-				}
-				if (bIncludeOutdatedMods && ModEntry.second->GetModState() == ModState::UpdatePending)
-				{
-					UserInstallations.emplace(std::make_pair(ModEntry.first, (*ModEntry.second)));
-				}
+				Visitor(Entry);
 			}
-			return UserInstallations;
-		}
-		else
-		{
-			return {};
-		}
+		});
 	}
 
 	std::map<Modio::ModID, Modio::ModCollectionEntry> QuerySystemInstallations()
+	{
+		std::map<Modio::ModID, ModCollectionEntry> InstalledMods;
+		ForEachSystemInstallation([&InstalledMods](const Modio::ModCollectionEntry& Entry) {
+			InstalledMods.emplace_hint(InstalledMods.end(), Entry.GetID(), Entry);
+		});
+		return InstalledMods;
+	}
+
+	void ForEachSystemInstallation(std::function<void(const Modio::ModCollectionEntry&)> Visitor)
 	{
 		auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
 		if (Modio::Detail::SDKSessionData::IsInitialized())
 		{
-			std::map<Modio::ModID, ModCollectionEntry> InstalledMods;
 			const Modio::ModCollection& AllInstalledMods = Modio::Detail::SDKSessionData::GetSystemModCollection();
 			for (auto& ModEntry : AllInstalledMods.Entries())
 			{
-				if (std::shared_ptr<Modio::ModCollectionEntry> ModEntryPtr = ModEntry.second)
+				if (ModEntry.second)
 				{
-					InstalledMods.emplace(std::make_pair(ModEntry.first, (*ModEntryPtr)));
+					Visitor(*ModEntry.second);
 				}
 			}
-			return InstalledMods;
+		}
+	}
+
+	std::uint64_t QueryModCollectionRevision()
+	{
+		auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
+		if (Modio::Detail::SDKSessionData::IsInitialized())
+		{
+			return Modio::Detail::SDKSessionData::GetModCollectionQueryRevision();
 		}
 		else
 		{
-			return {};
+			return 0;
 		}
 	}
 
@@ -343,17 +362,32 @@ namespace Modio
 
 		/* Mod Storage Info */
 
-		// Calculate consumed local space
-		std::map<Modio::ModID, Modio::ModCollectionEntry> LocalMods = QuerySystemInstallations();
-		const std::map<Modio::ModID, Modio::ModCollectionEntry> TempModSet = QueryTempModSet();
-		// merge maps together and remove duplicates
-		LocalMods.insert(TempModSet.begin(), TempModSet.end());
+		// Calculate consumed local space. The size of the system mod collection is cached until an entry changes, so
+		// only the temp mods that are not also in the system collection are summed here
 		Modio::FileSize ConsumedLocalSpace {Modio::FileSize(0)};
-		for (auto& Mod : LocalMods)
 		{
-			if (Mod.second.GetSizeOnDisk().has_value())
+			auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
+			if (Modio::Detail::SDKSessionData::IsInitialized())
 			{
-				ConsumedLocalSpace += Mod.second.GetSizeOnDisk().value();
+				ConsumedLocalSpace = Modio::Detail::SDKSessionData::GetInstalledModsSizeOnDisk();
+				if (Modio::Detail::SDKSessionData::GetTemporaryModSet() != nullptr)
+				{
+					const Modio::ModCollection& AllInstalledMods =
+						Modio::Detail::SDKSessionData::GetSystemModCollection();
+					const Modio::ModCollection& AllTempMods = Modio::Detail::SDKSessionData::GetTempModCollection();
+					for (Modio::ModID TempModId : Modio::Detail::SDKSessionData::GetTemporaryModSet()->GetModIds())
+					{
+						if (AllInstalledMods.GetByModID(TempModId).has_value())
+						{
+							continue;
+						}
+						Modio::Optional<Modio::ModCollectionEntry&> TempEntry = AllTempMods.GetByModID(TempModId);
+						if (TempEntry.has_value() && TempEntry->GetSizeOnDisk().has_value())
+						{
+							ConsumedLocalSpace += TempEntry->GetSizeOnDisk().value();
+						}
+					}
+				}
 			}
 		}
 		SetSpace(Info, Modio::StorageLocation::Local, Modio::StorageUsage::Consumed, ConsumedLocalSpace);
@@ -447,6 +481,7 @@ namespace Modio
 
 	void ForceUninstallModAsync(Modio::ModID ModToRemove, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[ModToRemove = std::move(ModToRemove), Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -463,6 +498,7 @@ namespace Modio
 	void SubmitNewModAsync(Modio::ModCreationHandle Handle, Modio::CreateModParams Params,
 						   std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModID> CreatedModID)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Handle, Params, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireUserIsAuthenticated(Callback))
 			{
@@ -484,6 +520,7 @@ namespace Modio
 	void SubmitModChangesAsync(Modio::ModID Mod, Modio::EditModParams Params,
 							   std::function<void(Modio::ErrorCode ec, Modio::Optional<Modio::ModInfo>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Mod, Params, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -601,6 +638,7 @@ namespace Modio
 	void AddOrUpdateModLogoAsync(Modio::ModID ModID, std::string LogoPath,
 								 std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[ModID = std::move(ModID), LogoPath = std::move(LogoPath), Callback = std::move(Callback),
 			 TRACKED = Modio::Detail::OperationTracker("AddOrUpdateModLogoWrapper", &Callback)]() mutable {
@@ -618,6 +656,7 @@ namespace Modio
 	void AddOrUpdateModGalleryImagesAsync(Modio::ModID ModID, std::vector<std::string> ImagePaths, bool SyncGallery,
 										  std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID = std::move(ModID), ImagePaths = std::move(ImagePaths),
 													SyncGallery, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
@@ -640,6 +679,7 @@ namespace Modio
 
 	void ArchiveModAsync(Modio::ModID ModID, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID = std::move(ModID),
 													Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
@@ -757,44 +797,47 @@ namespace Modio
 
 	std::map<Modio::ModID, Modio::ModCollectionEntry> QueryTempModSet()
 	{
+		std::map<Modio::ModID, Modio::ModCollectionEntry> queryTempModSet =
+			std::map<Modio::ModID, Modio::ModCollectionEntry>();
+		ForEachTempModSetEntry([&queryTempModSet](const Modio::ModCollectionEntry& Entry) {
+			queryTempModSet.emplace(Entry.GetID(), Entry);
+		});
+		return queryTempModSet;
+	}
+
+	void ForEachTempModSetEntry(std::function<void(const Modio::ModCollectionEntry&)> Visitor)
+	{
+		auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
+
+		if (!Modio::Detail::SDKSessionData::IsInitialized())
 		{
-			auto Lock = Modio::Detail::SDKSessionData::GetReadLock();
+			return;
+		}
+		if (Modio::Detail::SDKSessionData::GetTemporaryModSet() == nullptr)
+		{
+			return;
+		}
 
-			std::map<Modio::ModID, Modio::ModCollectionEntry> queryTempModSet =
-				std::map<Modio::ModID, Modio::ModCollectionEntry>();
+		std::vector<Modio::ModID> modIdS = Modio::Detail::SDKSessionData::GetTemporaryModSet()->GetModIds();
+		const Modio::ModCollection& AllInstalledMods = Modio::Detail::SDKSessionData::GetSystemModCollection();
+		const Modio::ModCollection& AllTempdMods = Modio::Detail::SDKSessionData::GetTempModCollection();
 
-			if (!Modio::Detail::SDKSessionData::IsInitialized())
+		for (Modio::ModID modId : modIdS)
+		{
+			if (Modio::Optional<Modio::ModCollectionEntry&> Entry = AllInstalledMods.GetByModID(modId))
 			{
-				return queryTempModSet;
+				Visitor(Entry.value());
 			}
-			if (Modio::Detail::SDKSessionData::GetTemporaryModSet() == nullptr)
+			else if (Modio::Optional<Modio::ModCollectionEntry&> TempEntry = AllTempdMods.GetByModID(modId))
 			{
-				return queryTempModSet;
+				Visitor(TempEntry.value());
 			}
-
-			std::vector<Modio::ModID> modIdS = Modio::Detail::SDKSessionData::GetTemporaryModSet()->GetModIds();
-			const Modio::ModCollection& AllInstalledMods = Modio::Detail::SDKSessionData::GetSystemModCollection();
-			const Modio::ModCollection& AllTempdMods = Modio::Detail::SDKSessionData::GetTempModCollection();
-
-			for (Modio::ModID modId : modIdS)
+			else
 			{
-				if (Modio::Optional<Modio::ModCollectionEntry&> Entry = AllInstalledMods.GetByModID(modId))
-				{
-					queryTempModSet.emplace(std::make_pair(modId, Entry.value()));
-				}
-				else if (Modio::Optional<Modio::ModCollectionEntry&> TempEntry = AllTempdMods.GetByModID(modId))
-				{
-					queryTempModSet.emplace(std::make_pair(modId, TempEntry.value()));
-				}
-				else
-				{
-					Modio::Detail::Logger().Log(LogLevel::Warning, LogCategory::Core,
-												"ModID {} from TempModSet should in System or Temp Mod Collection",
-												modId);
-				}
+				Modio::Detail::Logger().Log(LogLevel::Warning, LogCategory::Core,
+											"ModID {} from TempModSet should in System or Temp Mod Collection",
+											modId);
 			}
-
-			return queryTempModSet;
 		}
 	}
 
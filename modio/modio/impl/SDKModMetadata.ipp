@@ -17,10 +17,12 @@
 #include "modio/detail/ops/mod/GetModTagsOp.h"
 #include "modio/detail/ops/mod/ListAllModsOp.h"
 #include "modio/detail/ops/mod/ListUserCreatedModsOp.h"
+#include "modio/detail/ops/mod/PrefetchModListPagesOp.h"
 #include "modio/detail/ops/mod/SubmitModRatingOp.h"
 #include "modio/detail/ops/mod/AddModDependenciesOp.h"
 #include "modio/detail/ops/mod/DeleteModDependenciesOp.h"
 #include "modio/detail/serialization/ModioModDependencySerialization.h"
+#include "modio/impl/SDKPostAsync.h"
 #include "modio/impl/SDKPreconditionChecks.h"
 
 // Implementation header - do not include directly
@@ -30,19 +32,39 @@ namespace Modio
 	MODIOSDK_API void ListAllModsAsync(FilterParams Filter,
 						  std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[Filter = std::move(Filter), Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback))
 				{
+					// A different query supersedes whatever was being prefetched for the previous one
+					Modio::Detail::SDKSessionData::SupersedeModListPrefetch(Filter.ToQueryKey());
 					Modio::Detail::ListAllModsAsync(Filter, Callback);
 				}
 			});
 	}
 
+	MODIOSDK_API void ListAllModsWithPrefetchAsync(
+		FilterParams Filter, std::size_t PrefetchPageCount,
+		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)> Callback)
+	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
+		Modio::Detail::SDKSessionData::EnqueueTask(
+			[Filter = std::move(Filter), PrefetchPageCount, Callback = std::move(Callback)]() mutable {
+				if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback))
+				{
+					// Queued after the requested page, so the prefetches never delay it
+					Modio::Detail::ListAllModsAsync(Filter, Callback);
+					Modio::Detail::PrefetchModListPagesAsync(Filter, PrefetchPageCount, [](Modio::ErrorCode) {});
+				}
+			});
+	}
+
 	MODIOSDK_API void ListUserCreatedModsAsync(
 		FilterParams Filter,
 								  std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfoList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Filter = std::move(Filter),
 													Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
@@ -56,6 +78,7 @@ namespace Modio
 	MODIOSDK_API void GetModInfoAsync(Modio::ModID ModId,
 						 std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModInfo>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModId, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireValidModID(ModId, Callback))
@@ -76,6 +99,7 @@ namespace Modio
 	MODIOSDK_API void GetModMediaAsync(Modio::ModID ModId, Modio::LogoSize LogoSize,
 						  std::function<void(Modio::ErrorCode, Modio::Optional<std::string>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModId, LogoSize, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireValidModID(ModId, Callback))
@@ -88,6 +112,7 @@ namespace Modio
 	MODIOSDK_API void GetModMediaAsync(Modio::ModID ModId, Modio::AvatarSize AvatarSize,
 						  std::function<void(Modio::ErrorCode, Modio::Optional<std::string>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModId, AvatarSize, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireValidModID(ModId, Callback))
@@ -100,6 +125,7 @@ namespace Modio
 	MODIOSDK_API void GetModMediaAsync(Modio::ModID ModId, Modio::GallerySize GallerySize, Modio::GalleryIndex Index,
 						  std::function<void(Modio::ErrorCode, Modio::Optional<std::string>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask(
 			[ModId, GallerySize, Index, Callback = std::move(Callback)]() mutable {
 				if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -113,6 +139,7 @@ namespace Modio
 	MODIOSDK_API void GetModTagOptionsAsync(
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModTagOptions>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback))
 			{
@@ -124,6 +151,7 @@ namespace Modio
 	MODIOSDK_API void SubmitModRatingAsync(Modio::ModID ModID, Modio::Rating Rating,
 										   std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID, Rating, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -138,6 +166,7 @@ namespace Modio
 		Modio::ModID ModID, bool Recursive,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::ModDependencyList> Dependencies)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID, Recursive, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireValidModID(ModID, Callback))
@@ -150,6 +179,7 @@ namespace Modio
 	MODIOSDK_API void AddModDependenciesAsync(Modio::ModID ModID, std::vector<Modio::ModID> Dependencies,
 								 std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID, Dependencies = std::move(Dependencies),
 													Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
@@ -164,6 +194,7 @@ namespace Modio
 	MODIOSDK_API void DeleteModDependenciesAsync(Modio::ModID ModID, std::vector<Modio::ModID> Dependencies,
 												 std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID, Dependencies = std::move(Dependencies),
 													Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
@@ -30,6 +30,7 @@
 #include "modio/detail/ops/monetization/RefreshUserEntitlementsSteam.h"
 #include "modio/detail/ops/monetization/RefreshUserEntitlementsXboxLive.h"
 #include "modio/detail/serialization/ModioEntitlementConsumptionStatusSerialization.h"
+#include "modio/impl/SDKPostAsync.h"
 #include "modio/impl/SDKPreconditionChecks.h"
 
 // Implementation header - do not include directly
@@ -40,6 +41,7 @@ namespace Modio
 		Modio::ModID ModID, Modio::Optional<std::uint64_t> ExpectedVirtualCurrencyPrice,
 						  std::function<void(Modio::ErrorCode, Modio::Optional<Modio::TransactionRecord>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID, ExpectedVirtualCurrencyPrice,
 													Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireValidModID(ModID, Callback) && Modio::Detail::RequireSDKIsInitialized(Callback) &&
@@ -54,6 +56,7 @@ namespace Modio
 		Modio::ModID ModID, Modio::EntitlementParams Params,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::TransactionRecord>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([ModID, Params, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireValidModID(ModID, Callback) == false &&
 				Modio::Detail::RequireSDKIsInitialized(Callback) == false &&
@@ -132,6 +135,7 @@ namespace Modio
 		Modio::EntitlementParams Params,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::EntitlementConsumptionStatusList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Params, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) == false &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) == false &&
@@ -209,6 +213,7 @@ namespace Modio
 		Modio::EntitlementParams Params,
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::EntitlementList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Params, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) == false &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) == false &&
@@ -285,6 +290,7 @@ namespace Modio
 	MODIOSDK_API void GetUserWalletBalanceAsync(
 		std::function<void(Modio::ErrorCode, Modio::Optional<std::uint64_t>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) && Modio::Detail::RequireNotRateLimited(Callback))
@@ -296,6 +302,7 @@ namespace Modio
 
 	MODIOSDK_API void FetchUserPurchasesAsync(std::function<void(Modio::ErrorCode)> OnFetchDone)
 	{
+		OnFetchDone = Modio::Detail::MarshalCallback(std::move(OnFetchDone));
 		Modio::Detail::SDKSessionData::EnqueueTask([OnFetchDone = std::move(OnFetchDone)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(OnFetchDone) &&
 				Modio::Detail::RequireUserIsAuthenticated(OnFetchDone) &&
@@ -323,6 +330,7 @@ namespace Modio
 
 	MODIOSDK_API void GetUserDelegationTokenAsync(std::function<void(Modio::ErrorCode, std::string)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) && Modio::Detail::RequireNotRateLimited(Callback))
@@ -12,7 +12,11 @@
 
 #include "modio/core/ModioStdTypes.h"
 #include "modio/core/ModioErrorCode.h"
+#include "modio/detail/ModioWorkerThread.h"
 #include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace Modio
 {
@@ -40,6 +44,30 @@ namespace Modio
                 }
 			});
 		}
+
+		/// @brief Wraps a callback passed to the public API so that, when the SDK runs its own worker thread, calling
+		/// it on the worker queues the call for Modio::DispatchCallbacks instead of running the callback there. The
+		/// arguments are copied into the queued call. Calls made on any other thread are run straight away
+		template<typename... CallbackArgs>
+		std::function<void(CallbackArgs...)> MarshalCallback(std::function<void(CallbackArgs...)> Callback)
+		{
+			if (!Callback)
+			{
+				return Callback;
+			}
+			return [Callback = std::move(Callback)](CallbackArgs... Args) {
+				if (!Modio::Detail::WorkerThread::IsCurrentThread())
+				{
+					Callback(std::forward<CallbackArgs>(Args)...);
+					return;
+				}
+				Modio::Detail::WorkerThread::EnqueueCallback(
+					[Callback, QueuedArgs = std::make_tuple(typename std::decay<CallbackArgs>::type(
+								   std::forward<CallbackArgs>(Args))...)]() mutable {
+						std::apply(Callback, std::move(QueuedArgs));
+					});
+			};
+		}
 	} // namespace Detail
 
 } // namespace Modio
\ No newline at end of file
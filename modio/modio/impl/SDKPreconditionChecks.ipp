@@ -328,7 +328,9 @@ namespace Modio
 		bool RequireUserNotSubscribed(Modio::ModID IDToCheck,
 									  std::function<void(Modio::ErrorCode, OtherArgs...)>& Handler)
 		{
-			if (Modio::Detail::SDKSessionData::GetUserSubscriptions().Get().count(IDToCheck))
+			// Read through a const reference, as the mutable accessor would mark the subscription list as modified
+			const Modio::UserSubscriptionList& UserSubscriptions = Modio::Detail::SDKSessionData::GetUserSubscriptions();
+			if (UserSubscriptions.Get().count(IDToCheck))
 			{
 				ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(),
 						   [CompletionHandler =
@@ -17,6 +17,7 @@
 #include "modio/detail/ops/userfollowing/GetUserFollowersOp.h"
 #include "modio/detail/ops/userfollowing/FollowUserOp.h"
 #include "modio/detail/ops/userfollowing/UnfollowUserOp.h"
+#include "modio/impl/SDKPostAsync.h"
 #include "modio/impl/SDKPreconditionChecks.h"
 
 namespace Modio
@@ -24,6 +25,7 @@ namespace Modio
 	void GetFollowersAsync(
 		std::function<void(Modio::ErrorCode, Modio::Optional<Modio::UserList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback))
@@ -36,6 +38,7 @@ namespace Modio
 	void GetUserFollowersAsync(
 		Modio::UserID UserID, std::function<void(Modio::ErrorCode, Modio::Optional<Modio::UserList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([UserID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -49,6 +52,7 @@ namespace Modio
 	void GetUserFollowingAsync(
 		Modio::UserID UserID, std::function<void(Modio::ErrorCode, Modio::Optional<Modio::UserList>)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([UserID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -61,6 +65,7 @@ namespace Modio
 
 	void FollowUserAsync(Modio::UserID UserID, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([UserID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -73,6 +78,7 @@ namespace Modio
 
 	void UnfollowUserAsync(Modio::UserID UserID, std::function<void(Modio::ErrorCode)> Callback)
 	{
+		Callback = Modio::Detail::MarshalCallback(std::move(Callback));
 		Modio::Detail::SDKSessionData::EnqueueTask([UserID, Callback = std::move(Callback)]() mutable {
 			if (Modio::Detail::RequireSDKIsInitialized(Callback) && Modio::Detail::RequireNotRateLimited(Callback) &&
 				Modio::Detail::RequireUserIsAuthenticated(Callback) &&
@@ -207,8 +207,8 @@ namespace Modio
 				}
 				else
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-												"File Descriptor {} already in queue with path", FileDescriptor);
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+								"File Descriptor {} already in queue with path", FileDescriptor);
 				}
 
 				return {};
@@ -268,8 +268,8 @@ namespace Modio
 					}
 					else
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-													"File Descriptor {} already in queue with path", FileDescriptor);
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+									"File Descriptor {} already in queue with path", FileDescriptor);
 					}
 				}
 
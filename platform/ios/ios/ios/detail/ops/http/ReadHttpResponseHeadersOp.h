@@ -107,9 +107,8 @@ namespace Modio
 						}
 					}
 
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"Response Headers received OK with response code: {}",
-												Request->ResponseCode);
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+								"Response Headers received OK with response code: {}", Request->ResponseCode);
 					Self.complete({});
 					return;
 				}
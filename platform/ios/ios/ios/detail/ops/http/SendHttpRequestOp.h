@@ -52,14 +52,12 @@ namespace Modio
 						PinnedState->InitializeRequest(Request, InitStatus);
 						if (InitStatus)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-														"Init Request Failed");
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Init Request Failed");
 							Self.complete(InitStatus);
 							return;
 						}
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"Sending request: {}",
-													Request->GetParameters().GetFormattedResourcePath());
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Sending request: {}",
+									Request->GetParameters().GetFormattedResourcePath());
 					}
 
 					// Kick off the NSURLSessionTask. From here, response headers and
@@ -36,7 +36,8 @@ namespace Modio
 			std::atomic<std::int32_t> NumWaiters {0};
 			// ModioAsio::steady_timer OperationQueue;
 			Modio::FileOffset CurrentSeekOffset = Modio::FileOffset(0);
-			bool CancelRequested = false;
+			// Set from ShutdownAsync while the file may be running on the I/O thread pool
+			std::atomic<bool> CancelRequested {false};
 
 		public:
 			FileObjectImplementation(ModioAsio::io_context& ParentContext, Modio::filesystem::path BasePath)
@@ -15,7 +15,9 @@
 #include "modio/core/ModioErrorCode.h"
 #include "modio/core/ModioLogger.h"
 #include "unistd.h"
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <sys/param.h>
 
 namespace Modio
@@ -130,38 +132,53 @@ namespace Modio
 				return;
 			}
 
-			void HandlePendingTasks()
+			/// @brief Moves the operation on by one chunk if it has not finished yet
+			void ProgressPendingOperation(PendingIOOperation& PendingOp)
 			{
-				std::for_each(PendingIO.begin(), PendingIO.end(),
-							  [this](std::pair<const int, PendingIOOperation>& Element) {
-								  PendingIOOperation& PendingOp = Element.second;
-
-								  // The PendingOperation has finished, nothing else to do.
-								  if (PendingOp.DidFinish)
-								  {
-									  return;
-								  }
-
-								  uint64_t BytesTransfer = PendingOp.Data.GetSize() - PendingOp.NumBytesTransferred;
-
-								  // It means that the PedingOp has not transferred all bytes to the Buffer
-								  if (BytesTransfer > 0)
-								  {
-									  PerformPendingOperation(PendingOp);
-								  }
-								  else
-								  {
-									  PendingOp.Result = {};
-									  PendingOp.DidFinish = true;
-								  }
-							  });
-			};
+				// The PendingOperation has finished, nothing else to do.
+				if (PendingOp.DidFinish)
+				{
+					return;
+				}
+
+				uint64_t BytesTransfer = PendingOp.Data.GetSize() - PendingOp.NumBytesTransferred;
+
+				// It means that the PedingOp has not transferred all bytes to the Buffer
+				if (BytesTransfer > 0)
+				{
+					PerformPendingOperation(PendingOp);
+				}
+				else
+				{
+					PendingOp.Result = {};
+					PendingOp.DidFinish = true;
+				}
+			}
+
+			/// @brief Finds the operation for a file descriptor. Each descriptor belongs to a single file, whose strand
+			/// is the only one that inserts, touches or erases its operation, so the operation itself is used without
+			/// holding PendingIOMutex. Map nodes stay where they are while other descriptors' operations come and go
+			PendingIOOperation* FindPendingOperation(int FileDescriptor)
+			{
+				std::lock_guard<std::mutex> Lock(PendingIOMutex);
+				auto IOStatus = PendingIO.find(FileDescriptor);
+				return IOStatus != PendingIO.end() ? &IOStatus->second : nullptr;
+			}
 
+			void ErasePendingOperation(int FileDescriptor)
+			{
+				std::lock_guard<std::mutex> Lock(PendingIOMutex);
+				PendingIO.erase(FileDescriptor);
+			}
+
+			// Guards the structure of PendingIO, as files on the I/O thread pool add and remove operations in parallel
+			std::mutex PendingIOMutex {};
 			std::map<int, PendingIOOperation> PendingIO;
 			const size_t MAX_BYTES = 1048575; // It operates in 1 MB chunks of data.
 
 		public:
-			bool bCancelRequested = false;
+			// Set from ShutdownAsync while files may be running on the I/O thread pool
+			std::atomic<bool> bCancelRequested {false};
 
 			Modio::ErrorCode Initialize()
 			{
@@ -186,31 +203,39 @@ namespace Modio
 					return Modio::make_error_code(Modio::GenericError::BadParameter);
 				}
 
-				auto ExistingOp = PendingIO.find(FileDescriptor);
-				if (ExistingOp != PendingIO.end())
+				PendingIOOperation NewOp(Modio::Detail::Buffer(AmountOfData), FileDescriptor,
+										 PendingIOOperation::Direction::Read, OffsetInFile);
+				PendingIOOperation* PendingOp = nullptr;
 				{
-					// If PendingIO contains an operation with the flag finished,
-					// it should be removed from the list because it is considered
-					// a new call to read a file
-					if (ExistingOp->second.DidFinish == true)
+					std::lock_guard<std::mutex> Lock(PendingIOMutex);
+					auto ExistingOp = PendingIO.find(FileDescriptor);
+					if (ExistingOp != PendingIO.end())
 					{
-						PendingIO.erase(ExistingOp);
+						// If PendingIO contains an operation with the flag finished,
+						// it should be removed from the list because it is considered
+						// a new call to read a file
+						if (ExistingOp->second.DidFinish == true)
+						{
+							PendingIO.erase(ExistingOp);
+						}
 					}
-				}
 
-				auto PendingOp = PendingIO.insert(std::make_pair(
-					FileDescriptor, PendingIOOperation(Modio::Detail::Buffer(AmountOfData), FileDescriptor,
-													   PendingIOOperation::Direction::Read, OffsetInFile)));
+					auto InsertedOp = PendingIO.insert(std::make_pair(FileDescriptor, std::move(NewOp)));
+					if (InsertedOp.second == true)
+					{
+						PendingOp = &InsertedOp.first->second;
+					}
+				}
 
-				if (PendingOp.second == true)
+				if (PendingOp != nullptr)
 				{
-					PerformPendingOperation(PendingOp.first->second);
-					return PendingOp.first->second.Result;
+					PerformPendingOperation(*PendingOp);
+					return PendingOp->Result;
 				}
 				else
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-												"File Descriptor {} already in queue with path", FileDescriptor);
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+								"File Descriptor {} already in queue with path", FileDescriptor);
 				}
 
 				return {};
@@ -229,23 +254,23 @@ namespace Modio
 
 				// When a file is downloaded, multiple write request occur all with the same File Descriptor. Because
 				// a PendingIO is a dictionary, it keeps 1 FD for 1 PendingIOOperation.
-				auto IOStatus = PendingIO.find(FileDescriptor);
-				bool InsidePendingIO = IOStatus != PendingIO.end();
+				PendingIOOperation* IOStatus = FindPendingOperation(FileDescriptor);
+				bool InsidePendingIO = IOStatus != nullptr;
 				if (InsidePendingIO == true)
 				{
 					// In case the previous PendingIOOperation finished, it is necessary to update the OffsetInFile to
 					// the new value passed in this write operation.
-					if (IOStatus->second.DidFinish == true)
+					if (IOStatus->DidFinish == true)
 					{
-						IOStatus->second.DidFinish = false;
-						IOStatus->second.Offset = OffsetInFile;
-						IOStatus->second.NumBytesTransferred = Modio::FileSize(0);
-						IOStatus->second.Data = std::move(SourceData);
+						IOStatus->DidFinish = false;
+						IOStatus->Offset = OffsetInFile;
+						IOStatus->NumBytesTransferred = Modio::FileSize(0);
+						IOStatus->Data = std::move(SourceData);
 					}
 					// It is possible that the last operation did not work, then report back that error to the caller
-					else if (IOStatus->second.Result.has_value())
+					else if (IOStatus->Result.has_value())
 					{
-						return IOStatus->second.Result;
+						return IOStatus->Result;
 					}
 					// If no error but still not finished, it will create an error which signals that the operation
 					// is still in process.
@@ -265,19 +290,27 @@ namespace Modio
 					std::size_t Alignment = 256;
 					Modio::Detail::Buffer AlignedData = SourceData.Clone(Alignment);
 
-					auto PendingOp = PendingIO.insert(std::make_pair(
-						FileDescriptor, PendingIOOperation(std::move(AlignedData), FileDescriptor,
-														   PendingIOOperation::Direction::Write, OffsetInFile)));
+					PendingIOOperation* PendingOp = nullptr;
+					{
+						std::lock_guard<std::mutex> Lock(PendingIOMutex);
+						auto InsertedOp = PendingIO.insert(std::make_pair(
+							FileDescriptor, PendingIOOperation(std::move(AlignedData), FileDescriptor,
+															   PendingIOOperation::Direction::Write, OffsetInFile)));
+						if (InsertedOp.second == true)
+						{
+							PendingOp = &InsertedOp.first->second;
+						}
+					}
 
-					if (PendingOp.second == true)
+					if (PendingOp != nullptr)
 					{
-						PerformPendingOperation(PendingOp.first->second);
-						return PendingOp.first->second.Result;
+						PerformPendingOperation(*PendingOp);
+						return PendingOp->Result;
 					}
 					else
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-													"File Descriptor {} already in queue with path", FileDescriptor);
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+									"File Descriptor {} already in queue with path", FileDescriptor);
 					}
 				}
 
@@ -286,12 +319,12 @@ namespace Modio
 
 			std::pair<bool, Modio::Optional<Modio::ErrorCode>> IOCompleted(int FileDescriptor)
 			{
-				HandlePendingTasks();
-				auto IOStatus = PendingIO.find(FileDescriptor);
+				PendingIOOperation* IOStatus = FindPendingOperation(FileDescriptor);
 
-				if (IOStatus != PendingIO.end())
+				if (IOStatus != nullptr)
 				{
-					return std::make_pair(IOStatus->second.DidFinish, IOStatus->second.Result);
+					ProgressPendingOperation(*IOStatus);
+					return std::make_pair(IOStatus->DidFinish, IOStatus->Result);
 				}
 				else
 				{
@@ -302,28 +335,29 @@ namespace Modio
 
 			Modio::Optional<Modio::Detail::Buffer> RetrieveReadBuffer(int FileDescriptor)
 			{
-				// Call this first to update any completions since we last checked
-				HandlePendingTasks();
-				auto IOStatus = PendingIO.find(FileDescriptor);
+				PendingIOOperation* IOStatus = FindPendingOperation(FileDescriptor);
 
 				// The file descriptor is not present in the PendingIO dictionary
-				if (IOStatus == PendingIO.end())
+				if (IOStatus == nullptr)
 				{
 					return {};
 				}
 
+				// Call this first to update any completions since we last checked
+				ProgressPendingOperation(*IOStatus);
+
 				// Add a log case when there is an error. However, it is possible that the error
 				// could be an "EndOfFile" condition.
-				if (IOStatus->second.Result.has_value())
+				if (IOStatus->Result.has_value())
 				{
 					Modio::Detail::Logger().Log(Modio::LogLevel::Error, Modio::LogCategory::File,
 												"Buffer read for File Descriptor {} with "
 												"NumBytesTransferred {} but the request had error {}",
-												FileDescriptor, IOStatus->second.NumBytesTransferred,
-												IOStatus->second.Result.value().value());
+												FileDescriptor, IOStatus->NumBytesTransferred,
+												IOStatus->Result.value().value());
 				}
 
-				Modio::FileSize BytesTransferred = IOStatus->second.NumBytesTransferred;
+				Modio::FileSize BytesTransferred = IOStatus->NumBytesTransferred;
 
 				// In case the buffer had a read of more than 0 bytes, prepare to return
 				if (BytesTransferred > 0)
@@ -335,23 +369,23 @@ namespace Modio
 					// It is done here instead of "UringHandlePendingCompletions" because at that stage
 					// it is possible to read more data. At this point we are sure we don't have any more
 					// to read.
-					if (BytesTransferred < IOStatus->second.Data.GetSize())
+					if (BytesTransferred < IOStatus->Data.GetSize())
 					{
 						// Reallocate the buffer to the correct size so we don't have to report
 						// NumBytesTransferred back to the caller and have them do the reallocation there
-						Modio::Detail::Buffer ActualData = IOStatus->second.Data.CopyRange(0, BytesTransferred);
+						Modio::Detail::Buffer ActualData = IOStatus->Data.CopyRange(0, BytesTransferred);
 						ReturnVal = Modio::Optional<Modio::Detail::Buffer>(std::move(ActualData));
 					}
 					else
 					{
-						ReturnVal = Modio::Optional<Modio::Detail::Buffer>(std::move(IOStatus->second.Data));
+						ReturnVal = Modio::Optional<Modio::Detail::Buffer>(std::move(IOStatus->Data));
 					}
 
-					if (IOStatus->second.DidFinish == true)
+					if (IOStatus->DidFinish == true)
 					{
 						// The read operation finished, then it is not necesary to keep it
 						// around in the PendingIO dictionary
-						PendingIO.erase(IOStatus);
+						ErasePendingOperation(FileDescriptor);
 					}
 
 					return ReturnVal;
@@ -365,20 +399,22 @@ namespace Modio
 			// returns error code if one happened, or an empty optional if still in progress?
 			Modio::Optional<Modio::ErrorCode> RetrieveWriteResult(int FileDescriptor)
 			{
-				HandlePendingTasks();
-				auto IOStatus = PendingIO.find(FileDescriptor);
-				if (IOStatus != PendingIO.end())
+				PendingIOOperation* IOStatus = FindPendingOperation(FileDescriptor);
+				if (IOStatus != nullptr)
 				{
-					if (IOStatus->second.DidFinish == true)
+					ProgressPendingOperation(*IOStatus);
+					// Copied before the operation is erased below
+					Modio::Optional<Modio::ErrorCode> Result = IOStatus->Result;
+					if (IOStatus->DidFinish == true)
 					{
 						// The write operation finished, then it is not necesary to keep it
 						// around in the PendingIO dictionary
-						PendingIO.erase(IOStatus);
+						ErasePendingOperation(FileDescriptor);
 					}
 
-					if (IOStatus->second.Result.has_value())
+					if (Result.has_value())
 					{
-						return IOStatus->second.Result;
+						return Result;
 					}
 				}
 
@@ -13,7 +13,9 @@
 #include "http/HttpRequestImplementation.h"
 #include "modio/detail/MbedtlsWrapper.h"
 #include "modio/core/ModioErrorCode.h"
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 namespace Modio
 {
@@ -21,13 +23,25 @@ namespace Modio
 	{
 		struct HttpSharedState
 		{
-			bool bCloseRequested = false;
+			// Set from ShutdownAsync while requests may be running on the I/O thread pool
+			std::atomic<bool> bCloseRequested {false};
 
 			mbedtls_ssl_config SSLConfiguration {};
 			mbedtls_entropy_context EntropyContext {};
 			mbedtls_ctr_drbg_context RandomContext {};
 			mbedtls_x509_crt CACertificates {};
 			std::string UserAgentString {};
+			// Every request's TLS session draws from RandomContext, and requests on the I/O thread pool may do so at
+			// the same time. The rest of the shared state is only read once initialized
+			std::mutex RandomContextMutex {};
+
+			static int LockedRandom(void* State, unsigned char* Output, size_t OutputLength)
+			{
+				HttpSharedState* SharedState = static_cast<HttpSharedState*>(State);
+				std::lock_guard<std::mutex> Lock(SharedState->RandomContextMutex);
+				return mbedtls_ctr_drbg_random(&SharedState->RandomContext, Output, OutputLength);
+			}
+
 			Modio::ErrorCode Initialize()
 			{
 				mbedtls_entropy_init(&EntropyContext);
@@ -50,7 +64,7 @@ namespace Modio
 					return Modio::make_error_code(Modio::HttpError::SecurityConfigurationInvalid);
 				}
 
-				mbedtls_ssl_conf_rng(&SSLConfiguration, mbedtls_ctr_drbg_random, &RandomContext);
+				mbedtls_ssl_conf_rng(&SSLConfiguration, &HttpSharedState::LockedRandom, this);
 				mbedtls_ssl_conf_authmode(&SSLConfiguration, MBEDTLS_SSL_VERIFY_REQUIRED);
 				return {};
 			}
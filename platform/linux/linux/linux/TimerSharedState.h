@@ -17,16 +17,28 @@
 #include "timer/TimerImplementation.h"
 #include <cstdio>
 #include <iostream>
+#include <algorithm>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 class TimerSharedState : public std::enable_shared_from_this<TimerSharedState>
 {
-	using TimerMap = std::map<std::chrono::steady_clock::time_point, fu2::unique_function<void(Modio::ErrorCode)>>;
+	struct PendingTimer
+	{
+		const TimerImplementation* Owner;
+		fu2::unique_function<void(Modio::ErrorCode)> Callback;
+	};
+	// A multimap, as timers started on different I/O threads may calculate the same expiry time
+	using TimerMap = std::multimap<std::chrono::steady_clock::time_point, PendingTimer>;
 
-public:
+	// Timers are started from the I/O thread pool as well as the global io_context, which processes them
+	std::mutex PendingTimersMutex {};
 	TimerMap PendingTimers {};
 
+public:
 	Modio::ErrorCode InitializeTimer(std::shared_ptr<TimerImplementation> ImplementationToInitialize)
 	{
 		return {};
@@ -41,31 +53,70 @@ public:
 		std::chrono::steady_clock::duration TimerDuration = TimerToStart->GetTimerDuration();
 		fu2::unique_function<void(Modio::ErrorCode)> WrappedCallback {
 			[Token = std::move(Token)](Modio::ErrorCode ec) mutable {
+				// Token is dispatched from the global io_context to its own executor, such as the strand of the request
+				// or file that started the timer
 				ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(),
 						   [Token = std::move(Token), ec]() mutable {
 							   Token(ec);
 						   });
 			}};
 		TimerToStart->CalculatedExpiryTime = TimerDuration + std::chrono::steady_clock::now();
-		PendingTimers.insert({TimerToStart->CalculatedExpiryTime, std::move(WrappedCallback)});
+		std::lock_guard<std::mutex> Lock(PendingTimersMutex);
+		PendingTimers.emplace(TimerToStart->CalculatedExpiryTime,
+							  PendingTimer {TimerToStart.get(), std::move(WrappedCallback)});
 		// std::cout << TimerToStart->ThreadPoolTimer << "start "
 		//		  << std::chrono::steady_clock::now().time_since_epoch().count() << std::endl;
 	}
 
+	/// @brief Invokes the callbacks of the timers that have expired. Called by ProcessTimersOp on every tick of the
+	/// global io_context
+	void ProcessExpiredTimers()
+	{
+		std::vector<fu2::unique_function<void(Modio::ErrorCode)>> ExpiredCallbacks;
+		{
+			std::lock_guard<std::mutex> Lock(PendingTimersMutex);
+			// Check the first timer in the queue, if there's a timer and it's expiry is in the past, then invoke the
+			// callback and continue
+			auto CurrentTimer = PendingTimers.begin();
+			while (CurrentTimer != PendingTimers.end() && CurrentTimer->first < std::chrono::steady_clock::now())
+			{
+				ExpiredCallbacks.push_back(std::move(CurrentTimer->second.Callback));
+				CurrentTimer = PendingTimers.erase(CurrentTimer);
+			}
+		}
+		for (fu2::unique_function<void(Modio::ErrorCode)>& Callback : ExpiredCallbacks)
+		{
+			Callback({});
+		}
+	}
+
 	void CancelTimer(std::shared_ptr<TimerImplementation> TimerToCancel)
 	{
-		auto FoundTimer = PendingTimers.find(TimerToCancel->CalculatedExpiryTime);
-		if (FoundTimer != PendingTimers.end())
+		fu2::unique_function<void(Modio::ErrorCode)> CanceledCallback;
 		{
-			FoundTimer->second(Modio::make_error_code(Modio::GenericError::OperationCanceled));
+			std::lock_guard<std::mutex> Lock(PendingTimersMutex);
+			auto FoundTimers = PendingTimers.equal_range(TimerToCancel->CalculatedExpiryTime);
+			auto FoundTimer = std::find_if(FoundTimers.first, FoundTimers.second, [&TimerToCancel](auto& Timer) {
+				return Timer.second.Owner == TimerToCancel.get();
+			});
+			if (FoundTimer == FoundTimers.second)
+			{
+				return;
+			}
+			CanceledCallback = std::move(FoundTimer->second.Callback);
 			PendingTimers.erase(FoundTimer);
 		}
+		CanceledCallback(Modio::make_error_code(Modio::GenericError::OperationCanceled));
 	}
 	void CancelAll()
 	{
-		std::for_each(PendingTimers.begin(), PendingTimers.end(), [](auto& PendingTimerCallback) mutable {
-			PendingTimerCallback.second(Modio::make_error_code(Modio::GenericError::OperationCanceled));
+		TimerMap CanceledTimers;
+		{
+			std::lock_guard<std::mutex> Lock(PendingTimersMutex);
+			CanceledTimers.swap(PendingTimers);
+		}
+		std::for_each(CanceledTimers.begin(), CanceledTimers.end(), [](auto& PendingTimerCallback) mutable {
+			PendingTimerCallback.second.Callback(Modio::make_error_code(Modio::GenericError::OperationCanceled));
 		});
-		PendingTimers.clear();
 	}
 };
\ No newline at end of file
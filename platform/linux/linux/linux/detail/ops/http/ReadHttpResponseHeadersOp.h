@@ -76,9 +76,8 @@ namespace Modio
 					}
 					else
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"Response Headers received OK with response code: {}",
-													Request->ResponseCode);
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+									"Response Headers received OK with response code: {}", Request->ResponseCode);
 
 						// Already processed the response code and removed header data from the response buffer so just
 						// return no error code
@@ -111,9 +110,8 @@ namespace Modio
 
 					// Consume amount of data the headers used up so ResponseDataBuffer is only the body
 					Request->ResponseDataBuffer.consume(LinearBuffer.GetSize() - Matches.suffix().length());
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"expecting {0} bytes in response, total",
-												Request->GetContentLength().value_or(0));
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+								"expecting {0} bytes in response, total", Request->GetContentLength().value_or(0));
 					return true;
 				}
 				else
@@ -95,8 +95,7 @@ namespace Modio
 					}
 					else
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"SSL Read failure {0}", ReadCount);
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "SSL Read failure {0}", ReadCount);
 						Self.complete(Modio::make_error_code(Modio::HttpError::CannotOpenConnection), 0);
 						return;
 					}
@@ -57,14 +57,12 @@ namespace Modio
 						PinnedState->InitializeRequest(Request, InitStatus);
 						if (InitStatus)
 						{
-							Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-														"Init Request Failed");
+							MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Init Request Failed");
 							Self.complete(InitStatus);
 							return;
 						}
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"Sending request: {}",
-													Request->GetParameters().GetFormattedResourcePath());
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "Sending request: {}",
+									Request->GetParameters().GetFormattedResourcePath());
 					}
 
 					yield WaitForSSLHandshakeAsync(Request, PinnedState, std::move(Self));
@@ -100,9 +98,8 @@ namespace Modio
 					yield SSLConnectionWriteAsync(Request, Payload, SharedState, std::move(Self));
 					if (ec)
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-													"Request send failed, buffer dump {0}",
-													(const char*) Payload.begin()->Data());
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http,
+									"Request send failed, buffer dump {0}", (const char*) Payload.begin()->Data());
 						Self.complete(ec);
 						return;
 					}
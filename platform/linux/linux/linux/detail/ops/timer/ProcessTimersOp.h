@@ -32,21 +32,7 @@ public:
 		{
 			while (PinnedState)
 			{
-				if (PinnedState->PendingTimers.size())
-				{
-					// Check the first timer in the queue, if there's a timer and it's expiry is in the past, then
-					// invoke the callback and continue
-					auto CurrentTimer = PinnedState->PendingTimers.begin();
-					while (CurrentTimer != PinnedState->PendingTimers.end() &&
-						   CurrentTimer->first < std::chrono::steady_clock::now())
-					{
-						CurrentTimer->second({});
-						CurrentTimer = PinnedState->PendingTimers.erase(CurrentTimer);
-					}
-
-					// process any pending timers here by posting their completion handler to the executor with an empty
-					// error code
-				}
+				PinnedState->ProcessExpiredTimers();
 				// Queue us up to run on the next tick
 				yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
 			}
@@ -12,6 +12,9 @@
 #include "modio/core/ModioLogEnum.h"
 #include "modio/detail/AsioWrapper.h"
 #include "modio/detail/FmtWrapper.h"
+#include <chrono>
+#include <iterator>
+#include <string>
 
 namespace Modio
 {
@@ -22,49 +25,25 @@ namespace Modio
 		/// @brief Helper implementation class to organize logging operations and formatting
 		class LoggerImplementation
 		{
-			ModioAsio::strand<ModioAsio::io_context::executor_type>& LogStrand;
-
 		public:
 			/// @docinternal
-			/// @brief LoggerImplementation constructor
-			LoggerImplementation(ModioAsio::strand<ModioAsio::io_context::executor_type>& Strand) : LogStrand(Strand) {}
-
-			/// @docinternal
-			/// @brief Receive an formatted string and transform it to another string that fits 
-			template<typename... ArgTypes>
-			std::string Log(LogLevel Level, LogCategory Category, std::string Format, ArgTypes... Args)
+			/// @brief Formats a message into the line the SDK emits for it, and writes the line to the platform's
+			/// output
+			/// @param Line Receives the formatted line. Its allocation is reused between calls
+			/// @param Level the severity of the log, from a Trace to Error
+			/// @param Category it relates to the subsystem emitting this log
+			/// @param Time when the message was logged
+			/// @param Message The message, already formatted
+			void Write(std::string& Line, LogLevel Level, LogCategory Category,
+					   std::chrono::system_clock::time_point Time, const std::string& Message)
 			{
 				constexpr const char* LogFormatString = "[{:%H:%M:%S}:{}][{}][{}] {}\r\n";
-				
-				std::string LogUserString = fmt::format(Format, Args...);
-				auto Now = std::chrono::system_clock::now();
-				// @todo: OutputDebugStringA might crash if the string is too big, so it would be nice to split the
-				// string up or make some solution that is reliable when using big strings
-				auto FormattedOutput =
-				fmt::format(LogFormatString, Now,
-							std::chrono::duration_cast<std::chrono::milliseconds>(Now.time_since_epoch()) % 1000,
-							LogLevelToString(Level), LogCategoryToString(Category), LogUserString);
-				ModioAsio::post(LogStrand, [FormattedOutput]() { fmt::print(fmt::runtime(FormattedOutput)); });
-				return FormattedOutput;
-			}
 
-			/// @docinternal
-			/// @brief Immediately uses the current context to log output. Not intended for general usage
-			template<typename... ArgTypes>
-			std::string LogImmediate(LogLevel Level, LogCategory Category, std::string Format, ArgTypes... Args)
-			{
-				constexpr const char* LogFormatString = "[{:%H:%M:%S}:{}][{}][{}] {}\r\n";
-				
-				std::string LogUserString = fmt::format(fmt::runtime(Format), Args...);
-				auto Now = std::chrono::system_clock::now();
-				// @todo: OutputDebugStringA might crash if the string is too big, so it would be nice to split the
-				// string up or make some solution that is reliable when using big strings
-				auto FormattedOutput =
-				fmt::format(fmt::runtime(LogFormatString), Now,
-							std::chrono::duration_cast<std::chrono::milliseconds>(Now.time_since_epoch()) % 1000,
-							LogLevelToString(Level), LogCategoryToString(Category), LogUserString);
-				fmt::print("{}", FormattedOutput.c_str());
-				return FormattedOutput;
+				Line.clear();
+				fmt::format_to(std::back_inserter(Line), fmt::runtime(LogFormatString), Time,
+							   std::chrono::duration_cast<std::chrono::milliseconds>(Time.time_since_epoch()) % 1000,
+							   LogLevelToString(Level), LogCategoryToString(Category), Message);
+				fmt::print("{}", Line);
 			}
 		};
 	} // namespace Detail
@@ -25,6 +25,7 @@ namespace Modio
 	{
 		class TimerServiceImplementation : public Modio::Detail::ITimerServiceImplementation
 		{
+			// Read by timers started on the I/O thread pool, so only accessed with std::atomic_load/atomic_store
 			std::shared_ptr<TimerSharedState> SharedState {};
 			ModioAsio::io_context::service& OwningService;
 
@@ -54,23 +55,23 @@ namespace Modio
 			auto WaitAsync(IOObjectImplementationType PlatformIOObjectInstance, CompletionToken&& Token)
 			{
 				return ModioAsio::async_compose<CompletionToken, void(Modio::ErrorCode)>(
-					WaitForTimerOp(PlatformIOObjectInstance, SharedState), Token,
+					WaitForTimerOp(PlatformIOObjectInstance, std::atomic_load(&SharedState)), Token,
 					Modio::Detail::Services::GetGlobalContext().get_executor());
 			}
 			void Cancel(IOObjectImplementationType PlatformIOObjectInstance)
 			{
-				if (SharedState)
+				if (std::shared_ptr<TimerSharedState> PinnedState = std::atomic_load(&SharedState))
 				{
-					SharedState->CancelTimer(PlatformIOObjectInstance);
+					PinnedState->CancelTimer(PlatformIOObjectInstance);
 				}
 			}
 			void Shutdown() override
 			{
-				if (SharedState)
+				if (std::shared_ptr<TimerSharedState> PinnedState = std::atomic_load(&SharedState))
 				{
-					SharedState->CancelAll();
+					PinnedState->CancelAll();
 				}
-				SharedState.reset();
+				std::atomic_store(&SharedState, std::shared_ptr<TimerSharedState> {});
 			};
 		};
 	} // namespace Detail
@@ -205,8 +205,8 @@ namespace Modio
 				}
 				else
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-												"File Descriptor {} already in queue with path", FileDescriptor);
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+								"File Descriptor {} already in queue with path", FileDescriptor);
 				}
 
 				return {};
@@ -266,8 +266,8 @@ namespace Modio
 					}
 					else
 					{
-						Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-													"File Descriptor {} already in queue with path", FileDescriptor);
+						MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File,
+									"File Descriptor {} already in queue with path", FileDescriptor);
 					}
 				}
 
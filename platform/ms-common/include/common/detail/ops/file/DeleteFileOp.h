@@ -36,8 +36,7 @@ public:
 		}
 		reenter(CoroState)
 		{
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin delete of {}",
-										FilePath.string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin delete of {}", FilePath.string());
 			yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
 			Modio::ErrorCode RemoveStatus;
 			Modio::filesystem::remove(FilePath, RemoveStatus);
@@ -53,8 +53,7 @@ public:
 		}
 		reenter(CoroutineState)
 		{
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin delete of {}",
-										FolderPath.string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin delete of {}", FolderPath.string());
 			{
 				DirectoryIterator = Modio::filesystem::recursive_directory_iterator(FolderPath, ec);
 				if (ec)
@@ -78,9 +78,8 @@ public:
 
 			yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
 
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-										"Begin read of {} bytes from {} at {}", Length, FileImpl->GetPath().string(),
-										Offset);
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin read of {} bytes from {} at {}", Length,
+						FileImpl->GetPath().string(), Offset);
 
 			ReadOpParams->hEvent = CreateEvent(nullptr, false, false, nullptr);
 
@@ -110,8 +109,8 @@ public:
 			}
 			else
 			{
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
-											FileImpl->GetPath().string());
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
+							FileImpl->GetPath().string());
 				*NumberOfBytesRead = ReadOpParams->InternalHigh;
 				if (*NumberOfBytesRead < Length)
 				{
@@ -133,8 +132,8 @@ public:
 				yield StatusTimer.WaitAsync(std::move(Self));
 			}
 
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
-										FileImpl->GetPath().string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
+						FileImpl->GetPath().string());
 			*NumberOfBytesRead = ReadOpParams->InternalHigh;
 			if (*NumberOfBytesRead < Length)
 			{
@@ -77,8 +77,8 @@ public:
 
 			yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
 			
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-										"Begin read of {} bytes from {}", Length, FileImpl->GetPath().string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin read of {} bytes from {}", Length,
+						FileImpl->GetPath().string());
 
 			ReadOpParams->hEvent = CreateEvent(NULL, false, false, NULL);
 
@@ -108,8 +108,8 @@ public:
 			}
 			else
 			{
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
-											FileImpl->GetPath().string());
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
+							FileImpl->GetPath().string());
 				*NumberOfBytesRead = ReadOpParams->InternalHigh;
 				FileImpl->Seek(Modio::FileOffset(*NumberOfBytesRead), Modio::Detail::SeekDirection::Forward);
 
@@ -132,8 +132,8 @@ public:
 				yield StatusTimer.WaitAsync(std::move(Self));
 			}
 
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
-										FileImpl->GetPath().string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish read from {}",
+						FileImpl->GetPath().string());
 			*NumberOfBytesRead = ReadOpParams->InternalHigh;
 
 			FileImpl->Seek(Modio::FileOffset(*NumberOfBytesRead), Modio::Detail::SeekDirection::Forward);
@@ -100,9 +100,8 @@ public:
 
 			yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
 			
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-										"Begin write of {} bytes to {}", Buffer.GetSize(),
-										FileImpl->GetPath().string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin write of {} bytes to {}",
+						Buffer.GetSize(), FileImpl->GetPath().string());
 			WriteOpParams = std::make_shared<OVERLAPPED>();
 			WriteOpParams->hEvent = CreateEvent(nullptr, false, false, nullptr);
 			if (!WriteOpParams->hEvent)
@@ -139,8 +138,8 @@ public:
 			else
 			{
 				// File write completed synchronously so no need to wait, complete the operation
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
-											FileImpl->GetPath().string());
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
+							FileImpl->GetPath().string());
 				FileImpl->Seek(Modio::FileOffset(Buffer.GetSize()), Modio::Detail::SeekDirection::Forward);
 				Self.complete({});
 				return;
@@ -152,8 +151,8 @@ public:
 				yield StatusTimer.WaitAsync(std::move(Self));
 			}
 
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
-										FileImpl->GetPath().string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
+						FileImpl->GetPath().string());
 
 			FileImpl->Seek(Modio::FileOffset(Buffer.GetSize()), Modio::Detail::SeekDirection::Forward);
 
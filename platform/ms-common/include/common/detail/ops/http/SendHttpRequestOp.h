@@ -89,8 +89,8 @@ public:
 					return;
 				} else
 				{
-					Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::Http,
-												"sending request body {}", Payload->c_str());
+					MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::Http, "sending request body {}",
+								Payload->c_str());
 				}
 			}
 			else
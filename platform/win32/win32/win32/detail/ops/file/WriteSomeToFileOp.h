@@ -92,9 +92,8 @@ public:
 			}
 
 			yield ModioAsio::post(Modio::Detail::Services::GetGlobalContext().get_executor(), std::move(Self));
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File,
-										"Begin write of {} bytes to {} at {}", Buffer.GetSize(),
-										FileImpl->GetPath().string(), FileOffset);
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Begin write of {} bytes to {} at {}",
+						Buffer.GetSize(), FileImpl->GetPath().string(), FileOffset);
 			WriteOpParams = std::make_shared<OVERLAPPED>();
 			WriteOpParams->hEvent = CreateEvent(NULL, false, false, NULL);
 			if (!WriteOpParams->hEvent)
@@ -126,8 +125,8 @@ public:
 			else
 			{
 				// File write completed synchronously so no need to wait, complete the operation
-				Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
-											FileImpl->GetPath().string());
+				MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
+							FileImpl->GetPath().string());
 				Buffer.~Buffer();
 				Self.complete(std::error_code {});
 				return;
@@ -140,8 +139,8 @@ public:
 				yield StatusTimer.WaitAsync(std::move(Self));
 			}
 
-			Modio::Detail::Logger().Log(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
-										FileImpl->GetPath().string());
+			MODIO_LOG(Modio::LogLevel::Trace, Modio::LogCategory::File, "Finish write to {}",
+						FileImpl->GetPath().string());
 			Buffer.~Buffer();
 			Self.complete(std::error_code {});
 			return;